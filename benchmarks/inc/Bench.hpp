@@ -0,0 +1,110 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace VPF {
+namespace Bench {
+
+/* Benchmark body, runs measured code given number of times;
+ * Setup which shouldn't be measured is done before body is registered or
+ * lazily at first call;
+ */
+using Func = std::function<void(size_t num_iters)>;
+
+struct Entry {
+  std::string name;
+  Func func;
+};
+
+/* Benchmarks registered by static Registrar objects;
+ */
+inline std::vector<Entry>& Registry() {
+  static std::vector<Entry> entries;
+  return entries;
+}
+
+inline void Register(std::string name, Func func) {
+  Registry().push_back({std::move(name), std::move(func)});
+}
+
+struct Registrar {
+  Registrar(const char* name, Func func) { Register(name, std::move(func)); }
+};
+
+/* Time spent by calling thread in ExcludeScope objects, it's subtracted
+ * from benchmark time;
+ */
+inline std::chrono::steady_clock::duration& ExcludedTime() {
+  static thread_local std::chrono::steady_clock::duration excluded = {};
+  return excluded;
+}
+
+/* Use it for setup which has to be done within body, e. g. to reopen input
+ * when it's over;
+ */
+class ExcludeScope {
+public:
+  ExcludeScope() : m_start(std::chrono::steady_clock::now()) {}
+  ~ExcludeScope() {
+    ExcludedTime() += std::chrono::steady_clock::now() - m_start;
+  }
+
+private:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+/* Returns path to synthetic clip generated at build time;
+ * VALI_BENCH_DATA environment variable overrides data directory;
+ * Throws std::runtime_error if there's no such clip;
+ */
+inline std::string ClipPath(const std::string& name) {
+  const char* dir = std::getenv("VALI_BENCH_DATA");
+#ifdef VALI_BENCH_DATA_DIR
+  if (!dir) {
+    dir = VALI_BENCH_DATA_DIR;
+  }
+#endif
+  if (!dir) {
+    throw std::runtime_error("VALI_BENCH_DATA isn't set");
+  }
+
+  auto path = std::string(dir) + "/" + name;
+  if (!std::ifstream(path)) {
+    throw std::runtime_error("no clip " + path);
+  }
+  return path;
+}
+
+/* Keeps compiler from optimizing value away;
+ */
+template <typename T> inline void DoNotOptimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+} // namespace Bench
+} // namespace VPF
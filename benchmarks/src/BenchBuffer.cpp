@@ -0,0 +1,77 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Bench.hpp"
+#include "MemoryInterfaces.hpp"
+
+using namespace VPF;
+
+namespace {
+struct FrameSize {
+  const char* name;
+  size_t size;
+};
+
+// NV12 frame sizes.
+const FrameSize s_sizes[] = {{"360p", 640U * 360U * 3U / 2U},
+                             {"1080p", 1920U * 1080U * 3U / 2U},
+                             {"4k", 3840U * 2160U * 3U / 2U}};
+
+void Register(const FrameSize& frame) {
+  auto const size = frame.size;
+  auto const suffix = std::string("/") + frame.name;
+
+  Bench::Register("Buffer/MakeOwnMem" + suffix, [size](size_t num_iters) {
+    for (size_t i = 0U; i < num_iters; i++) {
+      std::unique_ptr<Buffer> buf(Buffer::MakeOwnMem(size));
+      Bench::DoNotOptimize(buf->GetRawMemPtr());
+    }
+  });
+
+  Bench::Register("Buffer/MakeView" + suffix, [size](size_t num_iters) {
+    std::vector<uint8_t> mem(size);
+    for (size_t i = 0U; i < num_iters; i++) {
+      Buffer buf(size, mem.data(), false);
+      Bench::DoNotOptimize(buf.GetRawMemPtr());
+    }
+  });
+
+  // Capacity is kept, so it's memcpy plus bookkeeping.
+  Bench::Register("Buffer/Update_copy" + suffix, [size](size_t num_iters) {
+    std::vector<uint8_t> mem(size, 128U);
+    std::unique_ptr<Buffer> buf(Buffer::MakeOwnMem(size));
+    for (size_t i = 0U; i < num_iters; i++) {
+      buf->Update(size, mem.data());
+      Bench::DoNotOptimize(buf->GetRawMemPtr());
+    }
+  });
+
+  Bench::Register("Buffer/Update_resize" + suffix, [size](size_t num_iters) {
+    std::unique_ptr<Buffer> buf(Buffer::MakeOwnMem(size));
+    for (size_t i = 0U; i < num_iters; i++) {
+      buf->Update(i % 2U ? size : size / 2U);
+      Bench::DoNotOptimize(buf->GetRawMemSize());
+    }
+  });
+}
+
+const bool s_registered = []() {
+  for (auto& frame : s_sizes) {
+    Register(frame);
+  }
+  return true;
+}();
+} // namespace
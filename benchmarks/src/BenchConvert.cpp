@@ -0,0 +1,85 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "Bench.hpp"
+#include "Tasks.hpp"
+#include "Utils.hpp"
+
+using namespace VPF;
+
+namespace {
+struct Conversion {
+  const char* name;
+  Pixel_Format src;
+  Pixel_Format dst;
+};
+
+// Conversions done after CPU decode and before inference.
+const Conversion s_conversions[] = {
+    {"YUV420_RGB", YUV420, RGB},
+    {"NV12_RGB", NV12, RGB},
+    {"YUV420_BGR", YUV420, BGR},
+    {"YUV420_10bit_RGB", YUV420_10bit, RGB},
+    {"RGB_YUV420", RGB, YUV420},
+};
+
+struct Resolution {
+  const char* name;
+  uint32_t width;
+  uint32_t height;
+};
+
+const Resolution s_resolutions[] = {{"360p", 640U, 360U},
+                                    {"1080p", 1920U, 1080U}};
+
+void Convert(const Conversion& cvt, const Resolution& res, size_t num_iters) {
+  std::unique_ptr<TypedConvertFrame> task;
+  std::unique_ptr<Buffer> src;
+  std::unique_ptr<Buffer> dst;
+  {
+    Bench::ExcludeScope exclude;
+    task = std::make_unique<TypedConvertFrame>(res.width, res.height, cvt.src,
+                                               cvt.dst);
+    src.reset(Buffer::MakeOwnMem(
+        getBufferSize(res.width, res.height, toFfmpegPixelFormat(cvt.src))));
+    dst.reset(Buffer::MakeOwnMem(
+        getBufferSize(res.width, res.height, toFfmpegPixelFormat(cvt.dst))));
+    memset(src->GetRawMemPtr(), 128, src->GetRawMemSize());
+  }
+  ColorspaceConversionContext cc_ctx(BT_709, MPEG);
+
+  for (size_t i = 0U; i < num_iters; i++) {
+    auto details = task->Execute(*src, *dst, cc_ctx);
+    if (TaskExecStatus::TASK_EXEC_SUCCESS != details.m_status) {
+      throw std::runtime_error("ConvertFrame failed: " + details.m_msg);
+    }
+  }
+}
+
+const bool s_registered = []() {
+  for (auto& cvt : s_conversions) {
+    for (auto& res : s_resolutions) {
+      auto const name =
+          std::string("ConvertFrame/") + cvt.name + "/" + res.name;
+      Bench::Register(name, [&cvt, &res](size_t num_iters) {
+        Convert(cvt, res, num_iters);
+      });
+    }
+  }
+  return true;
+}();
+} // namespace
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* CPU decoder hot paths on synthetic clips; Decoder is reopened when clip
+ * is over, reopen time isn't counted;
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Bench.hpp"
+#include "NvCodecCLIOptions.h"
+#include "Tasks.hpp"
+
+extern "C" {
+#include <libavformat/avio.h>
+#include <libavutil/error.h>
+#include <libavutil/mem.h>
+}
+
+using namespace VPF;
+
+namespace {
+// Clips generated at build time, see CMakeLists.txt.
+const char* s_clips[] = {"mpeg4_360p.mkv", "mpeg4_1080p.mkv",
+                         "mpeg4_4k.mkv", "mjpeg_1080p.mkv"};
+
+// Every clip packet fits, so ReadPacket never waits for decoder.
+constexpr int s_pkt_queue_size = 4096;
+
+// Same as BufferedReader default.
+constexpr int s_avio_buffer_size = 4 * 1024 * 1024;
+
+/* Feeds decoder from memory through custom AVIOContext, same way
+ * BufferedReader feeds it from Python file object;
+ */
+struct MemoryReader {
+  std::vector<uint8_t> m_data;
+  size_t m_pos = 0U;
+
+  explicit MemoryReader(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    m_data.assign(std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>());
+  }
+
+  static int Read(void* opaque, uint8_t* buf, int buf_size) {
+    auto me = static_cast<MemoryReader*>(opaque);
+    auto const num_bytes =
+        std::min<size_t>(buf_size, me->m_data.size() - me->m_pos);
+    if (!num_bytes) {
+      return AVERROR_EOF;
+    }
+
+    memcpy(buf, me->m_data.data() + me->m_pos, num_bytes);
+    me->m_pos += num_bytes;
+    return (int)num_bytes;
+  }
+
+  std::shared_ptr<AVIOContext> MakeContext() {
+    m_pos = 0U;
+    auto buf = static_cast<unsigned char*>(av_malloc(s_avio_buffer_size));
+    auto io_ctx = avio_alloc_context(buf, s_avio_buffer_size, 0, this,
+                                     MemoryReader::Read, nullptr, nullptr);
+    if (!io_ctx) {
+      av_free(buf);
+      throw std::bad_alloc();
+    }
+
+    return std::shared_ptr<AVIOContext>(io_ctx, [](AVIOContext* p) {
+      av_freep(&p->buffer);
+      avio_context_free(&p);
+    });
+  }
+};
+
+class Input {
+public:
+  Input(const std::string& clip, bool use_avio)
+      : m_path(Bench::ClipPath(clip)) {
+    if (use_avio) {
+      Bench::ExcludeScope exclude;
+      m_reader = std::make_unique<MemoryReader>(m_path);
+    }
+    Reopen();
+  }
+
+  void Reopen() {
+    Bench::ExcludeScope exclude;
+    std::map<std::string, std::string> options;
+    NvDecoderClInterface cli_iface(options);
+
+    m_decoder.reset();
+    if (m_reader) {
+      m_decoder.reset(DecodeFrame::Make("", cli_iface, -1, s_pkt_queue_size,
+                                        m_reader->MakeContext()));
+    } else {
+      m_decoder.reset(DecodeFrame::Make(m_path.c_str(), cli_iface, -1,
+                                        s_pkt_queue_size));
+    }
+  }
+
+  DecodeFrame& Decoder() { return *m_decoder; }
+
+private:
+  std::string m_path;
+  std::unique_ptr<MemoryReader> m_reader;
+  std::unique_ptr<DecodeFrame> m_decoder;
+};
+
+void ReadPackets(const std::string& clip, bool use_avio, size_t num_iters) {
+  Input input(clip, use_avio);
+  for (size_t i = 0U; i < num_iters; i++) {
+    auto status = input.Decoder().ReadPacket();
+    if (DEC_OVER == status) {
+      input.Reopen();
+      status = input.Decoder().ReadPacket();
+    }
+
+    if (DEC_SUCCESS != status) {
+      throw std::runtime_error("ReadPacket failed");
+    }
+  }
+}
+
+void DecodeFrames(const std::string& clip, size_t num_iters) {
+  Input input(clip, false);
+  std::unique_ptr<Buffer> dst;
+  {
+    Bench::ExcludeScope exclude;
+    dst.reset(Buffer::MakeOwnMem(input.Decoder().GetHostFrameSize()));
+  }
+  PacketData pkt_data;
+
+  for (size_t i = 0U; i < num_iters; i++) {
+    auto details = input.Decoder().Run(*dst, pkt_data, std::nullopt);
+    if (TaskExecInfo::END_OF_STREAM == details.m_info) {
+      input.Reopen();
+      details = input.Decoder().Run(*dst, pkt_data, std::nullopt);
+    }
+
+    if (TaskExecStatus::TASK_EXEC_SUCCESS != details.m_status) {
+      throw std::runtime_error("DecodeFrame failed: " + details.m_msg);
+    }
+  }
+}
+
+void GetParams(const std::string& clip, size_t num_iters) {
+  Input input(clip, false);
+  for (size_t i = 0U; i < num_iters; i++) {
+    Params params;
+    input.Decoder().GetParams(params);
+    Bench::DoNotOptimize(params);
+  }
+}
+
+const bool s_registered = []() {
+  for (std::string clip : s_clips) {
+    auto const name = clip.substr(0U, clip.find('.'));
+    Bench::Register("ReadPacket/" + name, [clip](size_t num_iters) {
+      ReadPackets(clip, false, num_iters);
+    });
+    Bench::Register("ReadPacket_avio/" + name, [clip](size_t num_iters) {
+      ReadPackets(clip, true, num_iters);
+    });
+    Bench::Register("DecodeFrame/" + name, [clip](size_t num_iters) {
+      DecodeFrames(clip, num_iters);
+    });
+    Bench::Register("GetParams/" + name, [clip](size_t num_iters) {
+      GetParams(clip, num_iters);
+    });
+  }
+  return true;
+}();
+} // namespace
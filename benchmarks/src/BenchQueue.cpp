@@ -0,0 +1,66 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Packet queue between demuxer and decoder, items are shared pointers
+ * same as decoder packets;
+ */
+
+#include <memory>
+#include <thread>
+
+#include "Bench.hpp"
+#include "ProducerConsumerQueue.hpp"
+
+using namespace VPF;
+
+namespace {
+using Item = std::shared_ptr<int>;
+using Queue = ProducerConsumerQueue<Item>;
+
+void PushPop(size_t num_iters) {
+  Queue queue(64U);
+  auto item = std::make_shared<int>(0);
+  for (size_t i = 0U; i < num_iters; i++) {
+    queue.push(item);
+    Item out;
+    Bench::DoNotOptimize(queue.pop(out));
+  }
+}
+
+/* Producer thread pushes, calling thread pops; Consumer never waits, so it
+ * polls queue like decoder does;
+ */
+void ProducerConsumer(size_t num_iters) {
+  Queue queue(64U);
+  auto item = std::make_shared<int>(0);
+  std::thread producer([&]() {
+    for (size_t i = 0U; i < num_iters; i++) {
+      while (Queue::Status::Success != queue.push(item)) {
+      }
+    }
+  });
+
+  for (size_t i = 0U; i < num_iters;) {
+    Item out;
+    if (Queue::Status::Success == queue.pop(out)) {
+      i++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+}
+
+Bench::Registrar s_push_pop("Queue/push_pop", PushPop);
+Bench::Registrar s_prod_cons("Queue/producer_consumer", ProducerConsumer);
+} // namespace
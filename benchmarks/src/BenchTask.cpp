@@ -0,0 +1,103 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Per-call overhead of legacy Task interface against TypedTask;
+ * Tasks do trivial work, so numbers show cost of the interface itself;
+ */
+
+#include <memory>
+
+#include "Bench.hpp"
+#include "TC_CORE.hpp"
+#include "TypedTask.hpp"
+
+using namespace VPF;
+
+namespace {
+struct BenchToken : public Token {
+  uint64_t value = 0U;
+};
+
+class LegacyTask final : public Task {
+public:
+  LegacyTask() : Task("BenchLegacyTask", 2U, 1U) {}
+
+  TaskExecDetails Run() final {
+    auto src = dynamic_cast<BenchToken*>(GetInput(0U));
+    auto dst = dynamic_cast<BenchToken*>(GetInput(1U));
+    if (!src || !dst) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::INVALID_INPUT);
+    }
+
+    dst->value += src->value;
+    SetOutput(dst, 0U);
+    return TaskExecDetails();
+  }
+};
+
+class TypedBenchTask final
+    : public TypedTask<const BenchToken&, BenchToken&> {
+public:
+  TypedBenchTask() : TypedTask("BenchTypedTask") {}
+
+private:
+  TaskExecDetails Run(const BenchToken& src, BenchToken& dst) final {
+    dst.value += src.value;
+    return TaskExecDetails();
+  }
+};
+
+/* Mimics bindings which used to allocate shared tokens on every call;
+ */
+void LegacyTaskAlloc(size_t num_iters) {
+  static LegacyTask task;
+  for (size_t i = 0U; i < num_iters; i++) {
+    auto src = std::make_shared<BenchToken>();
+    auto dst = std::make_shared<BenchToken>();
+    src->value = i;
+    task.ClearInputs();
+    task.SetInput(src.get(), 0U);
+    task.SetInput(dst.get(), 1U);
+    Bench::DoNotOptimize(task.Execute());
+    Bench::DoNotOptimize(dst->value);
+  }
+}
+
+void LegacyTaskCall(size_t num_iters) {
+  static LegacyTask task;
+  BenchToken src, dst;
+  for (size_t i = 0U; i < num_iters; i++) {
+    src.value = i;
+    task.ClearInputs();
+    task.SetInput(&src, 0U);
+    task.SetInput(&dst, 1U);
+    Bench::DoNotOptimize(task.Execute());
+  }
+  Bench::DoNotOptimize(dst.value);
+}
+
+void TypedTaskCall(size_t num_iters) {
+  static TypedBenchTask task;
+  BenchToken src, dst;
+  for (size_t i = 0U; i < num_iters; i++) {
+    src.value = i;
+    Bench::DoNotOptimize(task.Execute(src, dst));
+  }
+  Bench::DoNotOptimize(dst.value);
+}
+
+Bench::Registrar s_legacy_alloc("Task/legacy_alloc", LegacyTaskAlloc);
+Bench::Registrar s_legacy("Task/legacy", LegacyTaskCall);
+Bench::Registrar s_typed("Task/typed", TypedTaskCall);
+} // namespace
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Command line front end of MediaGenerator, makes benchmark clips at build
+ * time;
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "MediaGenerator.hpp"
+
+using namespace std;
+using namespace VPF;
+
+static void ParseSize(const string& str, uint32_t& width, uint32_t& height) {
+  if (2 != sscanf(str.c_str(), "%ux%u", &width, &height)) {
+    throw invalid_argument("Bad size " + str + ", expected WxH");
+  }
+}
+
+static void PrintUsage(const char* argv0) {
+  cout << "Usage: " << argv0
+       << " [--codec name] [--size WxH] [--frames N] [--fps N] [--gop N]"
+          " [--bframes N] [--bit_depth 8|10] [--vfr d1,d2,...] [--audio N]"
+          " [--data N] [--switch frame:WxH]... output\n";
+}
+
+int main(int argc, char* argv[]) {
+  MediaParams params;
+  string output;
+
+  try {
+    for (auto i = 1; i < argc; i++) {
+      auto const has_value = i + 1 < argc;
+      if (!strcmp(argv[i], "--codec") && has_value) {
+        params.codec = argv[++i];
+      } else if (!strcmp(argv[i], "--size") && has_value) {
+        ParseSize(argv[++i], params.width, params.height);
+      } else if (!strcmp(argv[i], "--frames") && has_value) {
+        params.num_frames = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "--fps") && has_value) {
+        params.fps = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "--gop") && has_value) {
+        params.gop_size = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "--bframes") && has_value) {
+        params.b_frames = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "--bit_depth") && has_value) {
+        params.bit_depth = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "--vfr") && has_value) {
+        stringstream ss(argv[++i]);
+        string duration;
+        while (getline(ss, duration, ',')) {
+          params.vfr_pattern.push_back(atoi(duration.c_str()));
+        }
+      } else if (!strcmp(argv[i], "--audio") && has_value) {
+        params.num_audio_tracks = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "--data") && has_value) {
+        params.num_data_tracks = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "--switch") && has_value) {
+        string value = argv[++i];
+        auto const colon = value.find(':');
+        if (string::npos == colon) {
+          throw invalid_argument("Bad switch " + value +
+                                 ", expected frame:WxH");
+        }
+
+        ResolutionSwitch rs;
+        rs.frame = atoi(value.substr(0U, colon).c_str());
+        ParseSize(value.substr(colon + 1U), rs.width, rs.height);
+        params.res_switches.push_back(rs);
+      } else if (argv[i][0] != '-' && output.empty()) {
+        output = argv[i];
+      } else {
+        PrintUsage(argv[0]);
+        return 1;
+      }
+    }
+
+    if (output.empty()) {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+
+    MediaGenerator::Generate(params, output);
+  } catch (exception& e) {
+    cerr << output << ": " << e.what() << "\n";
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+
+using namespace std;
+using namespace VPF;
+
+struct BenchResult {
+  string name;
+  size_t iterations = 0U;
+  double median_ns = 0.0;
+  double min_ns = 0.0;
+  double max_ns = 0.0;
+};
+
+struct Options {
+  string filter;
+  string json_path;
+  double min_time = 0.2;
+  int repetitions = 5;
+};
+
+static double RunTimed(const Bench::Func& func, size_t num_iters) {
+  Bench::ExcludedTime() = {};
+  auto const start = chrono::steady_clock::now();
+  func(num_iters);
+  auto const elapsed =
+      chrono::steady_clock::now() - start - Bench::ExcludedTime();
+  return chrono::duration<double>(elapsed).count();
+}
+
+/* Number of iterations is grown until run takes min_time, every repetition
+ * then runs that many iterations;
+ */
+static BenchResult RunBench(const Bench::Entry& entry, const Options& opts) {
+  size_t num_iters = 1U;
+  auto elapsed = RunTimed(entry.func, num_iters);
+  while (elapsed < opts.min_time && num_iters < (1U << 30)) {
+    auto const scale = elapsed > 0.0 ? 1.4 * opts.min_time / elapsed : 10.0;
+    num_iters = max(num_iters + 1U,
+                    (size_t)(num_iters * min(max(scale, 1.0), 10.0)));
+    elapsed = RunTimed(entry.func, num_iters);
+  }
+
+  vector<double> ns_per_iter;
+  for (auto i = 0; i < opts.repetitions; i++) {
+    ns_per_iter.push_back(RunTimed(entry.func, num_iters) * 1e9 / num_iters);
+  }
+  sort(ns_per_iter.begin(), ns_per_iter.end());
+
+  BenchResult res;
+  res.name = entry.name;
+  res.iterations = num_iters;
+  res.median_ns = ns_per_iter[ns_per_iter.size() / 2U];
+  res.min_ns = ns_per_iter.front();
+  res.max_ns = ns_per_iter.back();
+  return res;
+}
+
+static void WriteJson(const string& path, const vector<BenchResult>& results) {
+  ofstream out(path);
+  if (!out) {
+    throw runtime_error("Can't open file " + path);
+  }
+
+  out << "{\n  \"context\": {\"num_cpus\": "
+      << thread::hardware_concurrency() << "},\n  \"benchmarks\": [";
+  for (auto i = 0U; i < results.size(); i++) {
+    auto const& res = results[i];
+    out << (i ? ",\n" : "\n") << "    {\"name\": \"" << res.name
+        << "\", \"iterations\": " << res.iterations
+        << ", \"median_ns\": " << res.median_ns
+        << ", \"min_ns\": " << res.min_ns << ", \"max_ns\": " << res.max_ns
+        << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+static void PrintUsage(const char* argv0) {
+  cout << "Usage: " << argv0
+       << " [--filter substring] [--json path] [--min_time seconds]"
+          " [--repetitions N]\n";
+}
+
+int main(int argc, char* argv[]) {
+  Options opts;
+  for (auto i = 1; i < argc; i++) {
+    auto const has_value = i + 1 < argc;
+    if (!strcmp(argv[i], "--filter") && has_value) {
+      opts.filter = argv[++i];
+    } else if (!strcmp(argv[i], "--json") && has_value) {
+      opts.json_path = argv[++i];
+    } else if (!strcmp(argv[i], "--min_time") && has_value) {
+      opts.min_time = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--repetitions") && has_value) {
+      opts.repetitions = max(1, atoi(argv[++i]));
+    } else {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  vector<BenchResult> results;
+  printf("%-48s %14s %14s %12s\n", "Benchmark", "median ns", "min ns",
+         "iterations");
+  for (auto& entry : Bench::Registry()) {
+    if (entry.name.find(opts.filter) == string::npos) {
+      continue;
+    }
+
+    try {
+      auto res = RunBench(entry, opts);
+      printf("%-48s %14.1f %14.1f %12zu\n", res.name.c_str(), res.median_ns,
+             res.min_ns, res.iterations);
+      results.push_back(res);
+    } catch (exception& e) {
+      printf("%-48s skipped: %s\n", entry.name.c_str(), e.what());
+    }
+  }
+
+  if (!opts.json_path.empty()) {
+    WriteJson(opts.json_path, results);
+  }
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tc_core_export.h" // generated by CMake
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VPF {
+
+/* Queue of ids of finished jobs with pollable file descriptor;
+ * Worker threads push ids, event loop thread waits for descriptor to become
+ * readable and pops all ids at once. Descriptor is readable as long as queue
+ * isn't empty, so burst of completions wakes loop up once;
+ *
+ * Descriptor is eventfd on Linux and pipe on other POSIX systems;
+ */
+class TC_CORE_EXPORT CompletionQueue {
+public:
+  CompletionQueue(const CompletionQueue& other) = delete;
+  CompletionQueue& operator=(const CompletionQueue& other) = delete;
+
+  /* Throws std::runtime_error if descriptor can't be created or platform
+   * has no pollable descriptors;
+   */
+  CompletionQueue();
+  ~CompletionQueue();
+
+  /* Returns descriptor which is readable while queue isn't empty;
+   * Don't read from it, use Pop;
+   */
+  int GetFd() const;
+
+  /* Adds id to queue; May be called from any thread;
+   */
+  void Push(uint64_t id);
+
+  /* Moves all queued ids to given vector and clears descriptor;
+   * Returns number of ids;
+   */
+  size_t Pop(std::vector<uint64_t>& ids);
+
+private:
+  struct CompletionQueue_Impl* pImpl = nullptr;
+};
+} // namespace VPF
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Numa.hpp"
+#include "tc_core_export.h" // generated by CMake
+#include <cstddef>
+#include <cstdint>
+
+namespace VPF {
+
+/* Process-wide pool of host memory blocks;
+ * Requested sizes are rounded up to size classes which are 1.25x apart, so
+ * frames of same resolution share blocks and freed blocks are reused
+ * instead of being returned to system allocator;
+ * Every thread keeps small cache of free blocks, the rest is kept in global
+ * depot; Total amount of cached memory is limited by high-water mark;
+ * Blocks may be placed on particular NUMA node, such blocks are cached
+ * separately and reused for allocations on same node only;
+ */
+class TC_CORE_EXPORT HostMemPool {
+public:
+  HostMemPool(const HostMemPool& other) = delete;
+  HostMemPool& operator=(const HostMemPool& other) = delete;
+
+  struct Stats {
+    /* Bytes given to users and not freed yet;
+     */
+    size_t bytes_in_use = 0U;
+
+    /* Bytes kept in free blocks;
+     */
+    size_t bytes_cached = 0U;
+
+    /* Max amount of bytes to keep in free blocks;
+     */
+    size_t high_water_mark = 0U;
+
+    /* Allocations served from cache and from system allocator;
+     */
+    uint64_t hits = 0U;
+    uint64_t misses = 0U;
+
+    double HitRate() const {
+      return (hits + misses) ? double(hits) / double(hits + misses) : 0.0;
+    }
+  };
+
+  static HostMemPool& Instance();
+
+  /* Returns block of at least RoundUp(size, node) bytes or nullptr;
+   * Blocks are 64 byte aligned, see SetHugePageThreshold for exception;
+   * Blocks for given NUMA node are page aligned and take whole pages, which
+   * are placed on that node; Placement is a hint that kernel may ignore;
+   */
+  void* Allocate(size_t size, int node = Numa::ANY_NODE);
+
+  /* Returns block to pool; Size and node must be same as passed to Allocate;
+   */
+  void Free(void* ptr, size_t size, int node = Numa::ANY_NODE);
+
+  /* Returns size class capacity for given size and NUMA node;
+   * It's idempotent, RoundUp(RoundUp(size)) == RoundUp(size); Capacity of
+   * node bound blocks is rounded up to whole pages;
+   */
+  static size_t RoundUp(size_t size, int node = Numa::ANY_NODE);
+
+  /* Sets max amount of cached bytes; Excess is released immediately;
+   */
+  void SetHighWaterMark(size_t bytes);
+
+  /* Opts in for huge pages; New blocks of given size and bigger are aligned
+   * to 2 MB boundary and marked with MADV_HUGEPAGE hint; Values below 2 MB
+   * are raised to 2 MB; 0 turns huge pages off, that's the default;
+   */
+  void SetHugePageThreshold(size_t bytes);
+
+  /* Releases all cached blocks to system allocator;
+   */
+  void Trim();
+
+  Stats GetStats() const;
+
+private:
+  HostMemPool();
+  ~HostMemPool();
+
+  struct HostMemPool_Impl* pImpl = nullptr;
+};
+} // namespace VPF
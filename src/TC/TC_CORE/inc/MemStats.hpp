@@ -0,0 +1,110 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tc_core_export.h" // generated by CMake
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace VPF {
+
+/* Process-wide accounting of memory held by VALI components;
+ * Allocation points report allocations and frees, so when process grows
+ * live bytes show which component holds memory; Counters are updated
+ * without locks, values read while other threads allocate are approximate;
+ */
+class TC_CORE_EXPORT MemStats {
+public:
+  MemStats(const MemStats& other) = delete;
+  MemStats& operator=(const MemStats& other) = delete;
+
+  enum Component {
+    /* Demuxed packets waiting for decoder;
+     */
+    PACKET_QUEUE,
+
+    /* Frames of software decoders, reference frames included;
+     */
+    DECODER_FRAMES,
+
+    /* Buffers which own their memory;
+     */
+    BUFFERS,
+
+    /* Side data kept in decoder history;
+     */
+    SIDE_DATA,
+
+    /* Encoded packets not yet returned to user;
+     */
+    ENCODER_OUTPUT,
+
+    /* libswscale contexts; libswscale doesn't tell their size, so only
+     * number of contexts is known;
+     */
+    SWSCALE,
+
+    /* Other frames taken from HostMemPool;
+     */
+    HOST_FRAMES,
+
+    NUM_COMPONENTS
+  };
+
+  struct Counter {
+    size_t live_bytes = 0U;
+    uint64_t live_allocs = 0U;
+
+    /* Max of live bytes since last ResetPeaks();
+     */
+    size_t peak_bytes = 0U;
+
+    /* Number of allocations since process start;
+     */
+    uint64_t total_allocs = 0U;
+  };
+
+  static MemStats& Instance();
+
+  /* Returns lowercase component name, e. g. "packet_queue";
+   */
+  static const char* GetName(Component component);
+
+  void OnAlloc(Component component, size_t bytes);
+  void OnFree(Component component, size_t bytes);
+
+  Counter Get(Component component) const;
+
+  /* Sets peaks to current live bytes, so growth after this point shows up
+   * as peak above live value;
+   */
+  void ResetPeaks();
+
+  /* Returns one line summary of all components and HostMemPool cache;
+   */
+  std::string Summary() const;
+
+  /* Writes summary to stderr every interval; Zero interval stops logging;
+   */
+  void SetLogInterval(std::chrono::milliseconds interval);
+
+private:
+  MemStats();
+  ~MemStats();
+
+  struct MemStats_Impl* pImpl = nullptr;
+};
+} // namespace VPF
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tc_core_export.h" // generated by CMake
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace VPF {
+
+/* NUMA topology queries and memory placement;
+ * Implemented on Linux via sysfs and mbind syscall, elsewhere system is
+ * reported as single node and placement requests are ignored;
+ */
+class TC_CORE_EXPORT Numa {
+public:
+  /* Node value which means no placement preference;
+   */
+  static constexpr int ANY_NODE = -1;
+
+  /* Returns number of NUMA nodes, at least 1;
+   */
+  static int NumNodes();
+
+  /* Returns CPUs which belong to given node, empty list if node is unknown;
+   */
+  static std::vector<int> NodeCpus(int node);
+
+  /* Returns node which owns given CPU, ANY_NODE if it's unknown;
+   */
+  static int CpuNode(int cpu);
+
+  /* Returns nodes in round-robin order, handy to spread multiple decoders
+   * evenly across sockets;
+   */
+  static int NextNode();
+
+  /* Parses CPU list in Linux format, e.g. "0-3,8,10-11";
+   * Throws std::invalid_argument if list is malformed;
+   */
+  static std::vector<int> ParseCpuList(const std::string& list);
+
+  /* Asks kernel to place pages of memory range on given node;
+   * Only whole pages inside the range are affected; Pages which are already
+   * touched are migrated; Returns false if placement isn't possible;
+   */
+  static bool Bind(void* ptr, size_t size, int node);
+};
+
+/* Pins calling thread to given CPUs and restores previous affinity in
+ * destructor; Threads created meanwhile inherit the affinity; Empty CPU list
+ * leaves affinity untouched; If thread is already pinned to given CPUs,
+ * affinity isn't set and isn't restored;
+ */
+class TC_CORE_EXPORT ScopedThreadAffinity {
+public:
+  explicit ScopedThreadAffinity(const std::vector<int>& cpus);
+  ~ScopedThreadAffinity();
+
+  ScopedThreadAffinity(const ScopedThreadAffinity& other) = delete;
+  ScopedThreadAffinity& operator=(const ScopedThreadAffinity& other) = delete;
+
+  /* Returns true if thread was pinned;
+   */
+  bool Pinned() const { return m_pinned; }
+
+private:
+  std::vector<int> m_prev_cpus;
+  bool m_pinned = false;
+  bool m_changed = false;
+};
+} // namespace VPF
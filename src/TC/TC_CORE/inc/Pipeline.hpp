@@ -0,0 +1,111 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "TC_CORE.hpp"
+#include "tc_core_export.h" // generated by CMake
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace VPF {
+
+/* Token handed out by pipeline; It goes back to pool of stage which made
+ * it when last reference is gone;
+ */
+using PipelineToken = std::shared_ptr<Token>;
+
+/* Dataflow graph of processing stages;
+ * Stages are DAG nodes, every stage runs on its own thread. Stage takes one
+ * token from every upstream stage, fills token taken from its own pool and
+ * sends it to all downstream stages through bounded queues. Stage pool size
+ * limits number of its tokens in flight, so slow stages throttle fast ones
+ * and memory use is bounded. Stages without downstream stages are sinks,
+ * their tokens are taken by Pull();
+ */
+class TC_CORE_EXPORT Pipeline {
+public:
+  /* Stage body; Gets tokens from upstream stages in order they were given
+   * to AddStage(), source stages get none;
+   * Returned details decide what happens to dst token:
+   * END_OF_STREAM info finishes the stage and all stages downstream;
+   * MORE_DATA_NEEDED info drops dst token;
+   * Success sends dst token downstream;
+   * Any other failure stops the pipeline, so does exception;
+   */
+  using StageFunc = std::function<TaskExecDetails(
+      const std::vector<Token*>& srcs, Token& dst)>;
+
+  /* Makes new token for stage pool; Called on stage thread;
+   */
+  using TokenFactory = std::function<Token*()>;
+
+  Pipeline();
+  Pipeline(const Pipeline& other) = delete;
+  Pipeline& operator=(const Pipeline& other) = delete;
+
+  /* Stops the pipeline; Tokens which are still referenced outside stay
+   * valid;
+   */
+  ~Pipeline();
+
+  /* Adds stage and returns its index;
+   * Inputs are indices of upstream stages, so there are no cycles;
+   * Throws std::invalid_argument if input index is out of range or pool
+   * size is zero, std::logic_error if pipeline is started;
+   */
+  size_t AddStage(const std::string& name, const std::vector<size_t>& inputs,
+                  StageFunc func, TokenFactory factory, size_t pool_size);
+
+  /* Adds task as stage;
+   * Upstream tokens become task inputs starting from 0, dst token is next
+   * input, extra tokens are set after it; Pipeline doesn't own the task;
+   */
+  size_t AddTask(Task& task, const std::vector<size_t>& inputs,
+                 TokenFactory factory, size_t pool_size,
+                 const std::vector<Token*>& extra = {});
+
+  /* Starts stage threads;
+   * Throws std::logic_error if pipeline was started before or is empty;
+   */
+  void Start();
+
+  /* Stops stage threads and drops queued tokens; Pending Pull() calls
+   * return END_OF_STREAM;
+   */
+  void Stop();
+
+  /* Waits for next token of sink stage;
+   * Returns END_OF_STREAM info when all tokens are taken, failure details
+   * of stage which stopped the pipeline or MORE_DATA_NEEDED info on
+   * timeout; Negative timeout means infinite wait;
+   * Throws std::invalid_argument if stage isn't a sink, std::logic_error if
+   * pipeline isn't started;
+   */
+  TaskExecDetails Pull(size_t stage, PipelineToken& token, int timeout_ms = -1);
+
+  size_t NumStages() const;
+
+  const std::string& GetStageName(size_t stage) const;
+
+  /* Returns true if stage has no downstream stages;
+   */
+  bool IsSink(size_t stage) const;
+
+private:
+  struct Pipeline_Impl* pImpl = nullptr;
+};
+} // namespace VPF
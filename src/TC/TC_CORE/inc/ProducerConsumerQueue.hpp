@@ -0,0 +1,138 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <string>
+
+namespace VPF {
+
+/* Bounded queue, producer waits for free space with timeout and consumer
+ * never waits; Decoder passes demuxed packets through it;
+ */
+template <typename T> class ProducerConsumerQueue {
+private:
+  std::queue<T> m_queue;
+  std::mutex m_mutex;
+  std::condition_variable m_cv_prod;
+  size_t m_capacity;
+  std::atomic<bool> m_closed = {false};
+  uint32_t m_timeout = 3000U;
+
+  // Max number of items queue ever had, guarded by m_mutex.
+  size_t m_max_size = 0U;
+
+  /* Not thread safe, to be used with m_mutex locked.
+   */
+  bool full() const { return m_queue.size() == m_capacity; }
+  bool empty() const { return m_queue.empty(); }
+
+public:
+  enum class Status { Success = 0, Closed = 1, Empty = 2, Full = 3 };
+
+  static std::string toString(Status status) {
+    switch (status) {
+    case Status::Success:
+      return "Success";
+    case Status::Closed:
+      return "Closed";
+    case Status::Empty:
+      return "Empty";
+    case Status::Full:
+      return "Full";
+    default:
+      return "Unknow";
+    }
+  }
+
+  ProducerConsumerQueue(size_t capacity) : m_capacity(capacity) {}
+
+  unsigned int timeout_ms() const { return m_timeout; }
+
+  void close() { m_closed = true; }
+
+  void open() { m_closed = false; }
+
+  bool closed() const { return m_closed; }
+
+  Status push(const T& item) {
+    if (closed()) {
+      return Status::Closed;
+    }
+    std::unique_lock lock{m_mutex};
+    if (!m_cv_prod.wait_for(lock, std::chrono::milliseconds(m_timeout),
+                            [this] { return !full(); })) {
+      return Status::Full;
+    }
+    m_queue.push(item);
+    m_max_size = std::max(m_max_size, m_queue.size());
+    return Status::Success;
+  }
+
+  Status pop(T& item) {
+    if (closed()) {
+      return Status::Closed;
+    }
+    std::unique_lock lock{m_mutex};
+    if (empty()) {
+      return Status::Empty;
+    }
+    item = m_queue.front();
+    m_queue.pop();
+    m_cv_prod.notify_one();
+
+    return Status::Success;
+  }
+
+  Status pop() {
+    if (closed()) {
+      return Status::Closed;
+    }
+    std::unique_lock lock{m_mutex};
+    if (empty()) {
+      return Status::Empty;
+    }
+    m_queue.pop();
+    m_cv_prod.notify_one();
+
+    return Status::Success;
+  }
+
+  Status peek(T& item) {
+    if (closed()) {
+      return Status::Closed;
+    }
+    std::unique_lock lock{m_mutex};
+    if (empty()) {
+      return Status::Empty;
+    }
+    item = m_queue.front();
+    return Status::Success;
+  }
+
+  size_t capacity() const { return m_capacity; }
+
+  void occupancy(size_t& size, size_t& max_size) {
+    std::unique_lock lock{m_mutex};
+    size = m_queue.size();
+    max_size = m_max_size;
+  }
+};
+} // namespace VPF
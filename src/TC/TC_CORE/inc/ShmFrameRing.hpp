@@ -0,0 +1,101 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tc_core_export.h" // generated by CMake
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace VPF {
+
+/* Frame description stored in every ring slot along with frame data;
+ * Plain data, it's shared between processes;
+ */
+struct ShmFrameInfo {
+  uint64_t size = 0U;
+  uint32_t width = 0U;
+  uint32_t height = 0U;
+  int32_t format = 0;
+  int32_t key = 0;
+  int64_t pts = 0;
+  int64_t dts = 0;
+  int64_t pos = 0;
+  int64_t bsl = 0;
+  int64_t duration = 0;
+};
+
+/* Ring of fixed size frame slots in POSIX shared memory;
+ * One process creates the ring, others attach to it by name. Slots are
+ * handed out in FIFO order, slot state is changed with atomic operations, so
+ * there are no locks shared between processes. Any number of producers and
+ * consumers is supported, every frame is received by single consumer;
+ * Not supported on Windows, Create() and Attach() throw there;
+ */
+class TC_CORE_EXPORT ShmFrameRing {
+public:
+  /* Creates shared memory object and ring in it;
+   * Object is unlinked when creator's ring is destroyed;
+   * Throws std::runtime_error if name is taken or memory can't be mapped;
+   */
+  static ShmFrameRing* Create(const std::string& name, uint32_t num_slots,
+                              size_t slot_size);
+
+  /* Attaches to ring created by other process;
+   * Throws std::runtime_error if there's no ring with such name;
+   */
+  static ShmFrameRing* Attach(const std::string& name);
+
+  ~ShmFrameRing();
+  ShmFrameRing(const ShmFrameRing& other) = delete;
+  ShmFrameRing& operator=(const ShmFrameRing& other) = delete;
+
+  const std::string& Name() const;
+  uint32_t NumSlots() const;
+
+  /* Returns slot capacity in bytes;
+   */
+  size_t SlotSize() const;
+
+  /* Returns pointer to slot data, page aligned;
+   */
+  void* SlotData(int slot);
+
+  /* Producer side: waits for free slot and returns its index;
+   * Negative timeout means infinite wait; Returns -1 on timeout;
+   */
+  int AcquireWrite(int timeout_ms);
+
+  /* Producer side: makes slot available to consumers;
+   */
+  void Publish(int slot, const ShmFrameInfo& info);
+
+  /* Producer side: gives slot back without publishing a frame;
+   */
+  void Abort(int slot);
+
+  /* Consumer side: waits for next published frame and returns its slot
+   * index; Negative timeout means infinite wait; Returns -1 on timeout;
+   */
+  int AcquireRead(ShmFrameInfo& info, int timeout_ms);
+
+  /* Consumer side: gives slot back to producers;
+   */
+  void Release(int slot);
+
+private:
+  ShmFrameRing();
+  struct ShmFrameRing_Impl* pImpl = nullptr;
+};
+} // namespace VPF
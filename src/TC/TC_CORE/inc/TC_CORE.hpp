@@ -37,6 +37,8 @@ protected:
 
 enum class TaskExecStatus { TASK_EXEC_SUCCESS, TASK_EXEC_FAIL };
 
+/* TaskStats::NUM_INFOS must be updated along with this enum;
+ */
 enum class TaskExecInfo {
   SUCCESS,
   FAIL,
@@ -86,6 +88,7 @@ public:
   virtual TaskExecDetails Run();
 
   /* Call this method to run the task;
+   * Calls are recorded by TaskStats under task name;
    */
   virtual TaskExecDetails Execute();
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "TC_CORE.hpp"
+#include "tc_core_export.h" // generated by CMake
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace VPF {
+
+/* Process-wide call statistics of tasks;
+ * Every counter keeps number of calls, number of calls by returned info and
+ * latency histogram. Every thread updates its own shard without locks,
+ * shards are merged on read;
+ */
+class TC_CORE_EXPORT TaskStats {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /* Latency histogram buckets are log-linear: every power of 2 nanoseconds
+   * range is split into 8 buckets, so bucket width is within 12.5% of its
+   * value; Last bucket takes everything longer than ~17 minutes;
+   */
+  static constexpr unsigned SUB_BUCKET_BITS = 3U;
+  static constexpr size_t NUM_BUCKETS = 38U << SUB_BUCKET_BITS;
+
+  /* Number of TaskExecInfo values, update along with the enum;
+   */
+  static constexpr size_t NUM_INFOS =
+      (size_t)TaskExecInfo::SRC_DST_FMT_MISMATCH + 1U;
+
+  struct Counter {
+    std::string name;
+    uint64_t calls = 0U;
+
+    /* Calls which returned TASK_EXEC_FAIL status;
+     */
+    uint64_t failures = 0U;
+
+    /* Calls by returned info, indexed by TaskExecInfo value;
+     */
+    std::vector<uint64_t> infos = std::vector<uint64_t>(NUM_INFOS, 0U);
+
+    uint64_t total_ns = 0U;
+
+    /* Longest call since last reset, unlike quantiles it's exact;
+     */
+    uint64_t max_ns = 0U;
+
+    std::vector<uint64_t> histogram = std::vector<uint64_t>(NUM_BUCKETS, 0U);
+
+    double MeanNs() const { return calls ? double(total_ns) / calls : 0.0; }
+
+    /* Returns latency quantile estimate, q is from 0.0 to 1.0;
+     * Quantile is interpolated within histogram bucket and doesn't exceed
+     * max_ns;
+     */
+    double QuantileNs(double q) const;
+  };
+
+  static TaskStats& Instance();
+
+  /* Returns id of named counter, makes counter if there's none;
+   * Ids are stable, callers are supposed to keep them;
+   */
+  size_t GetCounterId(const std::string& name);
+
+  /* Records call which started at given time;
+   */
+  void Record(size_t id, Clock::time_point start,
+              const TaskExecDetails& details);
+
+  /* Calls func and records it;
+   */
+  template <typename Func> TaskExecDetails Measure(size_t id, Func func) {
+    auto const start = Clock::now();
+    auto details = func();
+    Record(id, start, details);
+    return details;
+  }
+
+  /* Returns counters which were called since last Reset();
+   */
+  std::vector<Counter> GetCounters() const;
+
+  /* Sets all counters to zero, max latency included;
+   */
+  void Reset();
+
+  /* Returns histogram bucket for given latency and bucket lower bound;
+   */
+  static size_t BucketIndex(uint64_t ns);
+  static uint64_t BucketLowerBound(size_t idx);
+
+private:
+  TaskStats();
+  ~TaskStats();
+  TaskStats(const TaskStats& other) = delete;
+  TaskStats& operator=(const TaskStats& other) = delete;
+
+  struct TaskStats_Impl* pImpl = nullptr;
+};
+} // namespace VPF
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tc_core_export.h" // generated by CMake
+#include <cstddef>
+#include <functional>
+
+namespace VPF {
+
+/* Fixed size pool of worker threads;
+ * Every job is given index of worker which runs it, so callers may keep
+ * per-worker state (converters, scratch buffers) without locking;
+ */
+class TC_CORE_EXPORT ThreadPool {
+public:
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+
+  /* Creates pool with given number of threads;
+   * Zero means number of hardware threads;
+   */
+  explicit ThreadPool(size_t num_threads = 0U);
+
+  /* Waits for queued jobs to finish and joins threads;
+   */
+  ~ThreadPool();
+
+  /* Returns number of worker threads;
+   */
+  size_t NumThreads() const;
+
+  /* Enqueues job; It's called with index of worker thread;
+   */
+  void Submit(std::function<void(size_t worker)> job);
+
+  /* Calls func(idx, worker) for every idx in [0, count) on worker threads
+   * and blocks until all calls are done; First exception thrown by func is
+   * rethrown in calling thread; Must not be called from pool thread;
+   */
+  void ParallelFor(size_t count,
+                   const std::function<void(size_t idx, size_t worker)>& func);
+
+  /* Process-wide pool sized to number of hardware threads;
+   */
+  static ThreadPool& Shared();
+
+private:
+  struct ThreadPool_Impl* pImpl = nullptr;
+};
+} // namespace VPF
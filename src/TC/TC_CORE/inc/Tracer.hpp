@@ -0,0 +1,83 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tc_core_export.h" // generated by CMake
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace VPF {
+
+/* Where trace ranges go;
+ * NVTX has effect only if library is built with USE_NVTX;
+ * CHROME keeps ranges in memory until they are dumped in Chrome trace
+ * format which is also read by Perfetto UI;
+ */
+enum class TraceBackend { OFF = 0, NVTX, CHROME };
+
+/* Process-wide trace ranges recorder;
+ * Ranges are kept in ring buffer, so capture holds last ranges only.
+ * Writers don't take locks, every ring slot is guarded by sequence number,
+ * so dump skips slots which are being overwritten;
+ */
+class TC_CORE_EXPORT Tracer {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /* Longer range names are truncated;
+   */
+  static constexpr size_t MAX_NAME_LEN = 47U;
+  static constexpr size_t DEFAULT_CAPACITY = 1U << 18;
+
+  static Tracer& Instance();
+
+  /* Selecting CHROME backend starts new capture with given ring capacity;
+   * Ring is reused if capacity is same; Otherwise ring is replaced and old
+   * one is freed by this or next SetBackend or Dump call, once no thread
+   * is recording to it;
+   */
+  void SetBackend(TraceBackend backend, size_t capacity = DEFAULT_CAPACITY);
+
+  TraceBackend GetBackend() const {
+    return m_backend.load(std::memory_order_relaxed);
+  }
+
+  /* Records range which started at given time and ends now;
+   * Range gets id and tag of calling thread;
+   */
+  void Record(const char* name, Clock::time_point start);
+
+  /* Sets tag of ranges recorded by calling thread, e. g. stream name;
+   * Empty tag means no tag;
+   */
+  void SetThreadTag(const std::string& tag);
+
+  /* Writes ranges of current capture as Chrome trace JSON;
+   * Returns number of ranges written;
+   */
+  size_t Dump(std::ostream& out) const;
+
+private:
+  Tracer();
+  ~Tracer();
+  Tracer(const Tracer& other) = delete;
+  Tracer& operator=(const Tracer& other) = delete;
+
+  std::atomic<TraceBackend> m_backend;
+  struct Tracer_Impl* pImpl = nullptr;
+};
+} // namespace VPF
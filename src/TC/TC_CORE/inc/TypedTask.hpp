@@ -0,0 +1,65 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "TC_CORE.hpp"
+#include "TaskStats.hpp"
+
+namespace VPF {
+
+/* Task with compile-time typed ports;
+ * Unlike Task, ports aren't stored as Token pointers, they are passed to
+ * Execute() as arguments of given types. So there's nothing to cast and
+ * nothing to allocate per call; Inherit from this class and override Run;
+ *
+ * Example: TypedTask<const Buffer&, Buffer&> takes src and dst buffers;
+ */
+template <typename... Ports> class TypedTask {
+public:
+  TypedTask() = delete;
+  TypedTask(const TypedTask& other) = delete;
+  TypedTask& operator=(const TypedTask& other) = delete;
+
+  virtual ~TypedTask() = default;
+
+  /* Call this method to run the task;
+   * Calls are recorded by TaskStats under task name, same as Task::Execute;
+   */
+  TaskExecDetails Execute(Ports... ports) {
+    auto const start = TaskStats::Clock::now();
+    auto ret = Run(ports...);
+    TaskStats::Instance().Record(m_stats_id, start, ret);
+    return ret;
+  }
+
+  /* Returns task name;
+   */
+  const char* GetName() const { return m_name; }
+
+protected:
+  /* Name must be string literal, it isn't copied;
+   */
+  explicit TypedTask(const char* str_name)
+      : m_name(str_name),
+        m_stats_id(TaskStats::Instance().GetCounterId(str_name)) {}
+
+  /* Method to be overridden in ancestors;
+   */
+  virtual TaskExecDetails Run(Ports... ports) = 0;
+
+private:
+  const char* m_name;
+  size_t m_stats_id;
+};
+} // namespace VPF
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "CompletionQueue.hpp"
+
+using namespace std;
+using namespace VPF;
+
+namespace VPF {
+struct CompletionQueue_Impl {
+  // Descriptor loop polls and descriptor workers write to, same for eventfd;
+  int m_read_fd = -1;
+  int m_write_fd = -1;
+
+  mutex m_mutex;
+  vector<uint64_t> m_ids;
+
+  /* Both called with mutex held, so descriptor is signaled if and only if
+   * there are ids in queue;
+   */
+  void Signal() {
+#if defined(__linux__)
+    uint64_t val = 1U;
+    while (write(m_write_fd, &val, sizeof(val)) < 0 && EINTR == errno) {
+    }
+#elif !defined(_WIN32)
+    char val = 1;
+    while (write(m_write_fd, &val, sizeof(val)) < 0 && EINTR == errno) {
+    }
+#endif
+  }
+
+  void Clear() {
+#if defined(__linux__)
+    uint64_t val = 0U;
+    while (read(m_read_fd, &val, sizeof(val)) < 0 && EINTR == errno) {
+    }
+#elif !defined(_WIN32)
+    char buf[64];
+    while (read(m_read_fd, buf, sizeof(buf)) > 0 || EINTR == errno) {
+    }
+#endif
+  }
+
+  ~CompletionQueue_Impl() {
+#if !defined(_WIN32)
+    if (m_read_fd >= 0) {
+      close(m_read_fd);
+    }
+    if (m_write_fd >= 0 && m_write_fd != m_read_fd) {
+      close(m_write_fd);
+    }
+#endif
+  }
+};
+} // namespace VPF
+
+CompletionQueue::CompletionQueue() : pImpl(new CompletionQueue_Impl()) {
+#if defined(_WIN32)
+  delete pImpl;
+  throw runtime_error("Completion queue isn't supported");
+#elif defined(__linux__)
+  auto fd = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (fd < 0) {
+    delete pImpl;
+    throw runtime_error(string("Failed to create eventfd: ") +
+                        strerror(errno));
+  }
+  pImpl->m_read_fd = fd;
+  pImpl->m_write_fd = fd;
+#else
+  int fds[2] = {-1, -1};
+  if (pipe(fds)) {
+    delete pImpl;
+    throw runtime_error(string("Failed to create pipe: ") + strerror(errno));
+  }
+  pImpl->m_read_fd = fds[0];
+  pImpl->m_write_fd = fds[1];
+
+  for (auto fd : fds) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+  }
+#endif
+}
+
+CompletionQueue::~CompletionQueue() { delete pImpl; }
+
+int CompletionQueue::GetFd() const { return pImpl->m_read_fd; }
+
+void CompletionQueue::Push(uint64_t id) {
+  lock_guard<mutex> lock(pImpl->m_mutex);
+  pImpl->m_ids.push_back(id);
+  if (1U == pImpl->m_ids.size()) {
+    pImpl->Signal();
+  }
+}
+
+size_t CompletionQueue::Pop(vector<uint64_t>& ids) {
+  ids.clear();
+  lock_guard<mutex> lock(pImpl->m_mutex);
+  if (!pImpl->m_ids.empty()) {
+    pImpl->Clear();
+    ids.swap(pImpl->m_ids);
+  }
+  return ids.size();
+}
@@ -0,0 +1,341 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "HostMemPool.hpp"
+
+using namespace std;
+using namespace VPF;
+
+/* Cache line size, avoids false sharing and allows aligned vector loads;
+ */
+static constexpr size_t s_alignment = 64U;
+
+/* Smallest block which may be backed by huge pages;
+ */
+static constexpr size_t s_huge_page_size = 2U * 1024U * 1024U;
+
+/* Max number of free blocks of every size kept by single thread;
+ */
+static constexpr size_t s_thread_cache_depth = 4U;
+
+static constexpr size_t s_default_high_water_mark = 1024U * 1024U * 1024U;
+
+static size_t PageSize() {
+#if defined(_WIN32)
+  return 4096U;
+#else
+  static const auto page_size = (size_t)sysconf(_SC_PAGESIZE);
+  return page_size;
+#endif
+}
+
+/* Huge page threshold of 0 means huge pages are off; Block size is kept as
+ * is, only its alignment changes; Blocks placed on NUMA node are page
+ * aligned, mbind only acts on whole pages;
+ */
+static void* SysAlloc(size_t size, int node, size_t huge_page_threshold) {
+  const auto use_huge_pages =
+      huge_page_threshold && size >= huge_page_threshold;
+  auto alignment = use_huge_pages ? s_huge_page_size : s_alignment;
+  if (node != Numa::ANY_NODE) {
+    alignment = max(alignment, PageSize());
+  }
+
+#if defined(_WIN32)
+  return _aligned_malloc(size, alignment);
+#else
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, alignment, size)) {
+    return nullptr;
+  }
+#if defined(MADV_HUGEPAGE)
+  if (use_huge_pages) {
+    // Just a hint, transparent huge pages may be disabled;
+    madvise(ptr, size, MADV_HUGEPAGE);
+  }
+#endif
+  return ptr;
+#endif
+}
+
+static void SysFree(void* ptr) {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+namespace VPF {
+/* Free blocks are looked up by size class and NUMA node;
+ */
+using BlockKey = pair<size_t, int>;
+using FreeLists = map<BlockKey, vector<void*>>;
+
+struct ThreadCache;
+
+struct HostMemPool_Impl {
+  /* Lock order is pool lock first, thread cache lock second;
+   */
+  mutex m_lock;
+  FreeLists m_depot;
+  set<ThreadCache*> m_caches;
+
+  atomic<size_t> m_in_use = 0U;
+  atomic<size_t> m_cached = 0U;
+  atomic<size_t> m_high_water_mark = s_default_high_water_mark;
+  atomic<size_t> m_huge_page_threshold = 0U;
+  atomic<uint64_t> m_hits = 0U;
+  atomic<uint64_t> m_misses = 0U;
+
+  /* Accounts block as cached if it fits under high-water mark;
+   */
+  bool TryCache(size_t size) {
+    auto cached = m_cached.load();
+    do {
+      if (cached + size > m_high_water_mark.load()) {
+        return false;
+      }
+    } while (!m_cached.compare_exchange_weak(cached, cached + size));
+    return true;
+  }
+
+  /* Takes block out of free lists if there's one;
+   */
+  void* Take(FreeLists& lists, const BlockKey& key) {
+    auto it = lists.find(key);
+    if (it == lists.end() || it->second.empty()) {
+      return nullptr;
+    }
+
+    auto ptr = it->second.back();
+    it->second.pop_back();
+    m_cached -= key.first;
+    return ptr;
+  }
+
+  /* Releases blocks until cached amount fits into limit;
+   */
+  void Shrink(vector<void*>& blocks, size_t size, size_t limit) {
+    while (!blocks.empty() && m_cached.load() > limit) {
+      SysFree(blocks.back());
+      blocks.pop_back();
+      m_cached -= size;
+    }
+  }
+
+  void ShrinkTo(size_t limit);
+};
+
+struct ThreadCache {
+  mutex m_lock;
+  FreeLists m_lists;
+  HostMemPool_Impl* m_pool;
+
+  explicit ThreadCache(HostMemPool_Impl* pool) : m_pool(pool) {
+    lock_guard<mutex> pool_lock(m_pool->m_lock);
+    m_pool->m_caches.insert(this);
+  }
+
+  /* Thread exits, its blocks are moved to depot;
+   */
+  ~ThreadCache() {
+    lock_guard<mutex> pool_lock(m_pool->m_lock);
+    lock_guard<mutex> lock(m_lock);
+    for (auto& list : m_lists) {
+      auto& depot = m_pool->m_depot[list.first];
+      depot.insert(depot.end(), list.second.begin(), list.second.end());
+    }
+    m_pool->m_caches.erase(this);
+  }
+};
+
+void HostMemPool_Impl::ShrinkTo(size_t limit) {
+  lock_guard<mutex> pool_lock(m_lock);
+
+  vector<unique_lock<mutex>> locks;
+  vector<FreeLists*> all_lists = {&m_depot};
+  for (auto cache : m_caches) {
+    locks.emplace_back(cache->m_lock);
+    all_lists.push_back(&cache->m_lists);
+  }
+
+  // Biggest blocks are released first, wherever they are cached;
+  set<BlockKey, greater<BlockKey>> keys;
+  for (auto lists : all_lists) {
+    for (auto& list : *lists) {
+      keys.insert(list.first);
+    }
+  }
+
+  for (auto& key : keys) {
+    for (auto lists : all_lists) {
+      auto it = lists->find(key);
+      if (it != lists->end()) {
+        Shrink(it->second, key.first, limit);
+      }
+    }
+  }
+}
+
+static ThreadCache& GetThreadCache(HostMemPool_Impl* pool) {
+  thread_local ThreadCache cache(pool);
+  return cache;
+}
+} // namespace VPF
+
+HostMemPool& HostMemPool::Instance() {
+  // Never destroyed, thread caches may outlive static objects;
+  static auto pool = new HostMemPool();
+  return *pool;
+}
+
+HostMemPool::HostMemPool() : pImpl(new HostMemPool_Impl()) {}
+
+HostMemPool::~HostMemPool() { delete pImpl; }
+
+size_t HostMemPool::RoundUp(size_t size, int node) {
+  if (node != Numa::ANY_NODE) {
+    // Pages of node bound blocks aren't shared with other blocks;
+    const auto page = PageSize();
+    return (RoundUp(size) + page - 1U) / page * page;
+  }
+
+  if (size <= s_alignment) {
+    return s_alignment;
+  }
+
+  /* Four size classes in (pow2, 2 * pow2] range; Range is picked by
+   * size - 1, so size class values map to themselves;
+   */
+  size_t pow2 = s_alignment;
+  while (pow2 * 2U < size) {
+    pow2 *= 2U;
+  }
+
+  const auto step = max(s_alignment, pow2 / 4U);
+  return (size + step - 1U) / step * step;
+}
+
+void* HostMemPool::Allocate(size_t size, int node) {
+  if (!size) {
+    return nullptr;
+  }
+
+  node = max(node, Numa::ANY_NODE);
+  size = RoundUp(size, node);
+  const BlockKey key(size, node);
+  void* ptr = nullptr;
+
+  auto& cache = GetThreadCache(pImpl);
+  {
+    lock_guard<mutex> lock(cache.m_lock);
+    ptr = pImpl->Take(cache.m_lists, key);
+  }
+
+  if (!ptr) {
+    lock_guard<mutex> lock(pImpl->m_lock);
+    ptr = pImpl->Take(pImpl->m_depot, key);
+  }
+
+  if (ptr) {
+    pImpl->m_hits++;
+  } else {
+    const size_t huge_page_threshold = pImpl->m_huge_page_threshold;
+    ptr = SysAlloc(size, node, huge_page_threshold);
+    if (!ptr) {
+      // Cached blocks of other sizes may be in the way;
+      Trim();
+      ptr = SysAlloc(size, node, huge_page_threshold);
+    }
+
+    if (!ptr) {
+      return nullptr;
+    }
+    pImpl->m_misses++;
+
+    if (node != Numa::ANY_NODE) {
+      Numa::Bind(ptr, size, node);
+    }
+  }
+
+  pImpl->m_in_use += size;
+  return ptr;
+}
+
+void HostMemPool::Free(void* ptr, size_t size, int node) {
+  if (!ptr) {
+    return;
+  }
+
+  node = max(node, Numa::ANY_NODE);
+  size = RoundUp(size, node);
+  const BlockKey key(size, node);
+  pImpl->m_in_use -= size;
+
+  if (!pImpl->TryCache(size)) {
+    SysFree(ptr);
+    return;
+  }
+
+  auto& cache = GetThreadCache(pImpl);
+  {
+    lock_guard<mutex> lock(cache.m_lock);
+    auto& blocks = cache.m_lists[key];
+    if (blocks.size() < s_thread_cache_depth) {
+      blocks.push_back(ptr);
+      return;
+    }
+  }
+
+  lock_guard<mutex> lock(pImpl->m_lock);
+  pImpl->m_depot[key].push_back(ptr);
+}
+
+void HostMemPool::SetHighWaterMark(size_t bytes) {
+  pImpl->m_high_water_mark = bytes;
+  pImpl->ShrinkTo(bytes);
+}
+
+void HostMemPool::SetHugePageThreshold(size_t bytes) {
+  pImpl->m_huge_page_threshold = bytes ? max(bytes, s_huge_page_size) : 0U;
+}
+
+void HostMemPool::Trim() { pImpl->ShrinkTo(0U); }
+
+HostMemPool::Stats HostMemPool::GetStats() const {
+  Stats stats;
+  stats.bytes_in_use = pImpl->m_in_use.load();
+  stats.bytes_cached = pImpl->m_cached.load();
+  stats.high_water_mark = pImpl->m_high_water_mark.load();
+  stats.hits = pImpl->m_hits.load();
+  stats.misses = pImpl->m_misses.load();
+  return stats;
+}
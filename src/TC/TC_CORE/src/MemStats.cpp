@@ -0,0 +1,163 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "HostMemPool.hpp"
+#include "MemStats.hpp"
+
+using namespace std;
+using namespace VPF;
+
+static const char* s_names[] = {"packet_queue",   "decoder_frames",
+                                "buffers",        "side_data",
+                                "encoder_output", "swscale",
+                                "host_frames"};
+
+static_assert(sizeof(s_names) / sizeof(s_names[0]) ==
+                  MemStats::NUM_COMPONENTS,
+              "Component names don't match enum");
+
+namespace VPF {
+struct MemRecord {
+  atomic<size_t> live_bytes = 0U;
+  atomic<uint64_t> live_allocs = 0U;
+  atomic<size_t> peak_bytes = 0U;
+  atomic<uint64_t> total_allocs = 0U;
+};
+
+struct MemStats_Impl {
+  array<MemRecord, MemStats::NUM_COMPONENTS> m_records;
+
+  /* Log thread state;
+   */
+  mutex m_lock;
+  condition_variable m_cv;
+  thread m_thread;
+  chrono::milliseconds m_interval{0};
+
+  void StopLog(unique_lock<mutex>& lock) {
+    if (!m_thread.joinable()) {
+      return;
+    }
+
+    m_interval = chrono::milliseconds(0);
+    m_cv.notify_all();
+    lock.unlock();
+    m_thread.join();
+    lock.lock();
+  }
+
+  void LogLoop(const MemStats& stats) {
+    unique_lock<mutex> lock(m_lock);
+    while (m_interval.count()) {
+      if (m_cv.wait_for(lock, m_interval,
+                        [this]() { return !m_interval.count(); })) {
+        return;
+      }
+      cerr << stats.Summary() << endl;
+    }
+  }
+};
+} // namespace VPF
+
+static string FormatBytes(size_t bytes) {
+  stringstream ss;
+  ss << fixed << setprecision(1) << bytes / (1024.0 * 1024.0) << " MB";
+  return ss.str();
+}
+
+MemStats& MemStats::Instance() {
+  // Never destroyed, allocations may be freed by static objects at exit;
+  static auto stats = new MemStats();
+  return *stats;
+}
+
+MemStats::MemStats() : pImpl(new MemStats_Impl()) {}
+
+MemStats::~MemStats() {
+  SetLogInterval(chrono::milliseconds(0));
+  delete pImpl;
+}
+
+const char* MemStats::GetName(Component component) {
+  return component < NUM_COMPONENTS ? s_names[component] : "unknown";
+}
+
+void MemStats::OnAlloc(Component component, size_t bytes) {
+  auto& record = pImpl->m_records[component];
+  record.live_allocs.fetch_add(1U, memory_order_relaxed);
+  record.total_allocs.fetch_add(1U, memory_order_relaxed);
+
+  auto const live =
+      record.live_bytes.fetch_add(bytes, memory_order_relaxed) + bytes;
+  auto peak = record.peak_bytes.load(memory_order_relaxed);
+  while (live > peak && !record.peak_bytes.compare_exchange_weak(
+                            peak, live, memory_order_relaxed)) {
+  }
+}
+
+void MemStats::OnFree(Component component, size_t bytes) {
+  auto& record = pImpl->m_records[component];
+  record.live_allocs.fetch_sub(1U, memory_order_relaxed);
+  record.live_bytes.fetch_sub(bytes, memory_order_relaxed);
+}
+
+MemStats::Counter MemStats::Get(Component component) const {
+  auto const& record = pImpl->m_records[component];
+  Counter counter;
+  counter.live_bytes = record.live_bytes.load(memory_order_relaxed);
+  counter.live_allocs = record.live_allocs.load(memory_order_relaxed);
+  counter.peak_bytes = record.peak_bytes.load(memory_order_relaxed);
+  counter.total_allocs = record.total_allocs.load(memory_order_relaxed);
+  return counter;
+}
+
+void MemStats::ResetPeaks() {
+  for (auto& record : pImpl->m_records) {
+    record.peak_bytes.store(record.live_bytes.load(memory_order_relaxed),
+                            memory_order_relaxed);
+  }
+}
+
+string MemStats::Summary() const {
+  stringstream ss;
+  ss << "VALI memory:";
+  for (auto i = 0; i < NUM_COMPONENTS; i++) {
+    auto const counter = Get((Component)i);
+    ss << " " << s_names[i] << " " << FormatBytes(counter.live_bytes) << " / "
+       << counter.live_allocs << ",";
+  }
+
+  auto const pool = HostMemPool::Instance().GetStats();
+  ss << " pool in use " << FormatBytes(pool.bytes_in_use) << ", pool cached "
+     << FormatBytes(pool.bytes_cached);
+  return ss.str();
+}
+
+void MemStats::SetLogInterval(chrono::milliseconds interval) {
+  unique_lock<mutex> lock(pImpl->m_lock);
+  pImpl->StopLog(lock);
+
+  if (interval.count() > 0) {
+    pImpl->m_interval = interval;
+    pImpl->m_thread = thread([this]() { pImpl->LogLoop(*this); });
+  }
+}
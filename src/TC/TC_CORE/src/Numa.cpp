@@ -0,0 +1,213 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Numa.hpp"
+
+using namespace std;
+using namespace VPF;
+
+#if defined(__linux__)
+/* Values from linux/mempolicy.h, it's not always installed;
+ */
+static constexpr int s_mpol_preferred = 1;
+static constexpr unsigned s_mpol_mf_move = 1U << 1;
+
+/* Max node number which fits into mbind node mask;
+ */
+static constexpr int s_max_nodes = 1024;
+
+static string ReadSysFile(const string& path) {
+  ifstream file(path);
+  string line;
+  getline(file, line);
+  return line;
+}
+#endif
+
+vector<int> Numa::ParseCpuList(const string& list) {
+  vector<int> cpus;
+  stringstream ss(list);
+  string range;
+
+  while (getline(ss, range, ',')) {
+    range.erase(remove_if(range.begin(), range.end(), ::isspace), range.end());
+    if (range.empty()) {
+      continue;
+    }
+
+    try {
+      size_t pos = 0U;
+      auto const first = stoi(range, &pos);
+      auto last = first;
+      if (pos < range.size()) {
+        if (range[pos] != '-') {
+          throw invalid_argument(range);
+        }
+        last = stoi(range.substr(pos + 1U));
+      }
+
+      if (first < 0 || last < first) {
+        throw invalid_argument(range);
+      }
+
+      for (auto cpu = first; cpu <= last; cpu++) {
+        cpus.push_back(cpu);
+      }
+    } catch (exception&) {
+      throw invalid_argument("Malformed CPU list: " + list);
+    }
+  }
+
+  sort(cpus.begin(), cpus.end());
+  cpus.erase(unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+int Numa::NumNodes() {
+#if defined(__linux__)
+  static const int num_nodes = []() {
+    try {
+      auto const nodes =
+          ParseCpuList(ReadSysFile("/sys/devices/system/node/online"));
+      return nodes.empty() ? 1 : nodes.back() + 1;
+    } catch (...) {
+      return 1;
+    }
+  }();
+  return num_nodes;
+#else
+  return 1;
+#endif
+}
+
+vector<int> Numa::NodeCpus(int node) {
+#if defined(__linux__)
+  if (node < 0 || node >= NumNodes()) {
+    return {};
+  }
+
+  try {
+    return ParseCpuList(ReadSysFile("/sys/devices/system/node/node" +
+                                    to_string(node) + "/cpulist"));
+  } catch (...) {
+    return {};
+  }
+#else
+  return {};
+#endif
+}
+
+int Numa::CpuNode(int cpu) {
+  for (auto node = 0; node < NumNodes(); node++) {
+    auto const cpus = NodeCpus(node);
+    if (binary_search(cpus.begin(), cpus.end(), cpu)) {
+      return node;
+    }
+  }
+  return ANY_NODE;
+}
+
+int Numa::NextNode() {
+  static atomic<unsigned> counter = 0U;
+  return (int)(counter++ % (unsigned)NumNodes());
+}
+
+bool Numa::Bind(void* ptr, size_t size, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  if (!ptr || node < 0 || node >= min(NumNodes(), s_max_nodes)) {
+    return false;
+  }
+
+  // Partially covered pages may be shared with other allocations;
+  auto const page = (uintptr_t)sysconf(_SC_PAGESIZE);
+  auto const begin = ((uintptr_t)ptr + page - 1U) / page * page;
+  auto const end = ((uintptr_t)ptr + size) / page * page;
+  if (begin >= end) {
+    return false;
+  }
+
+  constexpr auto bits = sizeof(unsigned long) * 8U;
+  unsigned long mask[s_max_nodes / bits] = {};
+  mask[node / bits] = 1UL << (node % bits);
+
+  return 0 == syscall(SYS_mbind, (void*)begin, end - begin, s_mpol_preferred,
+                      mask, (unsigned long)s_max_nodes, s_mpol_mf_move);
+#else
+  return false;
+#endif
+}
+
+ScopedThreadAffinity::ScopedThreadAffinity(const vector<int>& cpus) {
+#if defined(__linux__)
+  if (cpus.empty()) {
+    return;
+  }
+
+  cpu_set_t prev;
+  CPU_ZERO(&prev);
+  if (sched_getaffinity(0, sizeof(prev), &prev)) {
+    return;
+  }
+
+  cpu_set_t next;
+  CPU_ZERO(&next);
+  for (auto cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+      CPU_SET(cpu, &next);
+    }
+  }
+
+  if (CPU_EQUAL(&prev, &next)) {
+    m_pinned = true;
+    return;
+  }
+
+  for (auto cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &prev)) {
+      m_prev_cpus.push_back(cpu);
+    }
+  }
+
+  m_pinned = (0 == sched_setaffinity(0, sizeof(next), &next));
+  m_changed = m_pinned;
+#endif
+}
+
+ScopedThreadAffinity::~ScopedThreadAffinity() {
+#if defined(__linux__)
+  if (!m_changed) {
+    return;
+  }
+
+  cpu_set_t prev;
+  CPU_ZERO(&prev);
+  for (auto cpu : m_prev_cpus) {
+    CPU_SET(cpu, &prev);
+  }
+  sched_setaffinity(0, sizeof(prev), &prev);
+#endif
+}
@@ -0,0 +1,458 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "Pipeline.hpp"
+#include "Tracer.hpp"
+
+using namespace std;
+using namespace VPF;
+
+namespace VPF {
+enum class QueueStatus { OK, CLOSED, TIMEOUT };
+
+/* Bounded FIFO between two stages;
+ * Consumer gets queued tokens after queue is closed, producer doesn't;
+ */
+class TokenQueue {
+  mutex m_lock;
+  condition_variable m_cv;
+  deque<PipelineToken> m_tokens;
+  size_t m_capacity;
+  bool m_closed = false;
+
+public:
+  explicit TokenQueue(size_t capacity) : m_capacity(capacity) {}
+
+  bool Push(PipelineToken token) {
+    {
+      unique_lock<mutex> lock(m_lock);
+      m_cv.wait(lock,
+                [this]() { return m_closed || m_tokens.size() < m_capacity; });
+      if (m_closed) {
+        return false;
+      }
+      m_tokens.push_back(std::move(token));
+    }
+    m_cv.notify_all();
+    return true;
+  }
+
+  QueueStatus Pop(PipelineToken& token, int timeout_ms) {
+    {
+      unique_lock<mutex> lock(m_lock);
+      auto ready = [this]() { return m_closed || !m_tokens.empty(); };
+      if (timeout_ms < 0) {
+        m_cv.wait(lock, ready);
+      } else if (!m_cv.wait_for(lock, chrono::milliseconds(timeout_ms),
+                                ready)) {
+        return QueueStatus::TIMEOUT;
+      }
+
+      if (m_tokens.empty()) {
+        return QueueStatus::CLOSED;
+      }
+      token = std::move(m_tokens.front());
+      m_tokens.pop_front();
+    }
+    m_cv.notify_all();
+    return QueueStatus::OK;
+  }
+
+  void Close() {
+    {
+      unique_lock<mutex> lock(m_lock);
+      m_closed = true;
+    }
+    m_cv.notify_all();
+  }
+
+  /* Drops queued tokens, they go back to their pools;
+   */
+  void Clear() {
+    deque<PipelineToken> tokens;
+    {
+      unique_lock<mutex> lock(m_lock);
+      tokens.swap(m_tokens);
+    }
+    m_cv.notify_all();
+  }
+};
+
+/* Tokens made by single stage;
+ * Pool outlives the pipeline while any of its tokens is referenced;
+ */
+class TokenPool : public enable_shared_from_this<TokenPool> {
+  mutex m_lock;
+  condition_variable m_cv;
+  Pipeline::TokenFactory m_factory;
+  vector<unique_ptr<Token>> m_tokens;
+  vector<Token*> m_free;
+  size_t m_capacity;
+  bool m_closed = false;
+
+  void Release(Token* token) {
+    {
+      unique_lock<mutex> lock(m_lock);
+      m_free.push_back(token);
+    }
+    m_cv.notify_one();
+  }
+
+public:
+  TokenPool(Pipeline::TokenFactory factory, size_t capacity)
+      : m_factory(std::move(factory)), m_capacity(capacity) {}
+
+  size_t Capacity() const { return m_capacity; }
+
+  /* Waits for free token; Returns nullptr if pool is closed;
+   */
+  PipelineToken Acquire() {
+    unique_lock<mutex> lock(m_lock);
+    m_cv.wait(lock, [this]() {
+      return m_closed || !m_free.empty() || m_tokens.size() < m_capacity;
+    });
+    if (m_closed) {
+      return nullptr;
+    }
+
+    Token* token = nullptr;
+    if (m_free.empty()) {
+      token = m_factory();
+      if (!token) {
+        throw runtime_error("Token factory returned nullptr");
+      }
+      m_tokens.emplace_back(token);
+    } else {
+      token = m_free.back();
+      m_free.pop_back();
+    }
+
+    auto self = shared_from_this();
+    return PipelineToken(token, [self](Token* t) { self->Release(t); });
+  }
+
+  void Close() {
+    {
+      unique_lock<mutex> lock(m_lock);
+      m_closed = true;
+    }
+    m_cv.notify_all();
+  }
+};
+
+struct PipelineStage {
+  string m_name;
+  vector<size_t> m_inputs;
+  Pipeline::StageFunc m_func;
+  shared_ptr<TokenPool> m_pool;
+
+  /* Queues are made by Start(); Input queues match inputs, output queues
+   * are input queues of downstream stages or sink queue;
+   */
+  vector<shared_ptr<TokenQueue>> m_in_queues;
+  vector<shared_ptr<TokenQueue>> m_out_queues;
+  shared_ptr<TokenQueue> m_sink;
+
+  thread m_thread;
+};
+
+struct Pipeline_Impl {
+  vector<unique_ptr<PipelineStage>> m_stages;
+  bool m_started = false;
+  atomic<bool> m_stop = false;
+
+  mutex m_lock;
+  bool m_failed = false;
+  TaskExecDetails m_error;
+
+  PipelineStage& GetStage(size_t stage) {
+    if (stage >= m_stages.size()) {
+      throw invalid_argument("Invalid pipeline stage: " + to_string(stage));
+    }
+    return *m_stages[stage].get();
+  }
+
+  bool IsSink(size_t stage) {
+    GetStage(stage);
+    for (auto& other : m_stages) {
+      for (auto input : other->m_inputs) {
+        if (input == stage) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /* Wakes up all stages and drops queued tokens;
+   */
+  void Abort() {
+    m_stop = true;
+    for (auto& stage : m_stages) {
+      stage->m_pool->Close();
+      for (auto& queue : stage->m_out_queues) {
+        queue->Close();
+        queue->Clear();
+      }
+    }
+  }
+
+  void Fail(const PipelineStage& stage, const TaskExecDetails& details) {
+    {
+      unique_lock<mutex> lock(m_lock);
+      if (!m_failed) {
+        m_failed = true;
+        m_error = details;
+        m_error.m_status = TaskExecStatus::TASK_EXEC_FAIL;
+        m_error.m_msg = stage.m_name + ": " + details.m_msg;
+      }
+    }
+    Abort();
+  }
+
+  void Run(PipelineStage& stage) {
+    Tracer::Instance().SetThreadTag(stage.m_name);
+    vector<PipelineToken> srcs(stage.m_in_queues.size());
+    vector<Token*> raw_srcs(srcs.size());
+
+    while (!m_stop) {
+      auto eos = false;
+      for (auto i = 0U; i < srcs.size() && !eos; i++) {
+        eos = QueueStatus::OK != stage.m_in_queues[i]->Pop(srcs[i], -1);
+        raw_srcs[i] = srcs[i].get();
+      }
+
+      if (eos) {
+        break;
+      }
+
+      PipelineToken dst = nullptr;
+      TaskExecDetails details;
+      try {
+        dst = stage.m_pool->Acquire();
+        if (!dst) {
+          break;
+        }
+        details = stage.m_func(raw_srcs, *dst.get());
+      } catch (exception& e) {
+        details = TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                                  TaskExecInfo::FAIL, e.what());
+      } catch (...) {
+        details = TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                                  TaskExecInfo::FAIL, "unknown exception");
+      }
+
+      // Upstream tokens go back to their pools as soon as possible.
+      for (auto& src : srcs) {
+        src.reset();
+      }
+
+      if (TaskExecInfo::END_OF_STREAM == details.m_info) {
+        break;
+      } else if (TaskExecInfo::MORE_DATA_NEEDED == details.m_info) {
+        continue;
+      } else if (TaskExecStatus::TASK_EXEC_SUCCESS != details.m_status) {
+        Fail(stage, details);
+        break;
+      }
+
+      auto num_pushed = 0U;
+      for (auto& queue : stage.m_out_queues) {
+        num_pushed += queue->Push(dst) ? 1U : 0U;
+      }
+
+      // All downstream stages are done, nobody needs our tokens.
+      if (!num_pushed) {
+        break;
+      }
+    }
+
+    // Downstream stages see end of stream after queued tokens.
+    for (auto& queue : stage.m_out_queues) {
+      queue->Close();
+    }
+
+    // Upstream stages stop sending tokens which won't be taken.
+    for (auto& queue : stage.m_in_queues) {
+      queue->Close();
+      queue->Clear();
+    }
+  }
+
+  void Stop() {
+    if (!m_started) {
+      return;
+    }
+
+    Abort();
+    for (auto& stage : m_stages) {
+      if (stage->m_thread.joinable()) {
+        stage->m_thread.join();
+      }
+    }
+  }
+};
+} // namespace VPF
+
+Pipeline::Pipeline() : pImpl(new Pipeline_Impl()) {}
+
+Pipeline::~Pipeline() {
+  pImpl->Stop();
+  delete pImpl;
+}
+
+size_t Pipeline::AddStage(const string& name, const vector<size_t>& inputs,
+                          StageFunc func, TokenFactory factory,
+                          size_t pool_size) {
+  if (pImpl->m_started) {
+    throw logic_error("Can't add stage to started pipeline");
+  }
+
+  if (!pool_size) {
+    throw invalid_argument("Stage pool size must be positive");
+  }
+
+  if (!func || !factory) {
+    throw invalid_argument("Stage function and token factory are required");
+  }
+
+  for (auto input : inputs) {
+    if (input >= pImpl->m_stages.size()) {
+      throw invalid_argument("Invalid stage input: " + to_string(input));
+    }
+  }
+
+  auto stage = make_unique<PipelineStage>();
+  stage->m_name = name;
+  stage->m_inputs = inputs;
+  stage->m_func = std::move(func);
+  stage->m_pool = make_shared<TokenPool>(std::move(factory), pool_size);
+
+  pImpl->m_stages.push_back(std::move(stage));
+  return pImpl->m_stages.size() - 1U;
+}
+
+size_t Pipeline::AddTask(Task& task, const vector<size_t>& inputs,
+                         TokenFactory factory, size_t pool_size,
+                         const vector<Token*>& extra) {
+  auto const num_srcs = (uint32_t)inputs.size();
+  if (task.GetNumInputs() < num_srcs + 1U + extra.size()) {
+    throw invalid_argument(string("Task ") + task.GetName() +
+                           " doesn't have enough inputs");
+  }
+
+  auto func = [&task, num_srcs, extra](const vector<Token*>& srcs,
+                                       Token& dst) {
+    task.ClearInputs();
+    for (auto i = 0U; i < num_srcs; i++) {
+      task.SetInput(srcs[i], i);
+    }
+
+    task.SetInput(&dst, num_srcs);
+    for (auto i = 0U; i < extra.size(); i++) {
+      task.SetInput(extra[i], num_srcs + 1U + i);
+    }
+
+    return task.Execute();
+  };
+
+  return AddStage(task.GetName(), inputs, func, std::move(factory),
+                  pool_size);
+}
+
+void Pipeline::Start() {
+  if (pImpl->m_started) {
+    throw logic_error("Pipeline was started before");
+  }
+
+  if (pImpl->m_stages.empty()) {
+    throw logic_error("Pipeline has no stages");
+  }
+
+  auto& stages = pImpl->m_stages;
+  for (auto& stage : stages) {
+    for (auto input : stage->m_inputs) {
+      auto& upstream = stages[input];
+      auto queue = make_shared<TokenQueue>(upstream->m_pool->Capacity());
+      stage->m_in_queues.push_back(queue);
+      upstream->m_out_queues.push_back(queue);
+    }
+  }
+
+  for (auto& stage : stages) {
+    if (stage->m_out_queues.empty()) {
+      stage->m_sink = make_shared<TokenQueue>(stage->m_pool->Capacity());
+      stage->m_out_queues.push_back(stage->m_sink);
+    }
+  }
+
+  pImpl->m_started = true;
+  try {
+    for (auto& stage : stages) {
+      auto p_stage = stage.get();
+      stage->m_thread = thread([this, p_stage]() { pImpl->Run(*p_stage); });
+    }
+  } catch (...) {
+    pImpl->Stop();
+    throw;
+  }
+}
+
+void Pipeline::Stop() { pImpl->Stop(); }
+
+TaskExecDetails Pipeline::Pull(size_t stage, PipelineToken& token,
+                               int timeout_ms) {
+  auto& sink = pImpl->GetStage(stage);
+  if (!pImpl->IsSink(stage)) {
+    throw invalid_argument("Stage " + sink.m_name + " isn't a sink");
+  }
+
+  if (!pImpl->m_started) {
+    throw logic_error("Pipeline isn't started");
+  }
+
+  switch (sink.m_sink->Pop(token, timeout_ms)) {
+  case QueueStatus::OK:
+    return TaskExecDetails();
+  case QueueStatus::TIMEOUT:
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                           TaskExecInfo::MORE_DATA_NEEDED, "timeout");
+  default:
+    break;
+  }
+
+  unique_lock<mutex> lock(pImpl->m_lock);
+  if (pImpl->m_failed) {
+    return pImpl->m_error;
+  }
+
+  return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                         TaskExecInfo::END_OF_STREAM);
+}
+
+size_t Pipeline::NumStages() const { return pImpl->m_stages.size(); }
+
+const string& Pipeline::GetStageName(size_t stage) const {
+  return pImpl->GetStage(stage).m_name;
+}
+
+bool Pipeline::IsSink(size_t stage) const { return pImpl->IsSink(stage); }
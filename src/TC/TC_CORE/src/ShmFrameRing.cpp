@@ -0,0 +1,328 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ShmFrameRing.hpp"
+
+using namespace std;
+using namespace VPF;
+
+static constexpr uint64_t s_magic = 0x474E495241494C56ULL; // "VLAIRING"
+static constexpr uint32_t s_version = 1U;
+static constexpr size_t s_page_size = 4096U;
+static constexpr int s_spin_count = 64;
+static constexpr auto s_poll_interval = chrono::microseconds(50);
+
+static_assert(atomic<uint32_t>::is_always_lock_free &&
+                  atomic<uint64_t>::is_always_lock_free,
+              "Shared memory ring needs address-free atomics");
+
+namespace VPF {
+enum ShmSlotState : uint32_t { FREE = 0U, WRITING, READY, READING };
+
+/* Memory layout is ring header, slot headers, slot data; Every slot data
+ * starts at page boundary;
+ */
+struct alignas(64) ShmRingHeader {
+  atomic<uint64_t> magic;
+  uint32_t version;
+  uint32_t num_slots;
+  uint64_t slot_size;
+  uint64_t data_offset;
+  uint64_t data_stride;
+  alignas(64) atomic<uint64_t> write_seq;
+  alignas(64) atomic<uint64_t> read_seq;
+};
+
+struct alignas(64) ShmSlotHeader {
+  atomic<uint32_t> state;
+  uint32_t aborted;
+  atomic<uint64_t> seq;
+  ShmFrameInfo info;
+};
+
+struct ShmFrameRing_Impl {
+  string m_name;
+  bool m_owner = false;
+  void* m_mem = nullptr;
+  size_t m_mem_size = 0U;
+
+  ShmRingHeader* Header() { return (ShmRingHeader*)m_mem; }
+
+  ShmSlotHeader* Slot(int slot) {
+    return (ShmSlotHeader*)((uint8_t*)m_mem + sizeof(ShmRingHeader)) + slot;
+  }
+
+  uint8_t* Data(int slot) {
+    return (uint8_t*)m_mem + Header()->data_offset +
+           Header()->data_stride * slot;
+  }
+
+  /* Calls func until it returns true or timeout expires;
+   * Spins first, then sleeps, frames are rarely more often than 1 ms;
+   */
+  template <typename Func> bool Wait(int timeout_ms, Func func) {
+    auto const deadline =
+        chrono::steady_clock::now() + chrono::milliseconds(timeout_ms);
+    for (auto i = 0;; i++) {
+      if (func()) {
+        return true;
+      }
+
+      if (i < s_spin_count) {
+        this_thread::yield();
+        continue;
+      }
+
+      if (timeout_ms >= 0 && chrono::steady_clock::now() >= deadline) {
+        return false;
+      }
+      this_thread::sleep_for(s_poll_interval);
+    }
+  }
+
+  ~ShmFrameRing_Impl() {
+#if !defined(_WIN32)
+    if (m_mem) {
+      munmap(m_mem, m_mem_size);
+    }
+    if (m_owner) {
+      shm_unlink(m_name.c_str());
+    }
+#endif
+  }
+};
+} // namespace VPF
+
+static string ShmName(const string& name) {
+  if (name.empty()) {
+    throw invalid_argument("Shared memory name is empty");
+  }
+  return '/' == name[0] ? name : "/" + name;
+}
+
+static size_t AlignUp(size_t size, size_t alignment) {
+  return (size + alignment - 1U) / alignment * alignment;
+}
+
+#if !defined(_WIN32)
+static void* MapShm(int fd, size_t size) {
+  auto mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  return MAP_FAILED == mem ? nullptr : mem;
+}
+#endif
+
+ShmFrameRing::ShmFrameRing() : pImpl(new ShmFrameRing_Impl()) {}
+
+ShmFrameRing::~ShmFrameRing() { delete pImpl; }
+
+ShmFrameRing* ShmFrameRing::Create(const string& name, uint32_t num_slots,
+                                   size_t slot_size) {
+#if defined(_WIN32)
+  throw runtime_error("Shared memory frame ring isn't supported");
+#else
+  if (!num_slots || !slot_size) {
+    throw invalid_argument("Ring must have at least 1 slot of non-zero size");
+  }
+
+  auto const data_offset = AlignUp(
+      sizeof(ShmRingHeader) + sizeof(ShmSlotHeader) * num_slots, s_page_size);
+  auto const data_stride = AlignUp(slot_size, s_page_size);
+  auto const mem_size = data_offset + data_stride * num_slots;
+
+  auto ring = new ShmFrameRing();
+  ring->pImpl->m_name = ShmName(name);
+
+  auto fd = shm_open(ring->pImpl->m_name.c_str(), O_CREAT | O_EXCL | O_RDWR,
+                     S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    delete ring;
+    throw runtime_error("Failed to create shared memory " + name + ": " +
+                        strerror(errno));
+  }
+  ring->pImpl->m_owner = true;
+
+  if (ftruncate(fd, (off_t)mem_size)) {
+    close(fd);
+    delete ring;
+    throw runtime_error("Failed to resize shared memory " + name + ": " +
+                        strerror(errno));
+  }
+
+  ring->pImpl->m_mem = MapShm(fd, mem_size);
+  ring->pImpl->m_mem_size = mem_size;
+  if (!ring->pImpl->m_mem) {
+    delete ring;
+    throw runtime_error("Failed to map shared memory " + name);
+  }
+
+  // Memory is zeroed by ftruncate, so all slots are free;
+  auto header = ring->pImpl->Header();
+  header->version = s_version;
+  header->num_slots = num_slots;
+  header->slot_size = slot_size;
+  header->data_offset = data_offset;
+  header->data_stride = data_stride;
+
+  // Attached processes check magic, header must be complete by then;
+  header->magic.store(s_magic, memory_order_release);
+  return ring;
+#endif
+}
+
+ShmFrameRing* ShmFrameRing::Attach(const string& name) {
+#if defined(_WIN32)
+  throw runtime_error("Shared memory frame ring isn't supported");
+#else
+  auto ring = new ShmFrameRing();
+  ring->pImpl->m_name = ShmName(name);
+
+  auto fd = shm_open(ring->pImpl->m_name.c_str(), O_RDWR, 0);
+  struct stat st = {};
+  if (fd < 0 || fstat(fd, &st) ||
+      (size_t)st.st_size < sizeof(ShmRingHeader)) {
+    if (fd >= 0) {
+      close(fd);
+    }
+    delete ring;
+    throw runtime_error("No shared memory frame ring " + name);
+  }
+
+  ring->pImpl->m_mem = MapShm(fd, st.st_size);
+  ring->pImpl->m_mem_size = st.st_size;
+  if (!ring->pImpl->m_mem) {
+    delete ring;
+    throw runtime_error("Failed to map shared memory " + name);
+  }
+
+  auto header = ring->pImpl->Header();
+  if (header->magic.load(memory_order_acquire) != s_magic ||
+      header->version != s_version || !header->num_slots ||
+      header->data_offset + header->data_stride * header->num_slots >
+          ring->pImpl->m_mem_size) {
+    delete ring;
+    throw runtime_error("Shared memory " + name + " isn't a frame ring");
+  }
+
+  return ring;
+#endif
+}
+
+const string& ShmFrameRing::Name() const { return pImpl->m_name; }
+
+uint32_t ShmFrameRing::NumSlots() const { return pImpl->Header()->num_slots; }
+
+size_t ShmFrameRing::SlotSize() const { return pImpl->Header()->slot_size; }
+
+void* ShmFrameRing::SlotData(int slot) { return pImpl->Data(slot); }
+
+int ShmFrameRing::AcquireWrite(int timeout_ms) {
+  auto header = pImpl->Header();
+  int slot = -1;
+
+  auto acquired = pImpl->Wait(timeout_ms, [&]() {
+    auto seq = header->write_seq.load(memory_order_acquire);
+    auto candidate = (int)(seq % header->num_slots);
+    auto slot_header = pImpl->Slot(candidate);
+
+    /* Slot is claimed before sequence number, so producers which read the
+     * same or stale sequence number can't take it too; Slot is busy if
+     * oldest frame isn't consumed yet or other producer claims it;
+     */
+    auto state = (uint32_t)FREE;
+    if (!slot_header->state.compare_exchange_strong(state, WRITING)) {
+      return false;
+    }
+
+    /* Other producer may take this sequence number first, slot is given
+     * back then; No one else changes state of claimed slot;
+     */
+    if (!header->write_seq.compare_exchange_strong(seq, seq + 1U)) {
+      slot_header->state.store(FREE, memory_order_release);
+      return false;
+    }
+
+    slot_header->seq.store(seq, memory_order_relaxed);
+    slot_header->aborted = 0U;
+    slot = candidate;
+    return true;
+  });
+
+  return acquired ? slot : -1;
+}
+
+void ShmFrameRing::Publish(int slot, const ShmFrameInfo& info) {
+  auto slot_header = pImpl->Slot(slot);
+  slot_header->info = info;
+  slot_header->state.store(READY, memory_order_release);
+}
+
+void ShmFrameRing::Abort(int slot) {
+  // Consumers wait for slots in order, so aborted slot is skipped by them;
+  auto slot_header = pImpl->Slot(slot);
+  slot_header->aborted = 1U;
+  slot_header->state.store(READY, memory_order_release);
+}
+
+int ShmFrameRing::AcquireRead(ShmFrameInfo& info, int timeout_ms) {
+  auto header = pImpl->Header();
+  int slot = -1;
+
+  auto acquired = pImpl->Wait(timeout_ms, [&]() {
+    while (true) {
+      auto seq = header->read_seq.load(memory_order_acquire);
+      auto candidate = (int)(seq % header->num_slots);
+      auto slot_header = pImpl->Slot(candidate);
+
+      if (READY != slot_header->state.load(memory_order_acquire) ||
+          slot_header->seq.load(memory_order_relaxed) != seq) {
+        return false;
+      }
+
+      // Other consumer may take this frame first;
+      if (!header->read_seq.compare_exchange_strong(seq, seq + 1U)) {
+        continue;
+      }
+
+      if (slot_header->aborted) {
+        slot_header->state.store(FREE, memory_order_release);
+        continue;
+      }
+
+      slot_header->state.store(READING, memory_order_release);
+      info = slot_header->info;
+      slot = candidate;
+      return true;
+    }
+  });
+
+  return acquired ? slot : -1;
+}
+
+void ShmFrameRing::Release(int slot) {
+  pImpl->Slot(slot)->state.store(FREE, memory_order_release);
+}
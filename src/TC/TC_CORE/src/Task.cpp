@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "TC_CORE.hpp"
+#include "TaskStats.hpp"
 
 using namespace std;
 using namespace VPF;
@@ -32,6 +33,10 @@ struct TaskImpl {
 
   TaskExecDetails m_exec_details;
 
+  /* Tasks with same name share stats counter;
+   */
+  size_t m_stats_id;
+
   TaskImpl() = delete;
   TaskImpl(const TaskImpl& other) = delete;
   TaskImpl& operator=(const TaskImpl& other) = delete;
@@ -39,7 +44,8 @@ struct TaskImpl {
   TaskImpl(const char* str_name, uint32_t num_inputs, uint32_t num_outputs,
            p_sync_call sync_call, void* p_args)
       : name(str_name), m_inputs(num_inputs), m_outputs(num_outputs),
-        m_call(sync_call), m_args(p_args) {}
+        m_call(sync_call), m_args(p_args),
+        m_stats_id(TaskStats::Instance().GetCounterId(str_name)) {}
 };
 } // namespace VPF
 
@@ -51,11 +57,13 @@ Task::Task(const char* str_name, uint32_t num_inputs, uint32_t num_outputs,
 TaskExecDetails Task::Run() { return TaskExecDetails(); }
 
 TaskExecDetails Task::Execute() {
+  auto const start = TaskStats::Clock::now();
   auto const ret = Run();
   if (p_impl->m_call && p_impl->m_args) {
     p_impl->m_call(p_impl->m_args);
   }
 
+  TaskStats::Instance().Record(p_impl->m_stats_id, start, ret);
   return ret;
 }
 
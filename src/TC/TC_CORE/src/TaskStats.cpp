@@ -0,0 +1,293 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "TaskStats.hpp"
+
+using namespace std;
+using namespace VPF;
+
+static constexpr size_t s_sub_buckets = 1U << TaskStats::SUB_BUCKET_BITS;
+
+namespace VPF {
+/* Counter values kept by single thread;
+ * Only owner thread writes them, so there are no read-modify-write
+ * operations, atomics just let other threads read them; Max latency is the
+ * exception, reset zeroes it from another thread, so it's updated with CAS;
+ */
+struct StatsRecord {
+  atomic<uint64_t> calls = 0U;
+  atomic<uint64_t> failures = 0U;
+  atomic<uint64_t> total_ns = 0U;
+  atomic<uint64_t> max_ns = 0U;
+  array<atomic<uint64_t>, TaskStats::NUM_INFOS> infos = {};
+  array<atomic<uint64_t>, TaskStats::NUM_BUCKETS> histogram = {};
+
+  static void Inc(atomic<uint64_t>& value, uint64_t delta) {
+    value.store(value.load(memory_order_relaxed) + delta,
+                memory_order_relaxed);
+  }
+
+  static void Max(atomic<uint64_t>& value, uint64_t ns) {
+    auto prev = value.load(memory_order_relaxed);
+    while (prev < ns &&
+           !value.compare_exchange_weak(prev, ns, memory_order_relaxed)) {
+    }
+  }
+
+  void AddTo(TaskStats::Counter& counter) const {
+    counter.calls += calls.load(memory_order_relaxed);
+    counter.failures += failures.load(memory_order_relaxed);
+    counter.total_ns += total_ns.load(memory_order_relaxed);
+    counter.max_ns = max(counter.max_ns, max_ns.load(memory_order_relaxed));
+    for (auto i = 0U; i < infos.size(); i++) {
+      counter.infos[i] += infos[i].load(memory_order_relaxed);
+    }
+    for (auto i = 0U; i < histogram.size(); i++) {
+      counter.histogram[i] += histogram[i].load(memory_order_relaxed);
+    }
+  }
+};
+
+struct StatsShard;
+
+struct TaskStats_Impl {
+  /* Lock order is stats lock first, shard lock second;
+   */
+  mutable mutex m_lock;
+  map<string, size_t> m_ids;
+  vector<string> m_names;
+  set<StatsShard*> m_shards;
+
+  /* Counters of exited threads and counters at last reset;
+   */
+  vector<TaskStats::Counter> m_retired;
+  vector<TaskStats::Counter> m_baseline;
+
+  vector<TaskStats::Counter> Collect() const;
+};
+
+struct StatsShard {
+  /* Guards records vector, owner thread takes it only to grow vector;
+   */
+  mutex m_lock;
+  vector<unique_ptr<StatsRecord>> m_records;
+  TaskStats_Impl* m_stats;
+
+  explicit StatsShard(TaskStats_Impl* stats) : m_stats(stats) {
+    lock_guard<mutex> stats_lock(m_stats->m_lock);
+    m_stats->m_shards.insert(this);
+  }
+
+  /* Thread exits, its counters are kept by stats;
+   */
+  ~StatsShard() {
+    lock_guard<mutex> stats_lock(m_stats->m_lock);
+    lock_guard<mutex> lock(m_lock);
+    auto& retired = m_stats->m_retired;
+    if (retired.size() < m_records.size()) {
+      retired.resize(m_records.size());
+    }
+
+    for (auto i = 0U; i < m_records.size(); i++) {
+      m_records[i]->AddTo(retired[i]);
+    }
+    m_stats->m_shards.erase(this);
+  }
+
+  StatsRecord& GetRecord(size_t id) {
+    if (id >= m_records.size()) {
+      lock_guard<mutex> lock(m_lock);
+      while (m_records.size() <= id) {
+        m_records.emplace_back(new StatsRecord());
+      }
+    }
+    return *m_records[id].get();
+  }
+};
+
+vector<TaskStats::Counter> TaskStats_Impl::Collect() const {
+  vector<TaskStats::Counter> counters(m_names.size());
+  for (auto i = 0U; i < m_retired.size(); i++) {
+    counters[i] = m_retired[i];
+  }
+
+  for (auto shard : m_shards) {
+    lock_guard<mutex> lock(shard->m_lock);
+    for (auto i = 0U; i < shard->m_records.size(); i++) {
+      shard->m_records[i]->AddTo(counters[i]);
+    }
+  }
+
+  for (auto i = 0U; i < counters.size(); i++) {
+    counters[i].name = m_names[i];
+  }
+  return counters;
+}
+
+static StatsShard& GetShard(TaskStats_Impl* stats) {
+  thread_local StatsShard shard(stats);
+  return shard;
+}
+} // namespace VPF
+
+double TaskStats::Counter::QuantileNs(double q) const {
+  uint64_t total = 0U;
+  for (auto count : histogram) {
+    total += count;
+  }
+
+  if (!total) {
+    return 0.0;
+  }
+
+  auto const target = min(max(q, 0.0), 1.0) * total;
+  uint64_t cumulative = 0U;
+  for (auto i = 0U; i < histogram.size(); i++) {
+    if (!histogram[i] || cumulative + histogram[i] < target) {
+      cumulative += histogram[i];
+      continue;
+    }
+
+    auto const lo = double(BucketLowerBound(i));
+    auto const hi = i + 1U < histogram.size()
+                        ? double(BucketLowerBound(i + 1U))
+                        : lo * (s_sub_buckets + 1U) / s_sub_buckets;
+    auto const frac = (target - cumulative) / histogram[i];
+    auto const ns = lo + (hi - lo) * frac;
+    return max_ns ? min(ns, double(max_ns)) : ns;
+  }
+
+  return double(BucketLowerBound(histogram.size() - 1U));
+}
+
+TaskStats& TaskStats::Instance() {
+  // Never destroyed, thread shards may outlive static objects;
+  static auto stats = new TaskStats();
+  return *stats;
+}
+
+TaskStats::TaskStats() : pImpl(new TaskStats_Impl()) {}
+
+TaskStats::~TaskStats() { delete pImpl; }
+
+size_t TaskStats::GetCounterId(const string& name) {
+  lock_guard<mutex> lock(pImpl->m_lock);
+  auto it = pImpl->m_ids.find(name);
+  if (it != pImpl->m_ids.end()) {
+    return it->second;
+  }
+
+  auto const id = pImpl->m_names.size();
+  pImpl->m_names.push_back(name);
+  pImpl->m_ids[name] = id;
+  return id;
+}
+
+void TaskStats::Record(size_t id, Clock::time_point start,
+                       const TaskExecDetails& details) {
+  auto const ns = chrono::duration_cast<chrono::nanoseconds>(Clock::now() -
+                                                             start)
+                      .count();
+  auto const elapsed = (uint64_t)max<int64_t>(ns, 0);
+
+  auto& record = GetShard(pImpl).GetRecord(id);
+  StatsRecord::Inc(record.calls, 1U);
+  StatsRecord::Inc(record.total_ns, elapsed);
+  StatsRecord::Max(record.max_ns, elapsed);
+  StatsRecord::Inc(record.histogram[BucketIndex(elapsed)], 1U);
+
+  auto const info = (size_t)details.m_info;
+  if (info < NUM_INFOS) {
+    StatsRecord::Inc(record.infos[info], 1U);
+  }
+
+  if (TaskExecStatus::TASK_EXEC_FAIL == details.m_status) {
+    StatsRecord::Inc(record.failures, 1U);
+  }
+}
+
+vector<TaskStats::Counter> TaskStats::GetCounters() const {
+  lock_guard<mutex> lock(pImpl->m_lock);
+  auto counters = pImpl->Collect();
+
+  // Counters only grow, so baseline is never bigger than current value.
+  auto const& baseline = pImpl->m_baseline;
+  for (auto i = 0U; i < baseline.size(); i++) {
+    auto& counter = counters[i];
+    counter.calls -= baseline[i].calls;
+    counter.failures -= baseline[i].failures;
+    counter.total_ns -= baseline[i].total_ns;
+    for (auto j = 0U; j < NUM_INFOS; j++) {
+      counter.infos[j] -= baseline[i].infos[j];
+    }
+    for (auto j = 0U; j < NUM_BUCKETS; j++) {
+      counter.histogram[j] -= baseline[i].histogram[j];
+    }
+  }
+
+  counters.erase(remove_if(counters.begin(), counters.end(),
+                           [](const Counter& c) { return !c.calls; }),
+                 counters.end());
+  return counters;
+}
+
+void TaskStats::Reset() {
+  // Shards aren't zeroed, owner threads update them without locks.
+  lock_guard<mutex> lock(pImpl->m_lock);
+  pImpl->m_baseline = pImpl->Collect();
+
+  // Max can't be subtracted, so it's zeroed instead.
+  for (auto& counter : pImpl->m_retired) {
+    counter.max_ns = 0U;
+  }
+
+  for (auto shard : pImpl->m_shards) {
+    lock_guard<mutex> shard_lock(shard->m_lock);
+    for (auto& record : shard->m_records) {
+      record->max_ns.store(0U, memory_order_relaxed);
+    }
+  }
+}
+
+size_t TaskStats::BucketIndex(uint64_t ns) {
+  if (ns < s_sub_buckets) {
+    return ns;
+  }
+
+  auto exp = 0U;
+  while (ns >> (exp + 1U)) {
+    exp++;
+  }
+
+  auto const sub = (ns >> (exp - SUB_BUCKET_BITS)) & (s_sub_buckets - 1U);
+  auto const idx = (exp - SUB_BUCKET_BITS + 1U) * s_sub_buckets + sub;
+  return min<size_t>(idx, NUM_BUCKETS - 1U);
+}
+
+uint64_t TaskStats::BucketLowerBound(size_t idx) {
+  if (idx < s_sub_buckets) {
+    return idx;
+  }
+
+  auto const exp = idx / s_sub_buckets + SUB_BUCKET_BITS - 1U;
+  auto const sub = idx % s_sub_buckets;
+  return (s_sub_buckets + sub) << (exp - SUB_BUCKET_BITS);
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+using namespace std;
+using namespace VPF;
+
+namespace VPF {
+struct ThreadPool_Impl {
+  vector<thread> m_threads;
+  queue<function<void(size_t)>> m_jobs;
+  mutex m_lock;
+  condition_variable m_cv;
+  bool m_stop = false;
+
+  explicit ThreadPool_Impl(size_t num_threads) {
+    if (!num_threads) {
+      num_threads = max(1U, thread::hardware_concurrency());
+    }
+
+    for (size_t i = 0U; i < num_threads; i++) {
+      m_threads.emplace_back([this, i]() { Loop(i); });
+    }
+  }
+
+  ~ThreadPool_Impl() {
+    {
+      unique_lock<mutex> lock(m_lock);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+
+    for (auto& t : m_threads) {
+      t.join();
+    }
+  }
+
+  void Loop(size_t worker) {
+    while (true) {
+      function<void(size_t)> job;
+      {
+        unique_lock<mutex> lock(m_lock);
+        m_cv.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+        if (m_jobs.empty()) {
+          return;
+        }
+
+        job = std::move(m_jobs.front());
+        m_jobs.pop();
+      }
+
+      job(worker);
+    }
+  }
+
+  void Submit(function<void(size_t)> job) {
+    {
+      unique_lock<mutex> lock(m_lock);
+      m_jobs.push(std::move(job));
+    }
+    m_cv.notify_one();
+  }
+};
+} // namespace VPF
+
+ThreadPool::ThreadPool(size_t num_threads)
+    : pImpl(new ThreadPool_Impl(num_threads)) {}
+
+ThreadPool::~ThreadPool() { delete pImpl; }
+
+size_t ThreadPool::NumThreads() const { return pImpl->m_threads.size(); }
+
+void ThreadPool::Submit(function<void(size_t worker)> job) {
+  pImpl->Submit(std::move(job));
+}
+
+void ThreadPool::ParallelFor(
+    size_t count, const function<void(size_t idx, size_t worker)>& func) {
+  if (!count) {
+    return;
+  }
+
+  // Every job grabs next index until range is exhausted. That balances
+  // uneven per-item cost better than static partitioning.
+  atomic<size_t> next(0U);
+  size_t pending = min(count, NumThreads());
+  exception_ptr error = nullptr;
+  mutex lock;
+  condition_variable cv;
+
+  auto const num_jobs = pending;
+  for (size_t i = 0U; i < num_jobs; i++) {
+    Submit([&](size_t worker) {
+      try {
+        for (auto idx = next++; idx < count; idx = next++) {
+          func(idx, worker);
+        }
+      } catch (...) {
+        unique_lock<mutex> guard(lock);
+        if (!error) {
+          error = current_exception();
+        }
+        // Don't let other jobs pick up remaining items.
+        next = count;
+      }
+
+      unique_lock<mutex> guard(lock);
+      if (!--pending) {
+        cv.notify_one();
+      }
+    });
+  }
+
+  unique_lock<mutex> guard(lock);
+  cv.wait(guard, [&]() { return !pending; });
+
+  if (error) {
+    rethrow_exception(error);
+  }
+}
+
+ThreadPool& ThreadPool::Shared() {
+  static ThreadPool pool;
+  return pool;
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "Tracer.hpp"
+
+using namespace std;
+using namespace VPF;
+
+static constexpr size_t s_name_words = (Tracer::MAX_NAME_LEN + 8U) / 8U;
+
+namespace VPF {
+/* Slot is written by single thread at a time;
+ * Sequence number is odd while slot is written and even otherwise, so
+ * reader can tell if it has seen consistent values. Fields are relaxed
+ * atomics to make concurrent read well-defined;
+ */
+struct TraceSlot {
+  atomic<uint64_t> seq = 0U;
+  atomic<uint64_t> start_ns = 0U;
+  atomic<uint64_t> dur_ns = 0U;
+  atomic<uint64_t> tid = 0U;
+  atomic<uint64_t> tag = 0U;
+  array<atomic<uint64_t>, s_name_words> name = {};
+};
+
+struct TraceRing {
+  const size_t m_capacity;
+  unique_ptr<TraceSlot[]> m_slots;
+  atomic<uint64_t> m_head = 0U;
+
+  /* Index of first slot of current capture;
+   */
+  uint64_t m_begin = 0U;
+
+  explicit TraceRing(size_t capacity)
+      : m_capacity(capacity), m_slots(new TraceSlot[capacity]) {}
+};
+
+struct TraceEvent {
+  string name;
+  uint64_t start_ns;
+  uint64_t dur_ns;
+  uint64_t tid;
+  uint64_t tag;
+};
+
+struct Tracer_Impl {
+  Tracer::Clock::time_point m_origin = Tracer::Clock::now();
+
+  mutable mutex m_lock;
+  atomic<TraceRing*> m_ring = nullptr;
+  unique_ptr<TraceRing> m_ring_owner;
+
+  /* Number of threads inside Record; Writer counts itself before it loads
+   * ring pointer, so writer which got replaced ring has been counted
+   * before ring was replaced;
+   */
+  atomic<uint64_t> m_writers = 0U;
+
+  /* Replaced rings which writers may still refer to;
+   */
+  vector<unique_ptr<TraceRing>> m_retired;
+
+  /* Frees retired rings once no writer is inside Record; New writers only
+   * see current ring, so they don't keep retired ones alive;
+   */
+  void FreeRetired() {
+    if (!m_retired.empty() && !m_writers.load()) {
+      m_retired.clear();
+    }
+  }
+
+  /* Tag 0 is no tag;
+   */
+  vector<string> m_tags = {""};
+  map<string, uint64_t> m_tag_ids;
+
+  atomic<uint64_t> m_num_threads = 0U;
+};
+
+static uint64_t GetThreadId(Tracer_Impl* impl) {
+  thread_local auto tid = impl->m_num_threads.fetch_add(1U) + 1U;
+  return tid;
+}
+
+static uint64_t& GetThreadTag() {
+  thread_local uint64_t tag = 0U;
+  return tag;
+}
+
+static void WriteJsonString(ostream& out, const string& str) {
+  out << '"';
+  for (auto c : str) {
+    switch (c) {
+    case '"':
+      out << "\\\"";
+      break;
+    case '\\':
+      out << "\\\\";
+      break;
+    default:
+      if ((unsigned char)c < 0x20) {
+        char buf[8];
+        snprintf(buf, sizeof(buf), "\\u%04x", c);
+        out << buf;
+      } else {
+        out << c;
+      }
+    }
+  }
+  out << '"';
+}
+
+static void WriteMicroseconds(ostream& out, uint64_t ns) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%llu.%03llu", (unsigned long long)(ns / 1000U),
+           (unsigned long long)(ns % 1000U));
+  out << buf;
+}
+} // namespace VPF
+
+Tracer& Tracer::Instance() {
+  // Never destroyed, ranges may be recorded by static objects destructors;
+  static auto tracer = new Tracer();
+  return *tracer;
+}
+
+Tracer::Tracer() : m_backend(TraceBackend::NVTX), pImpl(new Tracer_Impl()) {}
+
+Tracer::~Tracer() { delete pImpl; }
+
+void Tracer::SetBackend(TraceBackend backend, size_t capacity) {
+  lock_guard<mutex> lock(pImpl->m_lock);
+  if (TraceBackend::CHROME == backend) {
+    if (!capacity) {
+      throw invalid_argument("Trace capacity must be positive");
+    }
+
+    auto ring = pImpl->m_ring.load();
+    if (ring && ring->m_capacity == capacity) {
+      ring->m_begin = ring->m_head.load();
+    } else {
+      if (pImpl->m_ring_owner) {
+        pImpl->m_retired.push_back(move(pImpl->m_ring_owner));
+      }
+      pImpl->m_ring_owner.reset(new TraceRing(capacity));
+      pImpl->m_ring.store(pImpl->m_ring_owner.get());
+    }
+  }
+
+  pImpl->FreeRetired();
+  m_backend.store(backend, memory_order_relaxed);
+}
+
+void Tracer::Record(const char* name, Clock::time_point start) {
+  auto const end = Clock::now();
+
+  pImpl->m_writers.fetch_add(1U);
+  auto ring = pImpl->m_ring.load();
+  if (!ring) {
+    pImpl->m_writers.fetch_sub(1U, memory_order_release);
+    return;
+  }
+
+  auto to_ns = [](Clock::duration d) {
+    return (uint64_t)max<int64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(d).count(), 0);
+  };
+
+  array<uint64_t, s_name_words> words = {};
+  strncpy((char*)words.data(), name ? name : "", MAX_NAME_LEN);
+
+  auto const idx = ring->m_head.fetch_add(1U, memory_order_relaxed);
+  auto& slot = ring->m_slots[idx % ring->m_capacity];
+  slot.seq.store(2U * idx + 1U, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+
+  slot.start_ns.store(to_ns(start - pImpl->m_origin), memory_order_relaxed);
+  slot.dur_ns.store(to_ns(end - start), memory_order_relaxed);
+  slot.tid.store(GetThreadId(pImpl), memory_order_relaxed);
+  slot.tag.store(GetThreadTag(), memory_order_relaxed);
+  for (auto i = 0U; i < s_name_words; i++) {
+    slot.name[i].store(words[i], memory_order_relaxed);
+  }
+
+  slot.seq.store(2U * idx + 2U, memory_order_release);
+  pImpl->m_writers.fetch_sub(1U, memory_order_release);
+}
+
+void Tracer::SetThreadTag(const string& tag) {
+  if (tag.empty()) {
+    GetThreadTag() = 0U;
+    return;
+  }
+
+  lock_guard<mutex> lock(pImpl->m_lock);
+  auto it = pImpl->m_tag_ids.find(tag);
+  if (it == pImpl->m_tag_ids.end()) {
+    it = pImpl->m_tag_ids.emplace(tag, pImpl->m_tags.size()).first;
+    pImpl->m_tags.push_back(tag);
+  }
+  GetThreadTag() = it->second;
+}
+
+size_t Tracer::Dump(ostream& out) const {
+  lock_guard<mutex> lock(pImpl->m_lock);
+  pImpl->FreeRetired();
+  vector<TraceEvent> events;
+
+  auto ring = pImpl->m_ring.load();
+  if (ring) {
+    auto const head = ring->m_head.load(memory_order_acquire);
+    auto first = head > ring->m_capacity ? head - ring->m_capacity : 0U;
+    first = max(first, ring->m_begin);
+    events.reserve(head - first);
+
+    for (auto idx = first; idx < head; idx++) {
+      auto& slot = ring->m_slots[idx % ring->m_capacity];
+      auto const seq = slot.seq.load(memory_order_acquire);
+      // Slot is being written or already holds newer range.
+      if (seq != 2U * idx + 2U) {
+        continue;
+      }
+
+      TraceEvent event;
+      array<uint64_t, s_name_words> words;
+      event.start_ns = slot.start_ns.load(memory_order_relaxed);
+      event.dur_ns = slot.dur_ns.load(memory_order_relaxed);
+      event.tid = slot.tid.load(memory_order_relaxed);
+      event.tag = slot.tag.load(memory_order_relaxed);
+      for (auto i = 0U; i < s_name_words; i++) {
+        words[i] = slot.name[i].load(memory_order_relaxed);
+      }
+
+      atomic_thread_fence(memory_order_acquire);
+      if (slot.seq.load(memory_order_relaxed) != seq) {
+        continue;
+      }
+
+      auto const chars = (const char*)words.data();
+      event.name.assign(chars, strnlen(chars, MAX_NAME_LEN));
+      events.push_back(move(event));
+    }
+  }
+
+  sort(events.begin(), events.end(),
+       [](const TraceEvent& a, const TraceEvent& b) {
+         return a.start_ns < b.start_ns;
+       });
+
+  // Timestamps are in microseconds.
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  for (auto i = 0U; i < events.size(); i++) {
+    auto const& event = events[i];
+    out << (i ? ",\n" : "\n") << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << event.tid
+        << ",\"ts\":";
+    WriteMicroseconds(out, event.start_ns);
+    out << ",\"dur\":";
+    WriteMicroseconds(out, event.dur_ns);
+    out << ",\"name\":";
+    WriteJsonString(out, event.name);
+    if (event.tag && event.tag < pImpl->m_tags.size()) {
+      out << ",\"args\":{\"tag\":";
+      WriteJsonString(out, pImpl->m_tags[event.tag]);
+      out << "}";
+    }
+    out << "}";
+  }
+  out << "\n]}\n";
+
+  return events.size();
+}
@@ -145,4 +145,6 @@ struct SeekContext {
 /// @brief Decoder operation mode.
 /// KEY_FRAMES - only key frames will be decoded
 /// ALL_FRAMES - usual mode (decode all frames)
-enum class DecodeMode { KEY_FRAMES = 0, ALL_FRAMES = 1 };
\ No newline at end of file
+/// SIDE_DATA_ONLY - decode all frames, save side data (e.g. motion vectors)
+/// but don't output pixels
+enum class DecodeMode { KEY_FRAMES = 0, ALL_FRAMES = 1, SIDE_DATA_ONLY = 2 };
\ No newline at end of file
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "MemoryInterfaces.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace VPF {
+
+/// @brief Non-owning view of host frame stored in Buffer or host Surface.
+/// Buffer planes are packed one after another without row padding, same
+/// layout as produced by av_image_copy_to_buffer with alignment 1. Planar RGB
+/// formats have no FFmpeg counterpart and store 3 full size planes in R, G, B
+/// order.
+struct TC_EXPORT HostImage {
+  Pixel_Format format = UNDEFINED;
+  uint32_t width = 0U;
+  uint32_t height = 0U;
+
+  /// @brief Size of single channel value in bytes
+  uint32_t elem_size = 1U;
+
+  uint32_t num_planes = 0U;
+  std::array<uint8_t*, 4> data = {};
+
+  /// @brief Distance between rows in bytes
+  std::array<size_t, 4> pitch = {};
+
+  /// @brief Size of row pixels in bytes, less than pitch if rows are padded
+  std::array<size_t, 4> row_size = {};
+
+  /// @brief Plane height in rows
+  std::array<uint32_t, 4> rows = {};
+
+  /// @brief Plane width in pixels, interleaved chroma pair counts as one
+  std::array<uint32_t, 4> cols = {};
+
+  template <typename T> T* Row(uint32_t plane, uint32_t row) const {
+    return (T*)(data[plane] + pitch[plane] * row);
+  }
+
+  /// @brief Describe planes of given frame.
+  /// @return empty optional if format isn't supported or buffer size doesn't
+  /// match frame size.
+  static std::optional<HostImage> Make(Buffer& buf, Pixel_Format fmt,
+                                       uint32_t width, uint32_t height);
+
+  /// @brief Describe planes of Surface located in host memory.
+  /// Rows keep Surface pitch, e.g. NV12 chroma follows luma in same plane.
+  /// @return empty optional if Surface isn't in host memory or its planes
+  /// are smaller than format requires.
+  static std::optional<HostImage> Make(Surface& surf);
+
+  /// @brief Size of packed frame in bytes, 0 if format isn't supported.
+  static size_t BufferSize(Pixel_Format fmt, uint32_t width, uint32_t height);
+};
+
+inline bool IsPlanarRgb(Pixel_Format fmt) {
+  return RGB_PLANAR == fmt || RGB_32F_PLANAR == fmt;
+}
+
+/// @brief Pointers to first R, G, B values of image row.
+/// Covers packed RGB, packed BGR and planar RGB.
+template <typename T> struct RgbRow {
+  T* r;
+  T* g;
+  T* b;
+};
+
+template <typename T>
+inline RgbRow<T> RgbRowOf(const HostImage& img, uint32_t row) {
+  if (IsPlanarRgb(img.format)) {
+    return {img.Row<T>(0U, row), img.Row<T>(1U, row), img.Row<T>(2U, row)};
+  }
+
+  auto base = img.Row<T>(0U, row);
+  if (BGR == img.format) {
+    return {base + 2, base + 1, base};
+  }
+  return {base, base + 1, base + 2};
+}
+} // namespace VPF
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tc_export.h" // generated by cmake
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace VPF {
+
+/// @brief Resolution of video track changes starting from given frame.
+struct ResolutionSwitch {
+  uint32_t frame = 0U;
+  uint32_t width = 0U;
+  uint32_t height = 0U;
+};
+
+/// @brief Synthetic clip description.
+struct MediaParams {
+  /// @brief libavcodec software encoder name, e. g. mpeg4, mjpeg, ffv1
+  std::string codec = "mpeg4";
+
+  /// @brief File extension, muxer is chosen by it. Data tracks need
+  /// container which supports them, e. g. ts
+  std::string container = "mkv";
+
+  uint32_t width = 640U;
+  uint32_t height = 360U;
+  uint32_t num_frames = 300U;
+  uint32_t fps = 30U;
+  uint32_t gop_size = 30U;
+  uint32_t b_frames = 0U;
+
+  /// @brief 8 or 10, encoder must support 10 bit 4:2:0, 4:2:2 or 4:4:4
+  uint32_t bit_depth = 8U;
+
+  /// @brief Frame durations in 1 / fps units, cycled. Empty for constant
+  /// frame rate
+  std::vector<uint32_t> vfr_pattern;
+
+  /// @brief Number of AAC tracks with sine tone
+  uint32_t num_audio_tracks = 0U;
+
+  /// @brief Number of KLV data tracks with packet per video frame
+  uint32_t num_data_tracks = 0U;
+
+  /// @brief Codec headers are sent in-band if there are switches, so
+  /// decoder sees resolution change
+  std::vector<ResolutionSwitch> res_switches;
+};
+
+/// @brief Encodes synthetic clips with libavcodec software encoders.
+/// Frames have gradient background and moving box, so motion vectors and
+/// frame differences are non-trivial.
+class TC_EXPORT MediaGenerator {
+public:
+  /// @brief Write clip to given path. File appears when it's complete, so
+  /// concurrent readers never see partial file.
+  /// @throws std::invalid_argument if parameters are invalid or encoder
+  /// doesn't support them, std::runtime_error if libav call fails.
+  static void Generate(const MediaParams& params, const std::string& path);
+
+  /// @brief File name which is unique for given parameters.
+  static std::string GetCacheName(const MediaParams& params);
+
+  /// @brief Return path of clip in cache directory, generate clip if it's
+  /// not there. Empty cache_dir means VALI_MEDIA_CACHE environment variable
+  /// or vali_media in temporary directory if it's not set.
+  static std::string GetCached(const MediaParams& params,
+                               const std::string& cache_dir = "");
+};
+} // namespace VPF
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "Numa.hpp"
 #include "SurfacePlane.hpp"
 #include "nvEncodeAPI.h"
 #include <vector>
@@ -80,6 +81,20 @@ public:
   void* GetRawMemPtr();
   const void* GetRawMemPtr() const;
   size_t GetRawMemSize() const;
+
+  /* Returns size of allocated memory in bytes, may be bigger than size;
+   */
+  size_t GetCapacity() const;
+
+  /* Returns NUMA node own memory is placed on, Numa::ANY_NODE if there's no
+   * placement preference;
+   */
+  int GetNumaNode() const;
+
+  /* Changes buffer size.
+   * Own memory is reallocated only if new size exceeds capacity. Previous
+   * content isn't preserved. If newPtr is given, data is copied from it.
+   */
   void Update(size_t newSize, void* newPtr = nullptr);
   bool CopyFrom(size_t size, void const* ptr);
   template <typename T> T* GetDataAs() { return (T*)GetRawMemPtr(); }
@@ -93,7 +108,17 @@ public:
   static Buffer* MakeOwnMem(size_t bufferSize);
   static Buffer* MakeOwnMem(size_t bufferSize, const void* pCopyFrom);
 
-  explicit Buffer(size_t bufferSize, bool ownMemory = true);
+  /* Allocates own memory on given NUMA node. Reallocations caused by
+   * Update() stay on the same node;
+   */
+  static Buffer* MakeOwnMem(size_t bufferSize, int numaNode);
+
+  explicit Buffer(size_t bufferSize, bool ownMemory = true,
+                  int numaNode = Numa::ANY_NODE);
+
+  /* Buffer which doesn't own memory is a view of given pointer. It may be
+   * made on stack to pass existing memory to a task without allocation;
+   */
   Buffer(size_t bufferSize, void* pCopyFrom, bool ownMemory);
   Buffer(size_t bufferSize, const void* pCopyFrom);
 
@@ -102,11 +127,13 @@ private:
   void Deallocate();
 
   bool own_memory = true;
+  int numa_node = Numa::ANY_NODE;
   size_t mem_size = 0UL;
+  size_t mem_capacity = 0UL;
   void* pRawData = nullptr;
 };
 
-/* Represents GPU-side memory.
+/* Represents GPU-side memory, or host memory if made with HostContext().
  * Pure interface class, see ancestors;
  */
 class TC_EXPORT Surface : public Token {
@@ -182,9 +209,14 @@ public:
   virtual Surface* Create() = 0;
 
   /* Get associated CUDA context;
+   * Returns HostContext() if memory is located in RAM;
    */
   CUcontext Context();
 
+  /* Returns true if memory is located in RAM, false otherwise;
+   */
+  bool OnHost() const;
+
   /* Returns true if memory was allocated in constructor, false otherwise;
    */
   bool OwnMemory();
@@ -207,6 +239,7 @@ public:
   static Surface* Make(Pixel_Format format);
 
   /* Make & own memory;
+   * Pass HostContext() to allocate pitched host memory instead of vRAM;
    */
   static Surface* Make(Pixel_Format format, uint32_t newWidth,
                        uint32_t newHeight, CUcontext context);
@@ -16,10 +16,20 @@
 
 #include "CudaUtils.hpp"
 #include "dlpack.h"
+#include <cstdint>
 #include <memory>
 
 namespace VPF {
 
+/* Pseudo CUDA context. SurfacePlane allocates pitched host memory instead of
+ * vRAM when it's given this context;
+ */
+inline CUcontext HostContext() noexcept { return (CUcontext)UINTPTR_MAX; }
+
+inline bool IsHostContext(CUcontext context) noexcept {
+  return HostContext() == context;
+}
+
 struct CudaArrayInterfaceDescriptor {
   /* Only Surfaces with single SurfacePlane can be serialized into CAI.
    * Hence no need to store more than 3 elements: width, height, channels.
@@ -48,12 +58,13 @@ struct CudaArrayInterfaceDescriptor {
 
 /* 2D chunk of GPU memory located in vRAM. It doesn't have any pixel format.
  * Just a byte storage which can be easily shared via DLPack.
+ * If created with HostContext(), memory is located in RAM instead;
  */
 class TC_EXPORT SurfacePlane {
-  // GPU memory allocation that is owned by class instance;
+  // GPU (or host) memory allocation that is owned by class instance;
   std::shared_ptr<void> m_own_gpu_mem;
 
-  // Weak pointer to borrowed GPU memory;
+  // Weak pointer to borrowed GPU (or host) memory;
   std::weak_ptr<void> m_borrowed_gpu_mem;
 
   bool m_own_mem = false;
@@ -69,6 +80,12 @@ class TC_EXPORT SurfacePlane {
    */
   void Allocate(CUcontext context = nullptr, bool pitched = true);
 
+  /* Allocate host memory from HostMemPool. Pitch is multiple of 64 bytes,
+   * so every row starts at cache line boundary;
+   * May throw exception with reason in message;
+   */
+  void AllocateHost(bool pitched);
+
   /* Reset SurfacePlane to blank state.
    * GPU memory deallocation will follow usual weak_ptr logic;
    */
@@ -106,14 +123,18 @@ public:
      */
     DLDataTypeCode m_type_code = kDLOpaqueHandle;
 
+    /* DLPack device type code, kDLCUDA or kDLCPU;
+     */
+    DLDeviceType m_device_type = kDLCUDA;
+
     /* Get DLPack data type code;
      */
     inline DLDataTypeCode DataType() const noexcept { return m_type_code; }
 
     /* Get DLPlack device type code;
-     * Supports kDLCUDA only;
+     * Supports kDLCUDA and kDLCPU;
      */
-    inline DLDeviceType DeviceType() const noexcept { return kDLCUDA; }
+    inline DLDeviceType DeviceType() const noexcept { return m_device_type; }
 
     /* Get raw GPU memory ptr;
      */
@@ -125,11 +146,13 @@ public:
      *
      * Caller is responsible of checking if provided data can be serialized
      * into DLPack (e. g. memory allocation is of sufficient size);
+     * For kDLCPU device dptr is host memory address;
      */
     static DLManagedTensor* ToDLPack(uint32_t width, uint32_t height,
                                      uint32_t pitch, uint32_t elem_size,
                                      CUdeviceptr dptr,
-                                     DLDataTypeCode type_code);
+                                     DLDataTypeCode type_code,
+                                     DLDeviceType device_type = kDLCUDA);
 
     /* Same as previous but wrapped in smart pointer. Handy to use inside C++
      * code, no need to mess with deleter;
@@ -137,7 +160,8 @@ public:
     static std::shared_ptr<DLManagedTensor>
     ToDLPackSmart(uint32_t width, uint32_t height, uint32_t pitch,
                   uint32_t elem_size, CUdeviceptr dptr,
-                  DLDataTypeCode type_code);
+                  DLDataTypeCode type_code,
+                  DLDeviceType device_type = kDLCUDA);
   } m_dlpack_ctx;
 
   /* Blank plane, zero size. No memory ownership;
@@ -174,7 +198,8 @@ public:
                const std::string& layout);
 
   /* Construct & own memory. If null context is given, current context will be
-   * used. May throw exception with reason in message;
+   * used. If HostContext() is given, host memory will be allocated.
+   * May throw exception with reason in message;
    */
   SurfacePlane(uint32_t width, uint32_t height, uint32_t elem_size,
                DLDataTypeCode type_code, std::string type_str,
@@ -211,8 +236,15 @@ public:
    */
   inline bool Pitched() const noexcept { return m_pitch != m_width; };
 
+  /* Return true if memory is located in RAM, false otherwise;
+   */
+  inline bool OnHost() const noexcept {
+    return kDLCPU == m_dlpack_ctx.DeviceType();
+  }
+
   /* Return CUdeviceptr of memory allocation.
    * If created from DLPack, it will be raw CUdeviceptr.
+   * If memory is located in RAM, it will be host memory address.
    * Will return 0x0 if no memory is accessible (empty SurfacePlane)
    */
   CUdeviceptr GpuMem() const noexcept;
@@ -257,11 +289,13 @@ public:
   inline bool Empty() const noexcept { return 0x0 == GpuMem(); }
 
   /* Get CUDA context associated with memory object (borrowed ot its own);
+   * Returns HostContext() if memory is located in RAM;
    * May throw exception with reason in message;
    */
   CUcontext Context() const;
 
   /* Get device ID associated with memory object;
+   * Returns 0 if memory is located in RAM, as DLPack spec requires;
    * May throw exception with reason in message;
    */
   int DeviceId() const;
@@ -18,6 +18,8 @@
 #include "MemoryInterfaces.hpp"
 #include "NvCodecCLIOptions.h"
 #include "TC_CORE.hpp"
+#include "Tracer.hpp"
+#include "TypedTask.hpp"
 #include "tc_core_export.h" // generated by cmake
 
 extern "C" {
@@ -27,7 +29,9 @@ extern "C" {
 
 #include "LibCuda.hpp"
 #include "LibNvJpeg.hpp"
+#include <array>
 #include <optional>
+#include <set>
 
 #ifdef USE_NVTX
 #include <nvtx3/nvToolsExt.h>
@@ -48,14 +52,42 @@ using namespace VPF;
 
 // VPF stands for Video Processing Framework;
 namespace VPF {
+struct HostImage;
+class ConvertHostFrame;
+class RotateHostFrame;
+class UDHostFrame;
+
+/* Scoped trace range, goes to backend selected by Tracer;
+ * Name must outlive the mark;
+ */
 class TC_CORE_EXPORT NvtxMark {
 public:
   NvtxMark() = delete;
   NvtxMark(const NvtxMark& other) = delete;
   NvtxMark(const NvtxMark&& other) = delete;
   NvtxMark& operator=(const NvtxMark& other) = delete;
-  NvtxMark(const char* fname) { NVTX_PUSH(fname) }
-  ~NvtxMark() { NVTX_POP }
+
+  NvtxMark(const char* fname)
+      : m_name(fname), m_backend(Tracer::Instance().GetBackend()) {
+    if (TraceBackend::NVTX == m_backend) {
+      NVTX_PUSH(fname)
+    } else if (TraceBackend::CHROME == m_backend) {
+      m_start = Tracer::Clock::now();
+    }
+  }
+
+  ~NvtxMark() {
+    if (TraceBackend::NVTX == m_backend) {
+      NVTX_POP
+    } else if (TraceBackend::CHROME == m_backend) {
+      Tracer::Instance().Record(m_name, m_start);
+    }
+  }
+
+private:
+  const char* m_name;
+  TraceBackend m_backend;
+  Tracer::Clock::time_point m_start;
 };
 
 class TC_CORE_EXPORT NvencEncodeFrame final : public Task {
@@ -112,6 +144,48 @@ enum DECODE_STATUS {
   DEC_DONE        // decoder won't return any more frames
 };
 
+/* Reference to single side data entry of decoded frame;
+ * Data stays valid as long as reference is alive;
+ */
+struct SideDataEntry {
+  AVFrameSideDataType type;
+  const uint8_t* data = nullptr;
+  size_t size = 0U;
+  std::shared_ptr<AVBufferRef> ref;
+};
+
+/* Decoder counters since decoder creation;
+ * Times are in nanoseconds;
+ */
+struct DecoderStats {
+  uint64_t num_pkt_read = 0U;
+  uint64_t num_pkt_sent = 0U;
+  uint64_t num_frm_recv = 0U;
+
+  /* Payload of all packets read, including other streams;
+   */
+  uint64_t num_bytes_read = 0U;
+
+  uint64_t num_seeks = 0U;
+
+  /* Frames decoded on the way to seek target;
+   */
+  uint64_t num_frm_seek_discarded = 0U;
+
+  /* Time spent in av_read_frame, in avcodec_send_packet and
+   * avcodec_receive_frame, in decoded frame copy to output;
+   */
+  uint64_t read_ns = 0U;
+  uint64_t decode_ns = 0U;
+  uint64_t copy_ns = 0U;
+
+  /* Packets in queue now, max ever and queue capacity;
+   */
+  size_t queue_size = 0U;
+  size_t max_queue_size = 0U;
+  size_t queue_capacity = 0U;
+};
+
 class TC_CORE_EXPORT DecodeFrame {
 public:
   DecodeFrame() = delete;
@@ -123,6 +197,25 @@ public:
 
   TaskExecDetails GetSideData(AVFrameSideDataType data_type, Buffer& out);
 
+  /* Returns reference to side data of last decoded frame without copy,
+   * nullptr if there's no such side data or its type isn't saved;
+   */
+  std::shared_ptr<AVBufferRef>
+  GetSideDataRef(AVFrameSideDataType data_type) const;
+
+  /* Selects side data types saved for every decoded frame and number of
+   * recent frames they are kept for; Motion vectors and display matrix are
+   * saved for last frame by default;
+   */
+  void SetSideDataTypes(const std::set<AVFrameSideDataType>& types,
+                        size_t history = 1U);
+
+  /* Gets side data of recent frame, 0 is last decoded frame;
+   * Returns false if frame is out of history;
+   */
+  bool GetFrameSideData(size_t frames_back, int64_t& pts,
+                        std::vector<SideDataEntry>& entries) const;
+
   void GetParams(Params& params);
   static void Probe(const char* URL, NvDecoderClInterface& cli_iface,
                     std::list<StreamParams>& info,
@@ -132,6 +225,11 @@ public:
   bool IsVFR() const;
   CUstream GetStream() const;
 
+  /* Returns NUMA node decoded frames are placed on, Numa::ANY_NODE if
+   * decoder has no placement preference;
+   */
+  int GetNumaNode() const;
+
   ~DecodeFrame();
   static DecodeFrame* Make(const char* URL, NvDecoderClInterface& cli_iface,
                            int gpu_id, int pkt_queue_size,
@@ -140,12 +238,24 @@ public:
   void SetMode(DecodeMode new_mode);
   DecodeMode GetMode() const;
 
+  /* Returns counters, may be called from any thread;
+   */
+  DecoderStats GetStats() const;
+
+  /* Makes decode calls fail until cancel is reset, call in progress stops
+   * before next packet is read or sent; May be called from any thread;
+   */
+  void SetCancel(bool cancel);
+
   DECODE_STATUS ReadPacket();
   DECODE_STATUS DecodePacket(Token& dst);
 
 private:
   struct FfmpegDecodeFrame_Impl* pImpl = nullptr;
 
+  TaskExecDetails RunImpl(Token& dst, PacketData& pkt_data,
+                          std::optional<SeekContext> seek_ctx);
+
   DecodeFrame(const char* URL, NvDecoderClInterface& cli_iface, int gpu_id,
               int pkt_queue_size,
               std::shared_ptr<AVIOContext> p_io_ctx = nullptr);
@@ -199,9 +309,10 @@ public:
   ConvertSurface(const ConvertSurface& other) = delete;
   ConvertSurface& operator=(const ConvertSurface& other) = delete;
 
-  ~ConvertSurface() = default;
+  ~ConvertSurface();
   ConvertSurface(int gpu_id, CUstream str);
 
+  /// @brief Convert Surface. Host Surfaces are converted by ConvertHostFrame.
   TaskExecDetails
   Run(Surface& src, Surface& dst,
       std::optional<ColorspaceConversionContext> cc_ctx = std::nullopt);
@@ -214,6 +325,53 @@ private:
   CUstream m_stream;
   NppStreamContext m_npp_ctx;
   std::unique_ptr<SurfacePlane> m_scratch;
+  std::unique_ptr<ConvertHostFrame> m_host;
+
+  TaskExecDetails RunImpl(Surface& src, Surface& dst,
+                          std::optional<ColorspaceConversionContext> cc_ctx);
+  TaskExecDetails RunOnHost(Surface& src, Surface& dst,
+                            std::optional<ColorspaceConversionContext> cc_ctx);
+};
+
+class TC_CORE_EXPORT ConvertHostFrame {
+  /**
+   * Host memory counterpart of ConvertSurface.
+   * Supports same set of conversions with same color space and range
+   * handling, including defaults and rejected combinations. Formulas follow
+   * NPP ones, so results match GPU output within 1 LSB of rounding error.
+   */
+public:
+  ConvertHostFrame() = delete;
+  ConvertHostFrame(const ConvertHostFrame& other) = delete;
+  ConvertHostFrame& operator=(const ConvertHostFrame& other) = delete;
+
+  /// @throw std::invalid_argument if conversion isn't supported
+  ConvertHostFrame(uint32_t width, uint32_t height, Pixel_Format src_fmt,
+                   Pixel_Format dst_fmt);
+  ~ConvertHostFrame();
+
+  TaskExecDetails
+  Run(Buffer& src, Buffer& dst,
+      std::optional<ColorspaceConversionContext> cc_ctx = std::nullopt);
+
+  /// @brief Convert frame with arbitrary row pitch, e.g. host Surface.
+  TaskExecDetails
+  Run(const HostImage& src, const HostImage& dst,
+      std::optional<ColorspaceConversionContext> cc_ctx = std::nullopt);
+
+  /// @brief Check if frames have format and size given to constructor
+  bool Matches(const HostImage& src, const HostImage& dst) const;
+
+  /// @brief Source and destination buffer size in bytes
+  size_t GetSrcSize() const;
+  size_t GetDstSize() const;
+
+  /// @brief Same list as ConvertSurface::GetSupportedConversions
+  static std::list<std::pair<Pixel_Format, Pixel_Format>> const&
+  GetSupportedConversions();
+
+private:
+  struct ConvertHostFrame_Impl* pImpl = nullptr;
 };
 
 class TC_CORE_EXPORT ConvertFrame final : public Task {
@@ -239,7 +397,137 @@ private:
                Pixel_Format outFormat);
 };
 
+/* Typed counterpart of ConvertFrame;
+ * Ports are src frame, dst frame and colorspace conversion context. Call does
+ * no heap allocation and no dynamic_cast, so use it for per-frame calls.
+ * Non-owning Buffer made on stack is enough to pass existing memory;
+ */
+class TC_CORE_EXPORT TypedConvertFrame final
+    : public TypedTask<const Buffer&, Buffer&,
+                       const ColorspaceConversionContext&> {
+public:
+  TypedConvertFrame(uint32_t width, uint32_t height, Pixel_Format inFormat,
+                    Pixel_Format outFormat);
+  ~TypedConvertFrame() final;
+
+private:
+  TaskExecDetails Run(const Buffer& src, Buffer& dst,
+                      const ColorspaceConversionContext& cc_ctx) final;
+
+  struct ConvertFrame_Impl* pImpl = nullptr;
+};
+
+/// @brief Placement of scaled picture within letterboxed frame.
+struct LetterboxParams {
+  /// @brief Scale factor applied to both source dimensions
+  float scale = 1.f;
+
+  /// @brief Offset of picture top left corner in destination frame
+  uint32_t offset_x = 0U;
+  uint32_t offset_y = 0U;
+
+  /// @brief Size of scaled picture
+  uint32_t width = 0U;
+  uint32_t height = 0U;
+};
+
+/// @brief Letterbox padding and normalization settings.
+struct LetterboxOptions {
+  /// @brief Padding color in RGB order
+  std::array<uint8_t, 3> pad_color = {114U, 114U, 114U};
+
+  /// @brief Apply (x / 255 - mean) / stddev per channel. Float outputs only.
+  bool normalize = false;
+  std::array<float, 3> mean = {0.f, 0.f, 0.f};
+  std::array<float, 3> stddev = {1.f, 1.f, 1.f};
+};
+
+class TC_CORE_EXPORT LetterboxFrame {
+  /**
+   * Model input preprocessing on CPU.
+   * Converts color, scales with preserved aspect ratio and pads host frame
+   * to fixed size in a single call. Supported output formats are RGB, BGR,
+   * RGB_PLANAR, RGB_32F and RGB_32F_PLANAR.
+   */
+public:
+  LetterboxFrame() = delete;
+  LetterboxFrame(const LetterboxFrame& other) = delete;
+  LetterboxFrame& operator=(const LetterboxFrame& other) = delete;
+
+  LetterboxFrame(uint32_t src_width, uint32_t src_height, Pixel_Format src_fmt,
+                 uint32_t dst_width, uint32_t dst_height,
+                 Pixel_Format dst_fmt);
+  ~LetterboxFrame();
+
+  TaskExecDetails
+  Run(Buffer& src, Buffer& dst, const LetterboxOptions& opts,
+      std::optional<ColorspaceConversionContext> cc_ctx = std::nullopt);
+
+  /// @brief Picture placement, constant for given dimensions
+  const LetterboxParams& GetParams() const;
+
+  /// @brief Destination buffer size in bytes
+  size_t GetDstSize() const;
+
+private:
+  struct LetterboxFrame_Impl* pImpl = nullptr;
+};
+
+/// @brief Region of interest within frame, in pixels.
+struct CropRect {
+  uint32_t x = 0U;
+  uint32_t y = 0U;
+  uint32_t width = 0U;
+  uint32_t height = 0U;
+};
+
+class TC_CORE_EXPORT CropFrame {
+  /**
+   * Crops regions of host frame and converts them to another pixel format,
+   * optionally resizing. Only source rows and columns covered by crops are
+   * read. Crop origin is snapped to chroma subsampling grid of source format.
+   */
+public:
+  CropFrame() = delete;
+  CropFrame(const CropFrame& other) = delete;
+  CropFrame& operator=(const CropFrame& other) = delete;
+
+  CropFrame(uint32_t width, uint32_t height, Pixel_Format src_fmt,
+            Pixel_Format dst_fmt);
+  ~CropFrame();
+
+  /// @brief Put every crop into its own buffer.
+  /// @param dst_width, dst_height crops are resized to this size if both
+  /// values are non-zero, otherwise crops keep their own size.
+  TaskExecDetails
+  Run(Buffer& src, const std::vector<CropRect>& rects,
+      const std::vector<Buffer*>& dsts, uint32_t dst_width = 0U,
+      uint32_t dst_height = 0U,
+      std::optional<ColorspaceConversionContext> cc_ctx = std::nullopt);
+
+  /// @brief Resize all crops to same size and pack them into single buffer
+  /// one after another.
+  TaskExecDetails
+  RunBatch(Buffer& src, const std::vector<CropRect>& rects, Buffer& dst,
+           uint32_t dst_width, uint32_t dst_height,
+           std::optional<ColorspaceConversionContext> cc_ctx = std::nullopt);
+
+  /// @brief Size of single crop in bytes
+  size_t GetDstSize(uint32_t width, uint32_t height) const;
+
+  /// @brief Crop rectangle with origin snapped to chroma subsampling grid.
+  /// That's the area actually read from source frame.
+  CropRect AlignRect(const CropRect& rect) const;
+
+private:
+  struct CropFrame_Impl* pImpl = nullptr;
+};
+
 class TC_CORE_EXPORT ResizeSurface final : public Task {
+  /**
+   * Resizes Surface with Lanczos filter.
+   * Host Surfaces are resized by ResizeHostFrame.
+   */
 public:
   ResizeSurface() = delete;
   ResizeSurface(const ResizeSurface& other) = delete;
@@ -260,6 +548,40 @@ private:
   struct ResizeSurface_Impl* pImpl;
 };
 
+class TC_CORE_EXPORT ResizeHostFrame {
+  /**
+   * Host memory counterpart of ResizeSurface, supports same formats.
+   * Every channel is resized separately with libswscale Lanczos filter
+   * instead of NPP one, results differ by few LSB near sharp edges.
+   */
+public:
+  ResizeHostFrame() = delete;
+  ResizeHostFrame(const ResizeHostFrame& other) = delete;
+  ResizeHostFrame& operator=(const ResizeHostFrame& other) = delete;
+
+  /// @throw std::invalid_argument if format or size isn't supported
+  ResizeHostFrame(uint32_t src_width, uint32_t src_height, uint32_t dst_width,
+                  uint32_t dst_height, Pixel_Format format);
+  ~ResizeHostFrame();
+
+  TaskExecDetails Run(Buffer& src, Buffer& dst);
+
+  /// @brief Resize frame with arbitrary row pitch, e.g. host Surface.
+  TaskExecDetails Run(const HostImage& src, const HostImage& dst);
+
+  /// @brief Check if frames have format and size given to constructor
+  bool Matches(const HostImage& src, const HostImage& dst) const;
+
+  /// @brief Source and destination buffer size in bytes
+  size_t GetSrcSize() const;
+  size_t GetDstSize() const;
+
+  static const std::list<Pixel_Format>& SupportedFormats();
+
+private:
+  struct ResizeHostFrame_Impl* pImpl = nullptr;
+};
+
 class NvJpegEncodeFrame;
 class NvJpegEncodeContext {
 public:
@@ -298,7 +620,9 @@ private:
 class TC_CORE_EXPORT RotateSurface {
 public:
   RotateSurface(int gpu_id, CUstream stream);
-  ~RotateSurface() = default;
+  ~RotateSurface();
+
+  /// @brief Rotate Surface. Host Surfaces are rotated by RotateHostFrame.
   TaskExecDetails Run(double angle, double shift_x, double shift_y,
                       Surface& src, Surface& dst);
   CUstream GetStream() const { return m_stream; }
@@ -306,17 +630,67 @@ public:
 private:
   CUstream m_stream;
   NppStreamContext m_ctx;
+  std::unique_ptr<RotateHostFrame> m_host;
+
+  TaskExecDetails RunImpl(double angle, double shift_x, double shift_y,
+                          Surface& src, Surface& dst);
+  TaskExecDetails RunOnHost(double angle, double shift_x, double shift_y,
+                            Surface& src, Surface& dst);
+};
+
+class TC_CORE_EXPORT RotateHostFrame {
+  /**
+   * Host memory counterpart of RotateSurface, same angle and shift semantics.
+   * Multiples of 90 degrees without shift are handled like PySurfaceRotator
+   * does: image orientation is changed with cache-blocked per-plane
+   * transpose. Shifts are calculated for every plane, so subsampled chroma
+   * of NV12, P10 and YUV420 formats is rotated properly.
+   * Other angles use bilinear interpolation.
+   */
+public:
+  RotateHostFrame() = delete;
+  RotateHostFrame(const RotateHostFrame& other) = delete;
+  RotateHostFrame& operator=(const RotateHostFrame& other) = delete;
+
+  /// @throw std::invalid_argument if format or size isn't supported
+  RotateHostFrame(uint32_t src_width, uint32_t src_height, uint32_t dst_width,
+                  uint32_t dst_height, Pixel_Format format);
+  ~RotateHostFrame();
+
+  /// @brief Rotate frame.
+  /// @param angle rotation angle in degrees
+  /// @param shift_x shift along X axis in pixels
+  /// @param shift_y shift along Y axis in pixels
+  TaskExecDetails Run(double angle, double shift_x, double shift_y,
+                      Buffer& src, Buffer& dst);
+
+  /// @brief Rotate frame with arbitrary row pitch, e.g. host Surface.
+  TaskExecDetails Run(double angle, double shift_x, double shift_y,
+                      const HostImage& src, const HostImage& dst);
+
+  /// @brief Check if frames have format and size given to constructor
+  bool Matches(const HostImage& src, const HostImage& dst) const;
+
+  /// @brief Source and destination buffer size in bytes
+  size_t GetSrcSize() const;
+  size_t GetDstSize() const;
+
+  static const std::list<Pixel_Format>& SupportedFormats();
+
+private:
+  struct RotateHostFrame_Impl* pImpl = nullptr;
 };
 
 class TC_CORE_EXPORT UDSurface {
   /**
    * Upsample + downscale.
    * Converts YUV Surfaces of different chroma subsampling into YUV444.
+   * Host Surfaces are processed by UDHostFrame.
    */
 public:
   UDSurface(int gpu_id, CUstream stream);
 
-  ~UDSurface() = default;
+  ~UDSurface();
 
   TaskExecDetails Run(Surface& src, Surface& dst);
 
@@ -334,5 +708,44 @@ private:
 
   /// @brief NPP stream context
   NppStreamContext m_ctx;
+
+  /// @brief Host Surfaces processor, made for last seen params
+  std::unique_ptr<UDHostFrame> m_host;
+
+  TaskExecDetails RunOnHost(Surface& src, Surface& dst);
+};
+
+class TC_CORE_EXPORT UDHostFrame {
+  /**
+   * Host memory counterpart of UDSurface, supports same conversions.
+   * Semi-planar inputs replicate CUDA texture bilinear sampling of UDSurface
+   * kernels, integer outputs match GPU ones within 1 LSB. Planar inputs are
+   * resized with libswscale Lanczos filter instead of NPP one, results differ
+   * by few LSB near sharp edges.
+   */
+public:
+  UDHostFrame() = delete;
+  UDHostFrame(const UDHostFrame& other) = delete;
+  UDHostFrame& operator=(const UDHostFrame& other) = delete;
+
+  /// @throw std::invalid_argument if conversion isn't supported
+  UDHostFrame(uint32_t src_width, uint32_t src_height, Pixel_Format src_fmt,
+              uint32_t dst_width, uint32_t dst_height, Pixel_Format dst_fmt);
+  ~UDHostFrame();
+
+  TaskExecDetails Run(Buffer& src, Buffer& dst);
+
+  /// @brief Process frame with arbitrary row pitch, e.g. host Surface.
+  TaskExecDetails Run(const HostImage& src, const HostImage& dst);
+
+  /// @brief Check if frames have format and size given to constructor
+  bool Matches(const HostImage& src, const HostImage& dst) const;
+
+  /// @brief Source and destination buffer size in bytes
+  size_t GetSrcSize() const;
+  size_t GetDstSize() const;
+
+private:
+  struct UDHostFrame_Impl* pImpl = nullptr;
 };
 } // namespace VPF
@@ -21,6 +21,7 @@
 #include <string>
 #include <utility>
 
+#include "MemStats.hpp"
 #include "MemoryInterfaces.hpp"
 #include <cuda_runtime.h>
 
@@ -32,6 +33,8 @@ extern "C" {
 #include <libavutil/rational.h>
 
 struct AVFrame;
+struct AVBufferRef;
+struct SwsContext;
 }
 
 #define X_TEXTIFY(a) TEXTIFY(a)
@@ -107,9 +110,27 @@ ColorRange fromFfmpegColorRange(AVColorRange range);
 std::string GetFormatName(Pixel_Format fmt);
 
 /* Creates memaligned AVFrame that manages it's memory.
+ * Memory is taken from HostMemPool.
  */
 std::shared_ptr<AVFrame> makeAVFrame(int width, int height, int format);
 
+/* Creates AVBufferRef which memory is taken from HostMemPool and is returned
+ * there when last reference is gone. Memory is placed on given NUMA node if
+ * it's not Numa::ANY_NODE and is accounted to given component. Returns
+ * nullptr on failure.
+ */
+AVBufferRef*
+makePooledAVBuffer(size_t size, int node = Numa::ANY_NODE,
+                   MemStats::Component component = MemStats::HOST_FRAMES);
+
+/* Creates libswscale context which is accounted to MemStats::SWSCALE while
+ * it's alive. Returns nullptr on failure.
+ */
+std::shared_ptr<SwsContext> makeSwsContext(int src_w, int src_h,
+                                           AVPixelFormat src_fmt, int dst_w,
+                                           int dst_h, AVPixelFormat dst_fmt,
+                                           int flags);
+
 /* Creates Buffer that manages it's memory.
  */
 std::shared_ptr<Buffer> makeBuffer(int width, int height, AVPixelFormat format);
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostImage.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+
+extern "C" {
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+}
+
+using namespace VPF;
+
+static bool Describe(Pixel_Format fmt, uint32_t width, uint32_t height,
+                     HostImage& img) {
+  img.format = fmt;
+  img.width = width;
+  img.height = height;
+
+  if (!width || !height) {
+    return false;
+  }
+
+  // Planar RGB is VALI own format, FFmpeg doesn't have R, G, B plane order.
+  if (RGB_PLANAR == fmt || RGB_32F_PLANAR == fmt) {
+    img.elem_size = RGB_PLANAR == fmt ? 1U : sizeof(float);
+    img.num_planes = 3U;
+    for (auto i = 0U; i < img.num_planes; i++) {
+      img.pitch[i] = width * img.elem_size;
+      img.row_size[i] = img.pitch[i];
+      img.rows[i] = height;
+      img.cols[i] = width;
+    }
+    return true;
+  }
+
+  auto const av_fmt = toFfmpegPixelFormat(fmt);
+  auto const desc = av_pix_fmt_desc_get(av_fmt);
+  if (!desc) {
+    return false;
+  }
+
+  int linesize[4] = {};
+  if (av_image_fill_linesizes(linesize, av_fmt, width) < 0) {
+    return false;
+  }
+
+  img.elem_size = (desc->comp[0].depth + 7) / 8;
+  img.num_planes = av_pix_fmt_count_planes(av_fmt);
+  for (auto i = 0U; i < img.num_planes; i++) {
+    auto const is_chroma = (1U == i || 2U == i);
+    img.pitch[i] = linesize[i];
+    img.row_size[i] = linesize[i];
+    img.rows[i] =
+        is_chroma ? AV_CEIL_RSHIFT(height, desc->log2_chroma_h) : height;
+    img.cols[i] =
+        is_chroma ? AV_CEIL_RSHIFT(width, desc->log2_chroma_w) : width;
+  }
+
+  return true;
+}
+
+size_t HostImage::BufferSize(Pixel_Format fmt, uint32_t width,
+                             uint32_t height) {
+  HostImage img;
+  if (!Describe(fmt, width, height, img)) {
+    return 0U;
+  }
+
+  size_t size = 0U;
+  for (auto i = 0U; i < img.num_planes; i++) {
+    size += img.pitch[i] * img.rows[i];
+  }
+  return size;
+}
+
+std::optional<HostImage> HostImage::Make(Buffer& buf, Pixel_Format fmt,
+                                         uint32_t width, uint32_t height) {
+  HostImage img;
+  if (!Describe(fmt, width, height, img)) {
+    return std::nullopt;
+  }
+
+  auto ptr = buf.GetDataAs<uint8_t>();
+  size_t offset = 0U;
+  for (auto i = 0U; i < img.num_planes; i++) {
+    img.data[i] = ptr + offset;
+    offset += img.pitch[i] * img.rows[i];
+  }
+
+  if (!ptr || offset != buf.GetRawMemSize()) {
+    return std::nullopt;
+  }
+
+  return img;
+}
+
+std::optional<HostImage> HostImage::Make(Surface& surf) {
+  HostImage img;
+  if (!surf.OnHost() ||
+      !Describe(surf.PixelFormat(), surf.Width(), surf.Height(), img)) {
+    return std::nullopt;
+  }
+
+  // E. g. P12 Surface is semi-planar while host P12 frame has 3 planes.
+  if (img.num_planes > surf.NumComponents()) {
+    return std::nullopt;
+  }
+
+  /* Surface plane may hold several image planes, e.g. NV12 chroma or planar
+   * RGB channels. Component pointers tell where image planes start, rows
+   * keep pitch of Surface plane they are in.
+   */
+  for (auto i = 0U; i < img.num_planes; i++) {
+    auto const plane = std::min(i, surf.NumPlanes() - 1U);
+    if (img.row_size[i] > surf.Pitch(plane) ||
+        img.rows[i] > surf.Height(plane)) {
+      return std::nullopt;
+    }
+
+    img.data[i] = (uint8_t*)surf.PixelPtr(i);
+    img.pitch[i] = surf.Pitch(plane);
+    if (!img.data[i]) {
+      return std::nullopt;
+    }
+  }
+
+  return img;
+}
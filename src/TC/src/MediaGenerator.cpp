@@ -0,0 +1,562 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MediaGenerator.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/channel_layout.h>
+#include <libavutil/intreadwrite.h>
+#include <libavutil/mathematics.h>
+#include <libavutil/pixdesc.h>
+}
+
+using namespace VPF;
+namespace fs = std::filesystem;
+
+namespace {
+constexpr int s_sample_rate = 48000;
+constexpr int s_audio_bit_rate = 128000;
+constexpr double s_pi = 3.14159265358979323846;
+constexpr AVRational s_data_time_base = {1, 90000};
+
+// Generic SMPTE universal label, value is 64 bit frame number.
+const uint8_t s_klv_key[16] = {0x06, 0x0E, 0x2B, 0x34, 0x01, 0x01,
+                               0x01, 0x01, 0x0F, 0x00, 0x00, 0x00,
+                               0x00, 0x00, 0x00, 0x00};
+
+// Most common formats go first, so decoders take their usual paths.
+const AVPixelFormat s_formats_8bit[] = {
+    AV_PIX_FMT_YUV420P, AV_PIX_FMT_YUVJ420P, AV_PIX_FMT_YUV422P,
+    AV_PIX_FMT_YUVJ422P, AV_PIX_FMT_YUV444P, AV_PIX_FMT_YUVJ444P};
+
+const AVPixelFormat s_formats_10bit[] = {
+    AV_PIX_FMT_YUV420P10, AV_PIX_FMT_YUV422P10, AV_PIX_FMT_YUV444P10};
+
+using CodecCtxPtr = std::shared_ptr<AVCodecContext>;
+using FramePtr = std::shared_ptr<AVFrame>;
+
+void ThrowOnAvError(int err, const std::string& msg) {
+  if (err < 0) {
+    throw std::runtime_error(msg + ": " + AvErrorToString(err));
+  }
+}
+
+void Validate(const MediaParams& params) {
+  auto is_bad_size = [](uint32_t width, uint32_t height) {
+    return !width || !height || width % 2 || height % 2;
+  };
+
+  if (is_bad_size(params.width, params.height)) {
+    throw std::invalid_argument("Width and height must be even and non-zero");
+  }
+
+  if (!params.num_frames || !params.fps || !params.gop_size) {
+    throw std::invalid_argument(
+        "Number of frames, fps and GOP size must be non-zero");
+  }
+
+  if (8U != params.bit_depth && 10U != params.bit_depth) {
+    throw std::invalid_argument("Bit depth must be 8 or 10");
+  }
+
+  if (std::count(params.vfr_pattern.begin(), params.vfr_pattern.end(), 0U)) {
+    throw std::invalid_argument("VFR pattern durations must be non-zero");
+  }
+
+  uint32_t prev_frame = 0U;
+  for (auto& rs : params.res_switches) {
+    if (!rs.frame || rs.frame <= prev_frame || rs.frame >= params.num_frames) {
+      throw std::invalid_argument(
+          "Resolution switches must be in ascending order within clip");
+    }
+
+    if (is_bad_size(rs.width, rs.height)) {
+      throw std::invalid_argument(
+          "Resolution switch width and height must be even and non-zero");
+    }
+    prev_frame = rs.frame;
+  }
+}
+
+void CheckContainer(const AVOutputFormat* oformat, AVCodecID codec_id,
+                    const char* what) {
+  // Negative result means muxer can't tell, let it try.
+  if (!avformat_query_codec(oformat, codec_id, FF_COMPLIANCE_NORMAL)) {
+    throw std::invalid_argument(std::string(oformat->name) +
+                                " container doesn't support " + what);
+  }
+}
+
+AVPixelFormat PickPixelFormat(const AVCodec* codec, uint32_t bit_depth) {
+  const void* configs = nullptr;
+  int num_configs = 0;
+  ThrowOnAvError(avcodec_get_supported_config(nullptr, codec,
+                                              AV_CODEC_CONFIG_PIX_FORMAT, 0U,
+                                              &configs, &num_configs),
+                 "Can't get encoder pixel formats");
+
+  // Null list means encoder accepts any format.
+  auto supported = static_cast<const AVPixelFormat*>(configs);
+  auto begin = 8U == bit_depth ? std::begin(s_formats_8bit)
+                               : std::begin(s_formats_10bit);
+  auto end =
+      8U == bit_depth ? std::end(s_formats_8bit) : std::end(s_formats_10bit);
+
+  for (auto it = begin; it != end; it++) {
+    if (!supported ||
+        supported + num_configs != std::find(supported,
+                                             supported + num_configs, *it)) {
+      return *it;
+    }
+  }
+
+  throw std::invalid_argument(std::string(codec->name) + " doesn't support " +
+                              std::to_string(bit_depth) + " bit YUV");
+}
+
+CodecCtxPtr AllocContext(const AVCodec* codec) {
+  auto ctx = CodecCtxPtr(avcodec_alloc_context3(codec), [](void* p) {
+    avcodec_free_context((AVCodecContext**)&p);
+  });
+
+  if (!ctx) {
+    throw std::bad_alloc();
+  }
+  return ctx;
+}
+
+FramePtr AllocFrame() {
+  auto frame = FramePtr(av_frame_alloc(), [](void* p) {
+    av_frame_free((AVFrame**)&p);
+  });
+
+  if (!frame) {
+    throw std::bad_alloc();
+  }
+  return frame;
+}
+
+/* Draws gradient background and box which moves across the frame;
+ */
+void FillVideoFrame(AVFrame& frame, uint32_t frame_num, uint32_t bit_depth) {
+  ThrowOnAvError(av_frame_make_writable(&frame), "Can't make frame writable");
+
+  auto const desc = av_pix_fmt_desc_get((AVPixelFormat)frame.format);
+  auto const shift = bit_depth - 8U;
+  auto const box = std::max(frame.height / 8, 2);
+  auto const box_x = (int)(frame_num * 4U) % std::max(frame.width - box, 1);
+  auto const box_y = (int)(frame_num * 2U) % std::max(frame.height - box, 1);
+
+  for (auto plane = 0; plane < 3; plane++) {
+    auto const is_chroma = plane > 0;
+    auto const log2_w = is_chroma ? desc->log2_chroma_w : 0;
+    auto const log2_h = is_chroma ? desc->log2_chroma_h : 0;
+    auto const width = AV_CEIL_RSHIFT(frame.width, log2_w);
+    auto const height = AV_CEIL_RSHIFT(frame.height, log2_h);
+
+    for (auto y = 0; y < height; y++) {
+      auto row = frame.data[plane] + y * frame.linesize[plane];
+      for (auto x = 0; x < width; x++) {
+        auto const luma_x = x << log2_w;
+        auto const luma_y = y << log2_h;
+        auto const in_box = luma_x >= box_x && luma_x < box_x + box &&
+                            luma_y >= box_y && luma_y < box_y + box;
+
+        uint32_t value = 0U;
+        if (!is_chroma) {
+          value = in_box ? 235U : 16U + (x + y + frame_num * 2U) % 220U;
+        } else {
+          value = in_box ? 128U : 64U + (x * plane + frame_num) % 128U;
+        }
+
+        if (shift) {
+          reinterpret_cast<uint16_t*>(row)[x] = (uint16_t)(value << shift);
+        } else {
+          row[x] = (uint8_t)value;
+        }
+      }
+    }
+  }
+}
+
+/* Sine tone, every track has its own pitch;
+ */
+void FillAudioFrame(AVFrame& frame, int64_t first_sample, uint32_t track) {
+  ThrowOnAvError(av_frame_make_writable(&frame), "Can't make frame writable");
+
+  auto const freq = 440.0 * (track + 1U);
+  for (auto ch = 0; ch < frame.ch_layout.nb_channels; ch++) {
+    auto samples = reinterpret_cast<float*>(frame.data[ch]);
+    for (auto i = 0; i < frame.nb_samples; i++) {
+      auto const t = (double)(first_sample + i) / s_sample_rate;
+      samples[i] = (float)(0.2 * std::sin(2.0 * s_pi * freq * t));
+    }
+  }
+}
+
+class ClipWriter {
+public:
+  ClipWriter(const MediaParams& params, const AVCodec* codec,
+             AVPixelFormat pix_fmt, const AVOutputFormat* oformat,
+             const std::string& path)
+      : m_params(params), m_codec(codec), m_pix_fmt(pix_fmt),
+        m_width(params.width), m_height(params.height) {
+    AVFormatContext* fmt_ctx = nullptr;
+    ThrowOnAvError(avformat_alloc_output_context2(&fmt_ctx, oformat, nullptr,
+                                                  path.c_str()),
+                   "Can't allocate output context");
+    m_fmt_ctx = std::shared_ptr<AVFormatContext>(fmt_ctx, [](void* p) {
+      auto ctx = (AVFormatContext*)p;
+      if (!(ctx->oformat->flags & AVFMT_NOFILE)) {
+        avio_closep(&ctx->pb);
+      }
+      avformat_free_context(ctx);
+    });
+
+    m_pkt = std::shared_ptr<AVPacket>(av_packet_alloc(), [](void* p) {
+      av_packet_free((AVPacket**)&p);
+    });
+    if (!m_pkt) {
+      throw std::bad_alloc();
+    }
+
+    /* Encoder is reopened on resolution switch, so headers go in-band and
+     * decoder sees new ones;
+     */
+    m_global_header =
+        (oformat->flags & AVFMT_GLOBALHEADER) && params.res_switches.empty();
+
+    OpenVideo();
+    m_video_stream = AddStream(m_video.get());
+    if (params.vfr_pattern.empty()) {
+      m_video_stream->avg_frame_rate = {(int)params.fps, 1};
+    }
+
+    for (auto i = 0U; i < params.num_audio_tracks; i++) {
+      OpenAudio();
+      m_audio_streams.push_back(AddStream(m_audio.back().get()));
+    }
+
+    for (auto i = 0U; i < params.num_data_tracks; i++) {
+      auto stream = avformat_new_stream(m_fmt_ctx.get(), nullptr);
+      if (!stream) {
+        throw std::bad_alloc();
+      }
+      stream->codecpar->codec_type = AVMEDIA_TYPE_DATA;
+      stream->codecpar->codec_id = AV_CODEC_ID_SMPTE_KLV;
+      stream->time_base = s_data_time_base;
+      m_data_streams.push_back(stream);
+    }
+
+    if (!(oformat->flags & AVFMT_NOFILE)) {
+      ThrowOnAvError(
+          avio_open(&m_fmt_ctx->pb, path.c_str(), AVIO_FLAG_WRITE),
+          "Can't open " + path);
+    }
+
+    ThrowOnAvError(avformat_write_header(m_fmt_ctx.get(), nullptr),
+                   "Can't write header");
+  }
+
+  void Write() {
+    auto const& switches = m_params.res_switches;
+    auto next_switch = switches.begin();
+    int64_t pts = 0;
+
+    for (auto i = 0U; i < m_params.num_frames; i++) {
+      if (switches.end() != next_switch && i == next_switch->frame) {
+        Encode(m_video.get(), m_video_stream, nullptr);
+        m_width = next_switch->width;
+        m_height = next_switch->height;
+        OpenVideo();
+        next_switch++;
+      }
+
+      FillVideoFrame(*m_video_frame, i, m_params.bit_depth);
+      m_video_frame->pts = pts;
+      Encode(m_video.get(), m_video_stream, m_video_frame.get());
+      WriteData(i, pts);
+
+      auto const& pattern = m_params.vfr_pattern;
+      pts += pattern.empty() ? 1 : pattern[i % pattern.size()];
+      WriteAudio(pts);
+    }
+
+    Encode(m_video.get(), m_video_stream, nullptr);
+    for (auto i = 0U; i < m_audio.size(); i++) {
+      Encode(m_audio[i].get(), m_audio_streams[i], nullptr);
+    }
+
+    ThrowOnAvError(av_write_trailer(m_fmt_ctx.get()), "Can't write trailer");
+  }
+
+private:
+  void OpenVideo() {
+    m_video = AllocContext(m_codec);
+    m_video->width = m_width;
+    m_video->height = m_height;
+    m_video->pix_fmt = m_pix_fmt;
+    m_video->time_base = {1, (int)m_params.fps};
+    if (m_params.vfr_pattern.empty()) {
+      m_video->framerate = {(int)m_params.fps, 1};
+    }
+    m_video->gop_size = m_params.gop_size;
+    m_video->max_b_frames = m_params.b_frames;
+    m_video->bit_rate = (int64_t)m_width * m_height * m_params.fps / 8;
+    if (AV_CODEC_ID_MJPEG == m_codec->id) {
+      m_video->color_range = AVCOL_RANGE_JPEG;
+    }
+    if (m_global_header) {
+      m_video->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+    }
+    ThrowOnAvError(avcodec_open2(m_video.get(), m_codec, nullptr),
+                   std::string("Can't open ") + m_codec->name + " encoder");
+
+    m_video_frame = AllocFrame();
+    m_video_frame->format = m_pix_fmt;
+    m_video_frame->width = m_width;
+    m_video_frame->height = m_height;
+    ThrowOnAvError(av_frame_get_buffer(m_video_frame.get(), 0),
+                   "Can't allocate video frame");
+  }
+
+  void OpenAudio() {
+    auto codec = avcodec_find_encoder(AV_CODEC_ID_AAC);
+    if (!codec) {
+      throw std::runtime_error("AAC encoder isn't available");
+    }
+
+    auto ctx = AllocContext(codec);
+    ctx->sample_fmt = AV_SAMPLE_FMT_FLTP;
+    ctx->sample_rate = s_sample_rate;
+    ctx->bit_rate = s_audio_bit_rate;
+    ctx->time_base = {1, s_sample_rate};
+    av_channel_layout_default(&ctx->ch_layout, 2);
+    if (m_fmt_ctx->oformat->flags & AVFMT_GLOBALHEADER) {
+      ctx->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+    }
+    ThrowOnAvError(avcodec_open2(ctx.get(), codec, nullptr),
+                   "Can't open AAC encoder");
+
+    if (!m_audio_frame) {
+      m_audio_frame = AllocFrame();
+      m_audio_frame->format = ctx->sample_fmt;
+      m_audio_frame->sample_rate = ctx->sample_rate;
+      m_audio_frame->nb_samples = ctx->frame_size;
+      ThrowOnAvError(
+          av_channel_layout_copy(&m_audio_frame->ch_layout, &ctx->ch_layout),
+          "Can't set channel layout");
+      ThrowOnAvError(av_frame_get_buffer(m_audio_frame.get(), 0),
+                     "Can't allocate audio frame");
+    }
+
+    m_audio.push_back(ctx);
+  }
+
+  AVStream* AddStream(AVCodecContext* ctx) {
+    auto stream = avformat_new_stream(m_fmt_ctx.get(), nullptr);
+    if (!stream) {
+      throw std::bad_alloc();
+    }
+
+    ThrowOnAvError(avcodec_parameters_from_context(stream->codecpar, ctx),
+                   "Can't copy codec parameters");
+    stream->time_base = ctx->time_base;
+    return stream;
+  }
+
+  /* Sends frame to encoder and muxes everything it gives back; Null frame
+   * flushes encoder;
+   */
+  void Encode(AVCodecContext* ctx, AVStream* stream, AVFrame* frame) {
+    ThrowOnAvError(avcodec_send_frame(ctx, frame), "Can't encode frame");
+
+    while (true) {
+      auto ret = avcodec_receive_packet(ctx, m_pkt.get());
+      if (AVERROR(EAGAIN) == ret || AVERROR_EOF == ret) {
+        return;
+      }
+      ThrowOnAvError(ret, "Can't receive packet");
+
+      av_packet_rescale_ts(m_pkt.get(), ctx->time_base, stream->time_base);
+      m_pkt->stream_index = stream->index;
+      ThrowOnAvError(av_interleaved_write_frame(m_fmt_ctx.get(), m_pkt.get()),
+                     "Can't write packet");
+    }
+  }
+
+  /* Keeps audio tracks up to given video timestamp;
+   */
+  void WriteAudio(int64_t video_pts) {
+    if (m_audio.empty()) {
+      return;
+    }
+
+    auto const end = av_rescale(video_pts, s_sample_rate, m_params.fps);
+    while (m_audio_pts < end) {
+      for (auto i = 0U; i < m_audio.size(); i++) {
+        FillAudioFrame(*m_audio_frame, m_audio_pts, i);
+        m_audio_frame->pts = m_audio_pts;
+        Encode(m_audio[i].get(), m_audio_streams[i], m_audio_frame.get());
+      }
+      m_audio_pts += m_audio_frame->nb_samples;
+    }
+  }
+
+  void WriteData(uint32_t frame_num, int64_t video_pts) {
+    auto const time_base = AVRational{1, (int)m_params.fps};
+    for (auto stream : m_data_streams) {
+      ThrowOnAvError(av_new_packet(m_pkt.get(), sizeof(s_klv_key) + 9),
+                     "Can't allocate data packet");
+      memcpy(m_pkt->data, s_klv_key, sizeof(s_klv_key));
+      m_pkt->data[sizeof(s_klv_key)] = 8U;
+      AV_WB64(m_pkt->data + sizeof(s_klv_key) + 1, frame_num);
+
+      m_pkt->pts = m_pkt->dts =
+          av_rescale_q(video_pts, time_base, stream->time_base);
+      m_pkt->stream_index = stream->index;
+      m_pkt->flags |= AV_PKT_FLAG_KEY;
+      ThrowOnAvError(av_interleaved_write_frame(m_fmt_ctx.get(), m_pkt.get()),
+                     "Can't write data packet");
+    }
+  }
+
+  const MediaParams& m_params;
+  const AVCodec* m_codec;
+  AVPixelFormat m_pix_fmt;
+  uint32_t m_width;
+  uint32_t m_height;
+  bool m_global_header = false;
+
+  std::shared_ptr<AVFormatContext> m_fmt_ctx;
+  std::shared_ptr<AVPacket> m_pkt;
+
+  CodecCtxPtr m_video;
+  FramePtr m_video_frame;
+  AVStream* m_video_stream = nullptr;
+
+  std::vector<CodecCtxPtr> m_audio;
+  std::vector<AVStream*> m_audio_streams;
+  FramePtr m_audio_frame;
+  int64_t m_audio_pts = 0;
+
+  std::vector<AVStream*> m_data_streams;
+};
+} // namespace
+
+void MediaGenerator::Generate(const MediaParams& params,
+                              const std::string& path) {
+  Validate(params);
+
+  auto codec = avcodec_find_encoder_by_name(params.codec.c_str());
+  if (!codec || AVMEDIA_TYPE_VIDEO != codec->type) {
+    throw std::invalid_argument("No video encoder named " + params.codec);
+  }
+
+  auto desc = avcodec_descriptor_get(codec->id);
+  if (params.b_frames && desc && (desc->props & AV_CODEC_PROP_INTRA_ONLY)) {
+    throw std::invalid_argument(params.codec + " is intra only, no B-frames");
+  }
+
+  auto oformat = av_guess_format(nullptr, path.c_str(), nullptr);
+  if (!oformat) {
+    throw std::invalid_argument("Can't guess container format of " + path);
+  }
+
+  CheckContainer(oformat, codec->id, codec->name);
+  if (params.num_audio_tracks) {
+    CheckContainer(oformat, AV_CODEC_ID_AAC, "AAC audio");
+  }
+  if (params.num_data_tracks) {
+    CheckContainer(oformat, AV_CODEC_ID_SMPTE_KLV, "KLV data");
+  }
+
+  auto const pix_fmt = PickPixelFormat(codec, params.bit_depth);
+
+  // Unique among threads and processes which generate same clip.
+  auto const now = std::chrono::steady_clock::now().time_since_epoch();
+  auto const tid = std::hash<std::thread::id>()(std::this_thread::get_id());
+  auto const tmp_path =
+      path + ".part" + std::to_string(tid ^ (size_t)now.count());
+
+  try {
+    ClipWriter(params, codec, pix_fmt, oformat, tmp_path).Write();
+  } catch (...) {
+    std::error_code ec;
+    fs::remove(tmp_path, ec);
+    throw;
+  }
+
+  fs::rename(tmp_path, path);
+}
+
+std::string MediaGenerator::GetCacheName(const MediaParams& params) {
+  std::stringstream ss;
+  ss << params.codec << "_" << params.width << "x" << params.height << "_"
+     << params.num_frames << "f_" << params.fps << "fps_g" << params.gop_size
+     << "_b" << params.b_frames << "_" << params.bit_depth << "bit";
+
+  if (!params.vfr_pattern.empty()) {
+    ss << "_vfr";
+    for (auto duration : params.vfr_pattern) {
+      ss << "-" << duration;
+    }
+  }
+
+  if (params.num_audio_tracks) {
+    ss << "_a" << params.num_audio_tracks;
+  }
+
+  if (params.num_data_tracks) {
+    ss << "_d" << params.num_data_tracks;
+  }
+
+  for (auto& rs : params.res_switches) {
+    ss << "_rs" << rs.frame << "-" << rs.width << "x" << rs.height;
+  }
+
+  ss << "." << params.container;
+  return ss.str();
+}
+
+std::string MediaGenerator::GetCached(const MediaParams& params,
+                                      const std::string& cache_dir) {
+  fs::path dir = cache_dir;
+  if (dir.empty()) {
+    const char* env = getenv("VALI_MEDIA_CACHE");
+    dir = env ? fs::path(env) : fs::temp_directory_path() / "vali_media";
+  }
+
+  fs::create_directories(dir);
+  auto const path = (dir / GetCacheName(params)).string();
+  if (!fs::exists(path)) {
+    Generate(params, path);
+  }
+
+  return path;
+}
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include "HostMemPool.hpp"
+#include "MemStats.hpp"
 #include "Surfaces.hpp"
 #include "Utils.hpp"
 #include <algorithm>
@@ -33,8 +35,9 @@ Buffer* Buffer::Make(size_t bufferSize, void* pCopyFrom) {
   return new Buffer(bufferSize, pCopyFrom, false);
 }
 
-Buffer::Buffer(size_t bufferSize, bool ownMemory)
-    : mem_size(bufferSize), own_memory(ownMemory) {
+Buffer::Buffer(size_t bufferSize, bool ownMemory, int numaNode)
+    : own_memory(ownMemory), numa_node(numaNode), mem_size(bufferSize),
+      mem_capacity(bufferSize) {
   if (own_memory) {
     if (!Allocate()) {
       throw bad_alloc();
@@ -43,7 +46,7 @@ Buffer::Buffer(size_t bufferSize, bool ownMemory)
 }
 
 Buffer::Buffer(size_t bufferSize, void* pCopyFrom, bool ownMemory)
-    : mem_size(bufferSize), own_memory(ownMemory) {
+    : own_memory(ownMemory), mem_size(bufferSize), mem_capacity(bufferSize) {
   if (own_memory) {
     if (Allocate()) {
       memcpy(this->GetRawMemPtr(), pCopyFrom, bufferSize);
@@ -56,7 +59,7 @@ Buffer::Buffer(size_t bufferSize, void* pCopyFrom, bool ownMemory)
 }
 
 Buffer::Buffer(size_t bufferSize, const void* pCopyFrom)
-    : mem_size(bufferSize), own_memory(true) {
+    : own_memory(true), mem_size(bufferSize), mem_capacity(bufferSize) {
   if (Allocate()) {
     memcpy(this->GetRawMemPtr(), pCopyFrom, bufferSize);
   } else {
@@ -68,9 +71,20 @@ Buffer::~Buffer() { Deallocate(); }
 
 size_t Buffer::GetRawMemSize() const { return mem_size; }
 
+size_t Buffer::GetCapacity() const { return mem_capacity; }
+
+int Buffer::GetNumaNode() const { return numa_node; }
+
+/* Memory comes from HostMemPool and isn't zeroed, it's always overwritten
+ * by the user;
+ */
 bool Buffer::Allocate() {
-  if (GetRawMemSize()) {
-    pRawData = calloc(GetRawMemSize(), sizeof(uint8_t));
+  if (mem_capacity) {
+    mem_capacity = HostMemPool::RoundUp(mem_capacity, numa_node);
+    pRawData = HostMemPool::Instance().Allocate(mem_capacity, numa_node);
+    if (pRawData) {
+      MemStats::Instance().OnAlloc(MemStats::BUFFERS, mem_capacity);
+    }
     return (nullptr != pRawData);
   }
   return true;
@@ -78,9 +92,13 @@ bool Buffer::Allocate() {
 
 void Buffer::Deallocate() {
   if (own_memory) {
-    free(pRawData);
+    if (pRawData) {
+      MemStats::Instance().OnFree(MemStats::BUFFERS, mem_capacity);
+    }
+    HostMemPool::Instance().Free(pRawData, mem_capacity, numa_node);
   }
   pRawData = nullptr;
+  mem_capacity = 0U;
 }
 
 void* Buffer::GetRawMemPtr() { return pRawData; }
@@ -88,16 +106,31 @@ void* Buffer::GetRawMemPtr() { return pRawData; }
 const void* Buffer::GetRawMemPtr() const { return pRawData; }
 
 void Buffer::Update(size_t newSize, void* newPtr) {
-  Deallocate();
+  if (!own_memory) {
+    mem_size = newSize;
+    mem_capacity = newSize;
+    pRawData = newPtr;
+    return;
+  }
 
-  mem_size = newSize;
-  if (own_memory) {
-    Allocate();
-    if (newPtr) {
-      memcpy(GetRawMemPtr(), newPtr, newSize);
+  if (newSize > mem_capacity) {
+    /* Grow geometrically, so buffer which is updated with slowly increasing
+     * sizes (e. g. encoded packets) settles down after few reallocations;
+     */
+    auto const new_capacity =
+        std::max(newSize, mem_capacity + mem_capacity / 2U);
+    Deallocate();
+    mem_capacity = new_capacity;
+    if (!Allocate()) {
+      mem_size = 0U;
+      mem_capacity = 0U;
+      throw bad_alloc();
     }
-  } else {
-    pRawData = newPtr;
+  }
+
+  mem_size = newSize;
+  if (newPtr && newSize) {
+    memcpy(GetRawMemPtr(), newPtr, newSize);
   }
 }
 
@@ -123,6 +156,10 @@ Buffer* Buffer::MakeOwnMem(size_t bufferSize, const void* pCopyFrom) {
   return new Buffer(bufferSize, pCopyFrom);
 }
 
+Buffer* Buffer::MakeOwnMem(size_t bufferSize, int numaNode) {
+  return new Buffer(bufferSize, true, numaNode);
+}
+
 Surface* Surface::Make(Pixel_Format format) {
   switch (format) {
   case Y:
@@ -202,6 +239,19 @@ Surface* Surface::Clone() {
 
   auto newSurf = Surface::Make(PixelFormat(), Width(), Height(), Context());
 
+  if (OnHost()) {
+    for (auto i = 0U; i < NumPlanes(); i++) {
+      auto src = GetSurfacePlane(i);
+      auto dst = newSurf->GetSurfacePlane(i);
+      for (auto row = 0U; row < src.Height(); row++) {
+        memcpy((uint8_t*)dst.GpuMem() + row * dst.Pitch(),
+               (uint8_t*)src.GpuMem() + row * src.Pitch(),
+               src.Width() * src.ElemSize());
+      }
+    }
+    return newSurf;
+  }
+
   for (auto i = 0U; i < NumPlanes(); i++) {
     auto src = GetSurfacePlane(i);
     auto dst = newSurf->GetSurfacePlane(i);
@@ -250,6 +300,12 @@ bool Surface::Empty() const {
 
 CUcontext Surface::Context() { return GetSurfacePlane().Context(); }
 
+bool Surface::OnHost() const {
+  return !m_planes.empty() &&
+         std::all_of(m_planes.cbegin(), m_planes.cend(),
+                     [](const SurfacePlane& plane) { return plane.OnHost(); });
+}
+
 std::vector<size_t> Surface::Shape() {
   std::vector<size_t> shape;
 
@@ -13,6 +13,11 @@ static mutex gNppMutex;
 void SetupNppContext(int gpu_id, CUstream stream, NppStreamContext& nppCtx) {
   memset(&nppCtx, 0, sizeof(nppCtx));
 
+  // Negative GPU ID stands for host memory, NPP isn't used then.
+  if (gpu_id < 0) {
+    return;
+  }
+
   lock_guard<mutex> lock(gNppMutex);
   CudaCtxPush push(GetContextByStream(gpu_id, stream));
 
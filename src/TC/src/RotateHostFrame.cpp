@@ -0,0 +1,380 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostImage.hpp"
+#include "Tasks.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace VPF {
+static const TaskExecDetails s_success(TaskExecStatus::TASK_EXEC_SUCCESS,
+                                       TaskExecInfo::SUCCESS);
+
+static const TaskExecDetails s_fail(TaskExecStatus::TASK_EXEC_FAIL,
+                                    TaskExecInfo::FAIL);
+
+static const TaskExecDetails s_invalid_src(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid src buffer size");
+
+static const TaskExecDetails s_invalid_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid dst buffer size");
+
+static const TaskExecDetails s_invalid_src_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                               TaskExecInfo::INVALID_INPUT,
+                                               "invalid src / dst");
+
+/// @brief Opaque pixel of N bytes, quarter turns move pixels as a whole.
+template <size_t N> struct RawPixel {
+  uint8_t b[N];
+};
+
+/// @brief Side of square tile in pixels.
+/// Tile of largest (12 byte) pixels and its rotated copy fit into L1 cache.
+static constexpr uint32_t s_tile = 32U;
+
+/// @brief Rotate plane by multiple of 90 degrees.
+/// Mapping is same as NPP one with shifts chosen by PySurfaceRotator, so
+/// 90 degrees turn is counter-clockwise like numpy.rot90.
+template <typename T>
+static void QuarterTurn(const HostImage& src, const HostImage& dst,
+                        uint32_t plane, uint32_t quarters) {
+  auto const w = src.cols[plane];
+  auto const h = src.rows[plane];
+
+  if (0U == quarters) {
+    for (auto y = 0U; y < h; y++) {
+      std::memcpy(dst.Row<T>(plane, y), src.Row<T>(plane, y), w * sizeof(T));
+    }
+    return;
+  }
+
+  if (2U == quarters) {
+    for (auto y = 0U; y < h; y++) {
+      auto s = src.Row<T>(plane, y);
+      auto d = dst.Row<T>(plane, h - 1U - y);
+      for (auto x = 0U; x < w; x++) {
+        d[w - 1U - x] = s[x];
+      }
+    }
+    return;
+  }
+
+  // Transpose tile by tile. Source column of a tile is scattered over few
+  // cache lines which stay hot until whole tile is done.
+  for (auto by = 0U; by < h; by += s_tile) {
+    auto const ye = std::min(by + s_tile, h);
+    for (auto bx = 0U; bx < w; bx += s_tile) {
+      auto const xe = std::min(bx + s_tile, w);
+      for (auto x = bx; x < xe; x++) {
+        auto d = (1U == quarters) ? dst.Row<T>(plane, w - 1U - x)
+                                  : dst.Row<T>(plane, x);
+        for (auto y = by; y < ye; y++) {
+          d[(1U == quarters) ? y : h - 1U - y] = src.Row<T>(plane, y)[x];
+        }
+      }
+    }
+  }
+}
+
+typedef void (*QuarterTurnImpl)(const HostImage& src, const HostImage& dst,
+                                uint32_t plane, uint32_t quarters);
+
+static QuarterTurnImpl GetQuarterTurnImpl(size_t pixel_size) {
+  switch (pixel_size) {
+  case 1U:
+    return QuarterTurn<uint8_t>;
+  case 2U:
+    return QuarterTurn<uint16_t>;
+  case 3U:
+    return QuarterTurn<RawPixel<3U>>;
+  case 4U:
+    return QuarterTurn<uint32_t>;
+  case 6U:
+    return QuarterTurn<RawPixel<6U>>;
+  case 12U:
+    return QuarterTurn<RawPixel<12U>>;
+  default:
+    return nullptr;
+  }
+}
+
+template <typename T> static inline T Saturate(float v) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return v;
+  } else {
+    auto const max = (float)std::numeric_limits<T>::max();
+    return (T)(std::clamp(v, 0.f, max) + .5f);
+  }
+}
+
+/// @brief Remove floating point noise from coordinate.
+/// Keeps exact angles with explicit shifts on pixel grid, otherwise
+/// cos(90) residue pushes border pixels out of source.
+static inline double Snap(double v) {
+  auto const r = std::round(v);
+  return std::abs(v - r) < 1e-6 ? r : v;
+}
+
+/// @brief Rotate plane by arbitrary angle with bilinear interpolation.
+/// Follows nppiRotate: source point (x, y) goes to
+/// (x * cos + y * sin + shift_x, -x * sin + y * cos + shift_y).
+/// Destination pixels which map outside of source are left untouched.
+template <typename T, uint32_t C>
+static void Rotate(const HostImage& src, const HostImage& dst, uint32_t plane,
+                   double angle, double shift_x, double shift_y) {
+  auto const rad = angle * std::acos(-1.0) / 180.0;
+  auto const cos_a = std::cos(rad);
+  auto const sin_a = std::sin(rad);
+
+  auto const last_x = (double)src.cols[plane] - 1.0;
+  auto const last_y = (double)src.rows[plane] - 1.0;
+
+  for (auto dy = 0U; dy < dst.rows[plane]; dy++) {
+    auto d = dst.Row<T>(plane, dy);
+    auto const ry = dy - shift_y;
+
+    for (auto dx = 0U; dx < dst.cols[plane]; dx++) {
+      auto const rx = dx - shift_x;
+      auto const sx = Snap(rx * cos_a - ry * sin_a);
+      auto const sy = Snap(rx * sin_a + ry * cos_a);
+
+      if (sx < 0.0 || sy < 0.0 || sx > last_x || sy > last_y) {
+        continue;
+      }
+
+      auto const x0 = (uint32_t)sx;
+      auto const y0 = (uint32_t)sy;
+      auto const x1 = std::min(x0 + 1U, src.cols[plane] - 1U);
+      auto const y1 = std::min(y0 + 1U, src.rows[plane] - 1U);
+      auto const ax = (float)(sx - x0);
+      auto const ay = (float)(sy - y0);
+
+      auto const r0 = src.Row<T>(plane, y0);
+      auto const r1 = src.Row<T>(plane, y1);
+      for (auto c = 0U; c < C; c++) {
+        float const p00 = r0[x0 * C + c], p01 = r0[x1 * C + c];
+        float const p10 = r1[x0 * C + c], p11 = r1[x1 * C + c];
+        auto const top = p00 + (p01 - p00) * ax;
+        auto const bot = p10 + (p11 - p10) * ax;
+        d[dx * C + c] = Saturate<T>(top + (bot - top) * ay);
+      }
+    }
+  }
+}
+
+typedef void (*RotateImpl)(const HostImage& src, const HostImage& dst,
+                           uint32_t plane, double angle, double shift_x,
+                           double shift_y);
+
+static RotateImpl GetRotateImpl(bool is_float, size_t elem_size,
+                                size_t channels) {
+  if (is_float) {
+    switch (channels) {
+    case 1U:
+      return Rotate<float, 1U>;
+    case 3U:
+      return Rotate<float, 3U>;
+    default:
+      return nullptr;
+    }
+  }
+
+  if (sizeof(uint16_t) == elem_size) {
+    switch (channels) {
+    case 1U:
+      return Rotate<uint16_t, 1U>;
+    case 2U:
+      return Rotate<uint16_t, 2U>;
+    default:
+      return nullptr;
+    }
+  }
+
+  switch (channels) {
+  case 1U:
+    return Rotate<uint8_t, 1U>;
+  case 2U:
+    return Rotate<uint8_t, 2U>;
+  case 3U:
+    return Rotate<uint8_t, 3U>;
+  default:
+    return nullptr;
+  }
+}
+
+struct RotateHostFrame_Impl {
+  uint32_t m_src_width;
+  uint32_t m_src_height;
+  uint32_t m_dst_width;
+  uint32_t m_dst_height;
+  Pixel_Format m_fmt;
+
+  RotateHostFrame_Impl(uint32_t src_width, uint32_t src_height,
+                       uint32_t dst_width, uint32_t dst_height,
+                       Pixel_Format fmt)
+      : m_src_width(src_width), m_src_height(src_height),
+        m_dst_width(dst_width), m_dst_height(dst_height), m_fmt(fmt) {
+    auto const& formats = RotateHostFrame::SupportedFormats();
+    auto const is_supported =
+        std::find(formats.begin(), formats.end(), fmt) != formats.end();
+
+    if (!is_supported || !HostImage::BufferSize(fmt, src_width, src_height) ||
+        !HostImage::BufferSize(fmt, dst_width, dst_height)) {
+      std::stringstream ss;
+      ss << "Unsupported rotation params: " << GetFormatName(fmt) << " "
+         << src_width << "x" << src_height << " -> " << dst_width << "x"
+         << dst_height;
+      throw std::invalid_argument(ss.str());
+    }
+  }
+
+  void Run(double angle, double shift_x, double shift_y, const HostImage& src,
+           const HostImage& dst) {
+    auto const is_float = (RGB_32F == m_fmt || RGB_32F_PLANAR == m_fmt);
+
+    /* Same special case as in PySurfaceRotator: multiples of 90 degrees
+     * without shift change orientation. Shifts are calculated for every plane
+     * separately, so chroma planes stay in place.
+     */
+    auto const is_quarter =
+        (std::fmod(angle, 90.0) == 0.0) && (shift_x == 0.0) && (shift_y == 0.0);
+    auto const quarters = (uint32_t)(((std::lround(angle) / 90) % 4 + 4) % 4);
+
+    for (auto i = 0U; i < src.num_planes; i++) {
+      auto const src_w = src.cols[i];
+      auto const src_h = src.rows[i];
+      auto const pixel_size = src.row_size[i] / src_w;
+
+      double plane_angle = angle;
+      double plane_shift_x = shift_x * src_w / src.width;
+      double plane_shift_y = shift_y * src_h / src.height;
+
+      if (is_quarter) {
+        auto const swap = (1U == quarters % 2U);
+        auto const fits = swap ? (dst.cols[i] == src_h && dst.rows[i] == src_w)
+                               : (dst.cols[i] == src_w && dst.rows[i] == src_h);
+        auto turn = GetQuarterTurnImpl(pixel_size);
+        if (fits && turn) {
+          turn(src, dst, i, quarters);
+          continue;
+        }
+
+        plane_angle = 90.0 * quarters;
+        plane_shift_x = 0.0;
+        plane_shift_y = 0.0;
+        switch (quarters) {
+        case 1U:
+          plane_shift_y = src_w - 1.0;
+          break;
+        case 2U:
+          plane_shift_x = src_w - 1.0;
+          plane_shift_y = src_h - 1.0;
+          break;
+        case 3U:
+          plane_shift_x = src_h - 1.0;
+          break;
+        }
+      }
+
+      auto impl = GetRotateImpl(is_float, src.elem_size,
+                                pixel_size / src.elem_size);
+      if (!impl) {
+        throw std::runtime_error("RotateHostFrame: unsupported plane layout");
+      }
+      impl(src, dst, i, plane_angle, plane_shift_x, plane_shift_y);
+    }
+  }
+};
+} // namespace VPF
+
+RotateHostFrame::RotateHostFrame(uint32_t src_width, uint32_t src_height,
+                                 uint32_t dst_width, uint32_t dst_height,
+                                 Pixel_Format format)
+    : pImpl(new RotateHostFrame_Impl(src_width, src_height, dst_width,
+                                     dst_height, format)) {}
+
+RotateHostFrame::~RotateHostFrame() { delete pImpl; }
+
+size_t RotateHostFrame::GetSrcSize() const {
+  return HostImage::BufferSize(pImpl->m_fmt, pImpl->m_src_width,
+                               pImpl->m_src_height);
+}
+
+size_t RotateHostFrame::GetDstSize() const {
+  return HostImage::BufferSize(pImpl->m_fmt, pImpl->m_dst_width,
+                               pImpl->m_dst_height);
+}
+
+const std::list<Pixel_Format>& RotateHostFrame::SupportedFormats() {
+  static const std::list<Pixel_Format> formats(
+      {Y, GRAY12, RGB, BGR, RGB_PLANAR, YUV420, YUV422, YUV444, RGB_32F,
+       RGB_32F_PLANAR, YUV444_10bit, YUV420_10bit, NV12, P10});
+  return formats;
+}
+
+bool RotateHostFrame::Matches(const HostImage& src,
+                              const HostImage& dst) const {
+  return src.format == pImpl->m_fmt && dst.format == pImpl->m_fmt &&
+         src.width == pImpl->m_src_width &&
+         src.height == pImpl->m_src_height &&
+         dst.width == pImpl->m_dst_width && dst.height == pImpl->m_dst_height;
+}
+
+TaskExecDetails RotateHostFrame::Run(double angle, double shift_x,
+                                     double shift_y, Buffer& src,
+                                     Buffer& dst) {
+  auto const src_img = HostImage::Make(src, pImpl->m_fmt, pImpl->m_src_width,
+                                       pImpl->m_src_height);
+  if (!src_img) {
+    return s_invalid_src;
+  }
+
+  auto const dst_img = HostImage::Make(dst, pImpl->m_fmt, pImpl->m_dst_width,
+                                       pImpl->m_dst_height);
+  if (!dst_img) {
+    return s_invalid_dst;
+  }
+
+  return Run(angle, shift_x, shift_y, *src_img, *dst_img);
+}
+
+TaskExecDetails RotateHostFrame::Run(double angle, double shift_x,
+                                     double shift_y, const HostImage& src,
+                                     const HostImage& dst) {
+  NvtxMark tick(__FUNCTION__);
+
+  if (!Matches(src, dst)) {
+    return s_invalid_src_dst;
+  }
+
+  try {
+    pImpl->Run(angle, shift_x, shift_y, src, dst);
+  } catch (std::exception& e) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           e.what());
+  } catch (...) {
+    return s_fail;
+  }
+
+  return s_success;
+}
@@ -11,11 +11,15 @@
  * limitations under the License.
  */
 
+#include "HostImage.hpp"
 #include "MemoryInterfaces.hpp"
 #include "NppCommon.hpp"
 #include "Surfaces.hpp"
+#include "TaskStats.hpp"
 #include "Tasks.hpp"
 
+#include <algorithm>
+
 using namespace VPF;
 
 /// @brief 8 bit unsigned single channel
@@ -160,10 +164,29 @@ TaskExecInfo RotPacked(double angle, double shift_x, double shift_y,
 
 TaskExecDetails RotateSurface::Run(double angle, double shift_x, double shift_y,
                                    Surface& src, Surface& dst) {
+  static const auto stats_id =
+      TaskStats::Instance().GetCounterId("RotateSurface");
+  return TaskStats::Instance().Measure(stats_id, [&]() {
+    return RunImpl(angle, shift_x, shift_y, src, dst);
+  });
+}
+
+TaskExecDetails RotateSurface::RunImpl(double angle, double shift_x,
+                                       double shift_y, Surface& src,
+                                       Surface& dst) {
+  if (src.OnHost() != dst.OnHost()) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                           TaskExecInfo::INVALID_INPUT);
+  }
+
   if (src.PixelFormat() != dst.PixelFormat())
     return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
                            TaskExecInfo::SRC_DST_FMT_MISMATCH);
 
+  if (src.OnHost()) {
+    return RunOnHost(angle, shift_x, shift_y, src, dst);
+  }
+
   TaskExecInfo info = TaskExecInfo::SUCCESS;
   switch (src.PixelFormat()) {
   case Y:
@@ -215,4 +238,32 @@ TaskExecDetails RotateSurface::Run(double angle, double shift_x, double shift_y,
 
 RotateSurface::RotateSurface(int gpu_id, CUstream stream) : m_stream(stream) {
   SetupNppContext(gpu_id, stream, m_ctx);
+}
+
+RotateSurface::~RotateSurface() = default;
+
+TaskExecDetails RotateSurface::RunOnHost(double angle, double shift_x,
+                                         double shift_y, Surface& src,
+                                         Surface& dst) {
+  auto const& formats = RotateHostFrame::SupportedFormats();
+  if (std::find(formats.begin(), formats.end(), src.PixelFormat()) ==
+      formats.end()) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                           TaskExecInfo::NOT_SUPPORTED);
+  }
+
+  auto const src_img = HostImage::Make(src);
+  auto const dst_img = HostImage::Make(dst);
+  if (!src_img || !dst_img) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                           TaskExecInfo::INVALID_INPUT);
+  }
+
+  if (!m_host || !m_host->Matches(*src_img, *dst_img)) {
+    m_host = std::make_unique<RotateHostFrame>(src.Width(), src.Height(),
+                                               dst.Width(), dst.Height(),
+                                               src.PixelFormat());
+  }
+
+  return m_host->Run(angle, shift_x, shift_y, *src_img, *dst_img);
 }
\ No newline at end of file
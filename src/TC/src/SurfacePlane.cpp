@@ -12,6 +12,7 @@
  * limitations under the License.
  */
 
+#include "HostMemPool.hpp"
 #include "MemoryInterfaces.hpp"
 #include <cstring>
 #include <sstream>
@@ -19,6 +20,10 @@
 
 namespace VPF {
 
+/* Host memory rows are aligned to cache line size;
+ */
+static constexpr size_t s_host_pitch_alignment = 64U;
+
 static void DLManagedTensor_Destroy(DLManagedTensor* self) {
   if (!self) {
     return;
@@ -93,8 +98,8 @@ SurfacePlane::SurfacePlane(const DLManagedTensor& dlmt) {
   }
 
   auto const device_type = dlmt.dl_tensor.device.device_type;
-  if (device_type != kDLCUDA) {
-    throw std::runtime_error("Only kDLCUDA tensors are supported.");
+  if (device_type != kDLCUDA && device_type != kDLCPU) {
+    throw std::runtime_error("Only kDLCUDA and kDLCPU tensors are supported.");
   }
 
   if (dlmt.dl_tensor.dtype.lanes != 1) {
@@ -111,8 +116,11 @@ SurfacePlane::SurfacePlane(const DLManagedTensor& dlmt) {
   m_elem_size = dlmt.dl_tensor.dtype.bits / 8;
   m_width = dlmt.dl_tensor.shape[1];
   m_height = dlmt.dl_tensor.shape[0];
-  m_pitch = dlmt.dl_tensor.strides[0] * m_elem_size;
+  // Null strides mean compact row-major tensor;
+  m_pitch = dlmt.dl_tensor.strides ? dlmt.dl_tensor.strides[0] * m_elem_size
+                                   : m_width * m_elem_size;
   m_dlpack_ctx.m_type_code = (DLDataTypeCode)dlmt.dl_tensor.dtype.code;
+  m_dlpack_ctx.m_device_type = (DLDeviceType)device_type;
   m_dlpack_ctx.m_ptr =
       (CUdeviceptr)dlmt.dl_tensor.data + dlmt.dl_tensor.byte_offset;
 }
@@ -188,6 +196,11 @@ void SurfacePlane::Allocate(CUcontext context, bool pitched) {
     throw std::runtime_error("Can't allocate memory without ownership.");
   }
 
+  if (IsHostContext(context)) {
+    AllocateHost(pitched);
+    return;
+  }
+
   CUdeviceptr gpu_mem = 0U;
   CudaCtxPush ctxPush(context);
   if (pitched) {
@@ -212,6 +225,24 @@ void SurfacePlane::Allocate(CUcontext context, bool pitched) {
   });
 }
 
+void SurfacePlane::AllocateHost(bool pitched) {
+  auto const row_size = m_width * ElemSize();
+  m_pitch = pitched ? (row_size + s_host_pitch_alignment - 1U) /
+                          s_host_pitch_alignment * s_host_pitch_alignment
+                    : row_size;
+
+  auto const size = m_pitch * m_height;
+  auto host_mem = HostMemPool::Instance().Allocate(size);
+  if (!host_mem) {
+    throw std::runtime_error("Failed to allocate host memory.");
+  }
+
+  m_own_gpu_mem = std::shared_ptr<void>(host_mem, [size](void* ptr) {
+    HostMemPool::Instance().Free(ptr, size);
+  });
+  m_dlpack_ctx.m_device_type = kDLCPU;
+}
+
 void SurfacePlane::MakeBlank() noexcept {
   try {
     m_own_gpu_mem.reset();
@@ -243,7 +274,7 @@ bool SurfacePlane::IsValid() const noexcept {
 
 DLManagedTensor* SurfacePlane::DLPackContext::ToDLPack(
     uint32_t width, uint32_t height, uint32_t pitch, uint32_t elem_size,
-    CUdeviceptr dptr, DLDataTypeCode type_code) {
+    CUdeviceptr dptr, DLDataTypeCode type_code, DLDeviceType device_type) {
   DLManagedTensor* dlmt = nullptr;
   try {
     dlmt = new DLManagedTensor();
@@ -252,9 +283,15 @@ DLManagedTensor* SurfacePlane::DLPackContext::ToDLPack(
     dlmt->manager_ctx = nullptr;
     dlmt->deleter = DLManagedTensor_Destroy;
 
-    dlmt->dl_tensor.device.device_type = kDLCUDA;
-    dlmt->dl_tensor.device.device_id = GetDeviceIdByDptr(dptr);
-    dlmt->dl_tensor.data = (void*)GetDevicePointer(dptr);
+    if (kDLCPU == device_type) {
+      dlmt->dl_tensor.device.device_type = kDLCPU;
+      dlmt->dl_tensor.device.device_id = 0;
+      dlmt->dl_tensor.data = (void*)dptr;
+    } else {
+      dlmt->dl_tensor.device.device_type = kDLCUDA;
+      dlmt->dl_tensor.device.device_id = GetDeviceIdByDptr(dptr);
+      dlmt->dl_tensor.data = (void*)GetDevicePointer(dptr);
+    }
     dlmt->dl_tensor.ndim = 2;
     dlmt->dl_tensor.byte_offset = 0U;
 
@@ -282,9 +319,9 @@ DLManagedTensor* SurfacePlane::DLPackContext::ToDLPack(
 
 std::shared_ptr<DLManagedTensor> SurfacePlane::DLPackContext::ToDLPackSmart(
     uint32_t width, uint32_t height, uint32_t pitch, uint32_t elem_size,
-    CUdeviceptr dptr, DLDataTypeCode type_code) {
+    CUdeviceptr dptr, DLDataTypeCode type_code, DLDeviceType device_type) {
   auto dlmt_ptr = SurfacePlane::DLPackContext::ToDLPack(
-      width, height, pitch, elem_size, dptr, type_code);
+      width, height, pitch, elem_size, dptr, type_code, device_type);
 
   return std::shared_ptr<DLManagedTensor>(dlmt_ptr, dlmt_ptr->deleter);
 }
@@ -294,9 +331,9 @@ DLManagedTensor* SurfacePlane::ToDLPack() {
     throw std::runtime_error("Cant put DLPack SurfacePlane to DLPack");
   }
 
-  return SurfacePlane::DLPackContext::ToDLPack(Width(), Height(), Pitch(),
-                                               ElemSize(), GpuMem(),
-                                               m_dlpack_ctx.DataType());
+  return SurfacePlane::DLPackContext::ToDLPack(
+      Width(), Height(), Pitch(), ElemSize(), GpuMem(),
+      m_dlpack_ctx.DataType(), m_dlpack_ctx.DeviceType());
 }
 
 std::shared_ptr<DLManagedTensor> SurfacePlane::ToDLPackSmart() {
@@ -320,9 +357,13 @@ CUdeviceptr SurfacePlane::GpuMem() const noexcept {
   }
 }
 
-CUcontext SurfacePlane::Context() const { return GetContextByDptr(GpuMem()); }
+CUcontext SurfacePlane::Context() const {
+  return OnHost() ? HostContext() : GetContextByDptr(GpuMem());
+}
 
-int SurfacePlane::DeviceId() const { return GetDeviceIdByDptr(GpuMem()); }
+int SurfacePlane::DeviceId() const {
+  return OnHost() ? 0 : GetDeviceIdByDptr(GpuMem());
+}
 
 std::shared_ptr<void> SurfacePlane::GpuMemImpl() const {
   return OwnMemory() ? m_own_gpu_mem : m_borrowed_gpu_mem.lock();
@@ -366,6 +407,12 @@ void SurfacePlane::ToCAI(CudaArrayInterfaceDescriptor& cai) {
   cai.m_ptr = GpuMem();
   cai.m_read_only = false;
 
+  // Host memory needs no synchronization;
+  if (OnHost()) {
+    cai.m_stream = 0;
+    return;
+  }
+
   const auto device_id = GetDeviceIdByDptr(cai.m_ptr);
   cai.m_stream = CudaResMgr::Instance().GetStream(device_id);
 }
@@ -1,9 +1,11 @@
 #include "Tasks.hpp"
 #include "Utils.hpp"
 #include <memory>
+#include <optional>
 #include <stdexcept>
 
 extern "C" {
+#include <libavutil/imgutils.h>
 #include <libswscale/swscale.h>
 }
 
@@ -11,22 +13,98 @@ namespace VPF {
 struct ConvertFrame_Impl {
   const AVPixelFormat m_src_fmt, m_dst_fmt;
   size_t m_width, m_height;
+  size_t m_src_size, m_dst_size;
 
   std::shared_ptr<SwsContext> m_ctx = nullptr;
 
+  // Colorspace details are set only when conversion context changes.
+  std::optional<ColorspaceConversionContext> m_cc_ctx;
+
   ConvertFrame_Impl(uint32_t width, uint32_t height, Pixel_Format in_Format,
                     Pixel_Format out_Format)
       : m_src_fmt(toFfmpegPixelFormat(in_Format)),
         m_dst_fmt(toFfmpegPixelFormat(out_Format)), m_width(width),
         m_height(height) {
-    m_ctx.reset(sws_getContext(m_width, m_height, m_src_fmt, width, height,
-                               m_dst_fmt, SWS_BILINEAR, nullptr, nullptr,
-                               nullptr),
-                [](auto* p) { sws_freeContext(p); });
+    m_ctx = makeSwsContext(m_width, m_height, m_src_fmt, width, height,
+                           m_dst_fmt, SWS_BILINEAR);
 
     if (!m_ctx) {
       throw std::runtime_error("ConvertFrame: sws_getContext failed");
     }
+
+    m_src_size = getBufferSize(width, height, m_src_fmt);
+    m_dst_size = getBufferSize(width, height, m_dst_fmt);
+  }
+
+  bool SetColorspace(const ColorspaceConversionContext& cc_ctx) {
+    if (m_cc_ctx && m_cc_ctx->color_space == cc_ctx.color_space &&
+        m_cc_ctx->color_range == cc_ctx.color_range) {
+      return true;
+    }
+
+    auto const colorSpace = toFfmpegColorSpace(cc_ctx.color_space);
+    auto const isJpegRange =
+        (toFfmpegColorRange(cc_ctx.color_range) == AVCOL_RANGE_JPEG);
+    auto const brightness = 0U, contrast = 1U << 16U, saturation = 1U << 16U;
+    auto err = sws_setColorspaceDetails(
+        m_ctx.get(), sws_getCoefficients(colorSpace), isJpegRange,
+        sws_getCoefficients(colorSpace), isJpegRange, brightness, contrast,
+        saturation);
+    if (err < 0) {
+      m_cc_ctx.reset();
+      return false;
+    }
+
+    m_cc_ctx = cc_ctx;
+    return true;
+  }
+
+  /* Plane pointers live on stack, so conversion does no heap allocation;
+   */
+  TaskExecDetails Convert(const Buffer& src, Buffer& dst,
+                          const ColorspaceConversionContext& cc_ctx) {
+    if (src.GetRawMemSize() < m_src_size || dst.GetRawMemSize() < m_dst_size) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::SRC_DST_SIZE_MISMATCH,
+                             "buffer is too small");
+    }
+
+    uint8_t* src_data[4] = {};
+    uint8_t* dst_data[4] = {};
+    int src_linesize[4] = {};
+    int dst_linesize[4] = {};
+    auto const alignment = 1U;
+
+    auto err = av_image_fill_arrays(src_data, src_linesize,
+                                    src.GetDataAs<uint8_t>(), m_src_fmt,
+                                    m_width, m_height, alignment);
+    if (err >= 0) {
+      err = av_image_fill_arrays(dst_data, dst_linesize,
+                                 dst.GetDataAs<uint8_t>(), m_dst_fmt, m_width,
+                                 m_height, alignment);
+    }
+
+    if (err < 0) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                             AvErrorToString(err));
+    }
+
+    if (!SetColorspace(cc_ctx)) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                             "unsupported cconv params");
+    }
+
+    err = sws_scale(m_ctx.get(), src_data, src_linesize, 0, m_height,
+                    dst_data, dst_linesize);
+    if (err < 0) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                             AvErrorToString(err));
+    }
+
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_SUCCESS,
+                           TaskExecInfo::SUCCESS);
   }
 };
 }; // namespace VPF
@@ -48,6 +126,7 @@ ConvertFrame* ConvertFrame::Make(uint32_t width, uint32_t height,
 }
 
 TaskExecDetails ConvertFrame::Run() {
+  NvtxMark tick(GetName());
   ClearOutputs();
   try {
     auto src_buf = dynamic_cast<Buffer*>(GetInput(0));
@@ -68,40 +147,12 @@ TaskExecDetails ConvertFrame::Run() {
                              TaskExecInfo::INVALID_INPUT, "empty cc_ctx");
     }
 
-    auto src_frame =
-        asAVFrame(src_buf, pImpl->m_width, pImpl->m_height, pImpl->m_src_fmt);
-
-    auto dst_frame =
-        asAVFrame(dst_buf, pImpl->m_width, pImpl->m_height, pImpl->m_dst_fmt);
-
     auto pCtx = ctx_buf->GetDataAs<ColorspaceConversionContext>();
-
-    auto const colorSpace = toFfmpegColorSpace(pCtx->color_space);
-    auto const isJpegRange =
-        (toFfmpegColorRange(pCtx->color_range) == AVCOL_RANGE_JPEG);
-    auto const brightness = 0U, contrast = 1U << 16U, saturation = 1U << 16U;
-    auto err = sws_setColorspaceDetails(
-        pImpl->m_ctx.get(), sws_getCoefficients(colorSpace), isJpegRange,
-        sws_getCoefficients(colorSpace), isJpegRange, brightness, contrast,
-        saturation);
-    if (err < 0) {
-      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
-                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
-                             "unsupported cconv params");
+    auto ret = pImpl->Convert(*src_buf, *dst_buf, *pCtx);
+    if (TaskExecStatus::TASK_EXEC_SUCCESS == ret.m_status) {
+      SetOutput(dst_buf, 0U);
     }
-
-    err = sws_scale(pImpl->m_ctx.get(), src_frame->data, src_frame->linesize, 0,
-                    pImpl->m_height, dst_frame->data, dst_frame->linesize);
-    if (err < 0) {
-      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
-                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
-                             AvErrorToString(err));
-    }
-
-    SetOutput(dst_buf, 0U);
-
-    return TaskExecDetails(TaskExecStatus::TASK_EXEC_SUCCESS,
-                           TaskExecInfo::SUCCESS);
+    return ret;
   } catch (std::exception& e) {
     return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
                            e.what());
@@ -109,4 +160,20 @@ TaskExecDetails ConvertFrame::Run() {
     return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
                            "unknown exception");
   }
-}
\ No newline at end of file
+}
+
+TypedConvertFrame::TypedConvertFrame(uint32_t width, uint32_t height,
+                                     Pixel_Format src_fmt,
+                                     Pixel_Format dst_fmt)
+    : TypedTask("FfmpegConvertFrame") {
+  pImpl = new ConvertFrame_Impl(width, height, src_fmt, dst_fmt);
+}
+
+TypedConvertFrame::~TypedConvertFrame() { delete pImpl; }
+
+TaskExecDetails
+TypedConvertFrame::Run(const Buffer& src, Buffer& dst,
+                       const ColorspaceConversionContext& cc_ctx) {
+  NvtxMark tick(GetName());
+  return pImpl->Convert(src, dst, cc_ctx);
+}
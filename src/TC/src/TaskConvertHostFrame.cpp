@@ -0,0 +1,646 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostImage.hpp"
+#include "Tasks.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace VPF {
+static const TaskExecDetails s_success(TaskExecStatus::TASK_EXEC_SUCCESS,
+                                       TaskExecInfo::SUCCESS);
+
+static const TaskExecDetails s_invalid_src(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid src buffer size");
+
+static const TaskExecDetails s_invalid_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid dst buffer size");
+
+static const TaskExecDetails s_invalid_src_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                               TaskExecInfo::INVALID_INPUT,
+                                               "invalid src / dst");
+
+static const TaskExecDetails
+    s_unsupp_cc_ctx(TaskExecStatus::TASK_EXEC_FAIL,
+                    TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                    "unsupported cc_ctx params");
+
+/// @brief YUV to RGB conversion coefficients:
+/// R = ky * (Y - y_off) + rv * (V - 128)
+/// G = ky * (Y - y_off) - gu * (U - 128) - gv * (V - 128)
+/// B = ky * (Y - y_off) + bu * (U - 128)
+struct YuvToRgbCoeffs {
+  float ky;
+  float y_off;
+  float rv;
+  float gu;
+  float gv;
+  float bu;
+};
+
+// Same as nppiYUVToRGB family
+static const YuvToRgbCoeffs s_yuv_rgb_601 = {1.f,    0.f,    1.140f,
+                                             0.394f, 0.581f, 2.032f};
+
+// Same as nppiYCbCrToRGB family
+static const YuvToRgbCoeffs s_ycbcr_rgb_601 = {1.164f, 16.f,   1.596f,
+                                               0.392f, 0.813f, 2.017f};
+
+// Same as nppiNV12ToRGB_709HDTV
+static const YuvToRgbCoeffs s_yuv_rgb_709 = {1.f,     0.f,     1.5748f,
+                                             0.1873f, 0.4681f, 1.8556f};
+
+// Same as nppiNV12ToRGB_709CSC
+static const YuvToRgbCoeffs s_ycbcr_rgb_709 = {1.164f, 16.f,   1.793f,
+                                               0.213f, 0.533f, 2.112f};
+
+/// @brief RGB to YUV conversion coefficients, rows are Y, U, V.
+/// Chroma gets +128 offset, luma gets y_off offset.
+struct RgbToYuvCoeffs {
+  float m[3][3];
+  float y_off;
+};
+
+// Same as nppiRGBToYUV family
+static const RgbToYuvCoeffs s_rgb_yuv_601 = {{{0.299f, 0.587f, 0.114f},
+                                              {-0.147f, -0.289f, 0.436f},
+                                              {0.615f, -0.515f, -0.100f}},
+                                             0.f};
+
+// Same as nppiRGBToYCbCr family
+static const RgbToYuvCoeffs s_rgb_ycbcr_601 = {{{0.257f, 0.504f, 0.098f},
+                                                {-0.148f, -0.291f, 0.439f},
+                                                {0.439f, -0.368f, -0.071f}},
+                                               16.f};
+
+// Same as nppiRGBToGray
+static const float s_rgb_gray[3] = {0.299f, 0.587f, 0.114f};
+
+static inline uint8_t Sat(float v) {
+  return (uint8_t)std::min(std::max(v + 0.5f, 0.f), 255.f);
+}
+
+/* Row kernels.
+ * Step template parameters are distances between neighbour pixels values,
+ * they are known at compile time so loops get vectorized.
+ */
+template <int UV_STEP, int UV_SHIFT, int DST_STEP>
+static void YuvToRgbRow(const uint8_t* __restrict y,
+                        const uint8_t* __restrict u,
+                        const uint8_t* __restrict v, RgbRow<uint8_t> dst,
+                        uint32_t width, const YuvToRgbCoeffs& k) {
+  for (uint32_t x = 0U; x < width; x++) {
+    auto const c = (x >> UV_SHIFT) * UV_STEP;
+    auto const l = k.ky * ((float)y[x] - k.y_off);
+    auto const cb = (float)u[c] - 128.f;
+    auto const cr = (float)v[c] - 128.f;
+
+    dst.r[x * DST_STEP] = Sat(l + k.rv * cr);
+    dst.g[x * DST_STEP] = Sat(l - k.gu * cb - k.gv * cr);
+    dst.b[x * DST_STEP] = Sat(l + k.bu * cb);
+  }
+}
+
+template <int SRC_STEP>
+static void RgbToYuvRow(RgbRow<const uint8_t> src, uint8_t* __restrict y,
+                        uint8_t* __restrict u, uint8_t* __restrict v,
+                        uint32_t width, const RgbToYuvCoeffs& k) {
+  for (uint32_t x = 0U; x < width; x++) {
+    float const r = src.r[x * SRC_STEP];
+    float const g = src.g[x * SRC_STEP];
+    float const b = src.b[x * SRC_STEP];
+
+    y[x] = Sat(k.m[0][0] * r + k.m[0][1] * g + k.m[0][2] * b + k.y_off);
+    u[x] = Sat(k.m[1][0] * r + k.m[1][1] * g + k.m[1][2] * b + 128.f);
+    v[x] = Sat(k.m[2][0] * r + k.m[2][1] * g + k.m[2][2] * b + 128.f);
+  }
+}
+
+template <int SRC_STEP>
+static void RgbToGrayRow(RgbRow<const uint8_t> src, uint8_t* __restrict y,
+                         uint32_t width, const float (&k)[3], float y_off) {
+  for (uint32_t x = 0U; x < width; x++) {
+    y[x] = Sat(k[0] * src.r[x * SRC_STEP] + k[1] * src.g[x * SRC_STEP] +
+               k[2] * src.b[x * SRC_STEP] + y_off);
+  }
+}
+
+template <typename SRC, typename DST, int SRC_STEP, int DST_STEP>
+static void CopyRgbRow(RgbRow<const SRC> src, RgbRow<DST> dst, uint32_t width,
+                       float scale) {
+  for (uint32_t x = 0U; x < width; x++) {
+    dst.r[x * DST_STEP] = (DST)(src.r[x * SRC_STEP] * scale);
+    dst.g[x * DST_STEP] = (DST)(src.g[x * SRC_STEP] * scale);
+    dst.b[x * DST_STEP] = (DST)(src.b[x * SRC_STEP] * scale);
+  }
+}
+
+template <int SHIFT, int DST_STEP>
+static void NarrowRow(const uint16_t* __restrict src, uint8_t* __restrict dst,
+                      size_t count) {
+  for (size_t x = 0U; x < count; x++) {
+    auto const val = ((uint32_t)src[x] + (1U << (SHIFT - 1))) >> SHIFT;
+    dst[x * DST_STEP] = (uint8_t)std::min(val, 255U);
+  }
+}
+
+/* Frame kernels.
+ */
+template <int UV_STEP, int UV_SHIFT, int DST_STEP>
+static void YuvToRgb(const HostImage& src, const HostImage& dst,
+                     const YuvToRgbCoeffs& k) {
+  for (uint32_t row = 0U; row < src.height; row++) {
+    auto const c_row = row >> UV_SHIFT;
+    auto const u = src.Row<const uint8_t>(1U, c_row);
+    auto const v = 2 == UV_STEP ? u + 1 : src.Row<const uint8_t>(2U, c_row);
+    YuvToRgbRow<UV_STEP, UV_SHIFT, DST_STEP>(
+        src.Row<const uint8_t>(0U, row), u, v, RgbRowOf<uint8_t>(dst, row),
+        src.width, k);
+  }
+}
+
+template <int SRC_STEP>
+static void RgbToYuv444(const HostImage& src, const HostImage& dst,
+                        const RgbToYuvCoeffs& k) {
+  for (uint32_t row = 0U; row < src.height; row++) {
+    RgbToYuvRow<SRC_STEP>(RgbRowOf<const uint8_t>(src, row),
+                          dst.Row<uint8_t>(0U, row), dst.Row<uint8_t>(1U, row),
+                          dst.Row<uint8_t>(2U, row), src.width, k);
+  }
+}
+
+static void RgbToYuv420(const HostImage& src, const HostImage& dst,
+                        const RgbToYuvCoeffs& k) {
+  for (uint32_t row = 0U; row < src.height; row++) {
+    RgbToGrayRow<3>(RgbRowOf<const uint8_t>(src, row),
+                    dst.Row<uint8_t>(0U, row), src.width, k.m[0], k.y_off);
+  }
+
+  // Chroma is taken from 2x2 block average. Last row and column are
+  // replicated for odd frame size.
+  for (uint32_t c_row = 0U; c_row < dst.rows[1]; c_row++) {
+    auto const top = RgbRowOf<const uint8_t>(src, 2U * c_row);
+    auto const bot = RgbRowOf<const uint8_t>(
+        src, std::min(2U * c_row + 1U, src.height - 1U));
+    auto u = dst.Row<uint8_t>(1U, c_row);
+    auto v = dst.Row<uint8_t>(2U, c_row);
+
+    for (uint32_t c = 0U; c < dst.row_size[1]; c++) {
+      auto const x0 = 2U * c * 3U;
+      auto const x1 = std::min(2U * c + 1U, src.width - 1U) * 3U;
+      float const r = (top.r[x0] + top.r[x1] + bot.r[x0] + bot.r[x1]) * .25f;
+      float const g = (top.g[x0] + top.g[x1] + bot.g[x0] + bot.g[x1]) * .25f;
+      float const b = (top.b[x0] + top.b[x1] + bot.b[x0] + bot.b[x1]) * .25f;
+
+      u[c] = Sat(k.m[1][0] * r + k.m[1][1] * g + k.m[1][2] * b + 128.f);
+      v[c] = Sat(k.m[2][0] * r + k.m[2][1] * g + k.m[2][2] * b + 128.f);
+    }
+  }
+}
+
+template <typename SRC, typename DST>
+static void CopyRgb(const HostImage& src, const HostImage& dst,
+                    float scale = 1.f) {
+  auto const src_planar = IsPlanarRgb(src.format);
+  auto const dst_planar = IsPlanarRgb(dst.format);
+
+  for (uint32_t row = 0U; row < src.height; row++) {
+    auto const in = RgbRowOf<const SRC>(src, row);
+    auto const out = RgbRowOf<DST>(dst, row);
+
+    if (src_planar) {
+      CopyRgbRow<SRC, DST, 1, 3>(in, out, src.width, scale);
+    } else if (dst_planar) {
+      CopyRgbRow<SRC, DST, 3, 1>(in, out, src.width, scale);
+    } else {
+      CopyRgbRow<SRC, DST, 3, 3>(in, out, src.width, scale);
+    }
+  }
+}
+
+static void CopyPlane(const HostImage& src, uint32_t src_plane,
+                      const HostImage& dst, uint32_t dst_plane) {
+  for (uint32_t row = 0U; row < src.rows[src_plane]; row++) {
+    std::memcpy(dst.Row<uint8_t>(dst_plane, row),
+                src.Row<uint8_t>(src_plane, row), src.row_size[src_plane]);
+  }
+}
+
+/* Conversion functions.
+ * Color space and range handling mirrors TaskConvertSurface.cpp.
+ */
+typedef TaskExecDetails (*HostConvImpl)(
+    const HostImage& src, const HostImage& dst,
+    std::optional<ColorspaceConversionContext> cc_ctx);
+
+static TaskExecDetails
+nv12_rgb(const HostImage& src, const HostImage& dst,
+         std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  auto const color_space = cc_ctx ? cc_ctx->color_space : BT_709;
+  auto const color_range = cc_ctx ? cc_ctx->color_range : JPEG;
+
+  const YuvToRgbCoeffs* k = nullptr;
+  switch (color_space) {
+  case BT_709:
+    k = (JPEG == color_range) ? &s_yuv_rgb_709 : &s_ycbcr_rgb_709;
+    break;
+  case BT_601:
+    if (JPEG == color_range) {
+      k = &s_yuv_rgb_601;
+    } else {
+      return s_unsupp_cc_ctx;
+    }
+    break;
+  default:
+    return s_unsupp_cc_ctx;
+  }
+
+  YuvToRgb<2, 1, 3>(src, dst, *k);
+  return s_success;
+}
+
+static TaskExecDetails
+yuv420_rgb(const HostImage& src, const HostImage& dst,
+           std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  auto const color_space = cc_ctx ? cc_ctx->color_space : BT_601;
+  auto const color_range = cc_ctx ? cc_ctx->color_range : JPEG;
+
+  if (BT_601 != color_space) {
+    return s_unsupp_cc_ctx;
+  }
+
+  YuvToRgb<1, 1, 3>(src, dst,
+                    JPEG == color_range ? s_yuv_rgb_601 : s_ycbcr_rgb_601);
+  return s_success;
+}
+
+static TaskExecDetails
+yuv444_bgr(const HostImage& src, const HostImage& dst,
+           std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  auto const color_space = cc_ctx ? cc_ctx->color_space : BT_601;
+  auto const color_range = cc_ctx ? cc_ctx->color_range : JPEG;
+
+  if (BT_601 != color_space) {
+    return s_unsupp_cc_ctx;
+  }
+
+  switch (color_range) {
+  case MPEG:
+    YuvToRgb<1, 0, 3>(src, dst, s_ycbcr_rgb_601);
+    break;
+  case JPEG:
+    YuvToRgb<1, 0, 3>(src, dst, s_yuv_rgb_601);
+    break;
+  default:
+    return s_unsupp_cc_ctx;
+  }
+
+  return s_success;
+}
+
+static TaskExecDetails
+yuv444_rgb(const HostImage& src, const HostImage& dst,
+           std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  auto const color_space = cc_ctx ? cc_ctx->color_space : BT_601;
+  auto const color_range = cc_ctx ? cc_ctx->color_range : JPEG;
+
+  // NPP has full range YUV444 -> RGB conversion only.
+  if (BT_601 != color_space || JPEG != color_range) {
+    return s_unsupp_cc_ctx;
+  }
+
+  if (IsPlanarRgb(dst.format)) {
+    YuvToRgb<1, 0, 1>(src, dst, s_yuv_rgb_601);
+  } else {
+    YuvToRgb<1, 0, 3>(src, dst, s_yuv_rgb_601);
+  }
+  return s_success;
+}
+
+static TaskExecDetails
+rgb_yuv444(const HostImage& src, const HostImage& dst,
+           std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  auto const color_space = cc_ctx ? cc_ctx->color_space : BT_601;
+  auto const color_range = cc_ctx ? cc_ctx->color_range : JPEG;
+
+  if (BT_601 != color_space) {
+    return s_unsupp_cc_ctx;
+  }
+
+  const RgbToYuvCoeffs* k = nullptr;
+  switch (color_range) {
+  case JPEG:
+    k = &s_rgb_yuv_601;
+    break;
+  case MPEG:
+    k = &s_rgb_ycbcr_601;
+    break;
+  default:
+    return s_unsupp_cc_ctx;
+  }
+
+  if (IsPlanarRgb(src.format)) {
+    RgbToYuv444<1>(src, dst, *k);
+  } else {
+    RgbToYuv444<3>(src, dst, *k);
+  }
+  return s_success;
+}
+
+static TaskExecDetails
+rgb_yuv420(const HostImage& src, const HostImage& dst,
+           std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  auto const color_space = cc_ctx ? cc_ctx->color_space : BT_601;
+  auto const color_range = cc_ctx ? cc_ctx->color_range : JPEG;
+
+  if (BT_601 != color_space) {
+    return s_unsupp_cc_ctx;
+  }
+
+  switch (color_range) {
+  case JPEG:
+    RgbToYuv420(src, dst, s_rgb_yuv_601);
+    break;
+  case MPEG:
+    RgbToYuv420(src, dst, s_rgb_ycbcr_601);
+    break;
+  default:
+    return s_unsupp_cc_ctx;
+  }
+
+  return s_success;
+}
+
+static TaskExecDetails
+rgb8_y(const HostImage& src, const HostImage& dst,
+       std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  for (uint32_t row = 0U; row < src.height; row++) {
+    RgbToGrayRow<3>(RgbRowOf<const uint8_t>(src, row),
+                    dst.Row<uint8_t>(0U, row), src.width, s_rgb_gray, 0.f);
+  }
+  return s_success;
+}
+
+static TaskExecDetails
+nv12_yuv420(const HostImage& src, const HostImage& dst,
+            std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  auto const color_range = cc_ctx ? cc_ctx->color_range : JPEG;
+  if (JPEG != color_range && MPEG != color_range) {
+    return s_unsupp_cc_ctx;
+  }
+
+  CopyPlane(src, 0U, dst, 0U);
+  for (uint32_t row = 0U; row < dst.rows[1]; row++) {
+    auto uv = src.Row<const uint8_t>(1U, row);
+    auto u = dst.Row<uint8_t>(1U, row);
+    auto v = dst.Row<uint8_t>(2U, row);
+    for (size_t x = 0U; x < dst.row_size[1]; x++) {
+      u[x] = uv[2 * x];
+      v[x] = uv[2 * x + 1];
+    }
+  }
+  return s_success;
+}
+
+static TaskExecDetails
+yuv420_nv12(const HostImage& src, const HostImage& dst,
+            std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  CopyPlane(src, 0U, dst, 0U);
+  for (uint32_t row = 0U; row < src.rows[1]; row++) {
+    auto u = src.Row<const uint8_t>(1U, row);
+    auto v = src.Row<const uint8_t>(2U, row);
+    auto uv = dst.Row<uint8_t>(1U, row);
+    for (size_t x = 0U; x < src.row_size[1]; x++) {
+      uv[2 * x] = u[x];
+      uv[2 * x + 1] = v[x];
+    }
+  }
+  return s_success;
+}
+
+static TaskExecDetails
+p16_nv12(const HostImage& src, const HostImage& dst,
+         std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  // Take 8 most significant bits. P10 is stored as P010 with MSB aligned
+  // values, P12 is stored as 3-plane 4:2:0 with LSB aligned values.
+  if (P10 == src.format) {
+    for (auto plane = 0U; plane < 2U; plane++) {
+      for (uint32_t row = 0U; row < src.rows[plane]; row++) {
+        NarrowRow<8, 1>(src.Row<const uint16_t>(plane, row),
+                        dst.Row<uint8_t>(plane, row), dst.row_size[plane]);
+      }
+    }
+    return s_success;
+  }
+
+  for (uint32_t row = 0U; row < src.height; row++) {
+    NarrowRow<4, 1>(src.Row<const uint16_t>(0U, row),
+                    dst.Row<uint8_t>(0U, row), dst.row_size[0]);
+  }
+
+  for (uint32_t row = 0U; row < src.rows[1]; row++) {
+    auto uv = dst.Row<uint8_t>(1U, row);
+    auto const count = dst.row_size[1] / 2U;
+    NarrowRow<4, 2>(src.Row<const uint16_t>(1U, row), uv, count);
+    NarrowRow<4, 2>(src.Row<const uint16_t>(2U, row), uv + 1, count);
+  }
+  return s_success;
+}
+
+static TaskExecDetails
+nv12_y(const HostImage& src, const HostImage& dst,
+       std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  CopyPlane(src, 0U, dst, 0U);
+  return s_success;
+}
+
+static TaskExecDetails
+y_yuv444(const HostImage& src, const HostImage& dst,
+         std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  CopyPlane(src, 0U, dst, 0U);
+
+  // Make gray U and V channels;
+  for (auto plane = 1U; plane < dst.num_planes; plane++) {
+    for (uint32_t row = 0U; row < dst.rows[plane]; row++) {
+      std::memset(dst.Row<uint8_t>(plane, row), 128, dst.row_size[plane]);
+    }
+  }
+  return s_success;
+}
+
+static TaskExecDetails
+rgb8_shuffle(const HostImage& src, const HostImage& dst,
+             std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  CopyRgb<uint8_t, uint8_t>(src, dst);
+  return s_success;
+}
+
+static TaskExecDetails
+rgb8_rgb32f(const HostImage& src, const HostImage& dst,
+            std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  CopyRgb<uint8_t, float>(src, dst, 1.f / 255.f);
+  return s_success;
+}
+
+static TaskExecDetails
+rgb32f_deinterleave(const HostImage& src, const HostImage& dst,
+                    std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  CopyRgb<float, float>(src, dst);
+  return s_success;
+}
+
+static const std::vector<std::tuple<Pixel_Format, Pixel_Format, HostConvImpl>>
+    s_conversions({{NV12, YUV420, nv12_yuv420},
+                   {YUV420, NV12, yuv420_nv12},
+                   {P10, NV12, p16_nv12},
+                   {P12, NV12, p16_nv12},
+                   {NV12, RGB, nv12_rgb},
+                   {NV12, BGR, nv12_rgb},
+                   {RGB, RGB_PLANAR, rgb8_shuffle},
+                   {RGB_PLANAR, RGB, rgb8_shuffle},
+                   {RGB_PLANAR, YUV444, rgb_yuv444},
+                   {Y, YUV444, y_yuv444},
+                   {YUV420, RGB, yuv420_rgb},
+                   {RGB, YUV420, rgb_yuv420},
+                   {RGB, YUV444, rgb_yuv444},
+                   {RGB, BGR, rgb8_shuffle},
+                   {BGR, RGB, rgb8_shuffle},
+                   {YUV420, BGR, yuv420_rgb},
+                   {YUV444, BGR, yuv444_bgr},
+                   {YUV444, RGB, yuv444_rgb},
+                   {BGR, YUV444, rgb_yuv444},
+                   {NV12, Y, nv12_y},
+                   {RGB, RGB_32F, rgb8_rgb32f},
+                   {RGB, Y, rgb8_y},
+                   {RGB_32F, RGB_32F_PLANAR, rgb32f_deinterleave}});
+
+struct ConvertHostFrame_Impl {
+  uint32_t m_width;
+  uint32_t m_height;
+  Pixel_Format m_src_fmt;
+  Pixel_Format m_dst_fmt;
+  HostConvImpl m_impl = nullptr;
+
+  ConvertHostFrame_Impl(uint32_t width, uint32_t height, Pixel_Format src_fmt,
+                        Pixel_Format dst_fmt)
+      : m_width(width), m_height(height), m_src_fmt(src_fmt),
+        m_dst_fmt(dst_fmt) {
+    for (auto const& conv : s_conversions) {
+      if (src_fmt == std::get<0>(conv) && dst_fmt == std::get<1>(conv)) {
+        m_impl = std::get<2>(conv);
+        break;
+      }
+    }
+
+    if (!m_impl) {
+      std::stringstream ss;
+      ss << "Unsupported pixel format conversion: " << GetFormatName(src_fmt);
+      ss << " -> " << GetFormatName(dst_fmt) << std::endl;
+      throw std::invalid_argument(ss.str());
+    }
+  }
+};
+} // namespace VPF
+
+ConvertHostFrame::ConvertHostFrame(uint32_t width, uint32_t height,
+                                   Pixel_Format src_fmt, Pixel_Format dst_fmt)
+    : pImpl(new ConvertHostFrame_Impl(width, height, src_fmt, dst_fmt)) {}
+
+ConvertHostFrame::~ConvertHostFrame() { delete pImpl; }
+
+size_t ConvertHostFrame::GetSrcSize() const {
+  return HostImage::BufferSize(pImpl->m_src_fmt, pImpl->m_width,
+                               pImpl->m_height);
+}
+
+size_t ConvertHostFrame::GetDstSize() const {
+  return HostImage::BufferSize(pImpl->m_dst_fmt, pImpl->m_width,
+                               pImpl->m_height);
+}
+
+std::list<std::pair<Pixel_Format, Pixel_Format>> const&
+ConvertHostFrame::GetSupportedConversions() {
+  return ConvertSurface::GetSupportedConversions();
+}
+
+bool ConvertHostFrame::Matches(const HostImage& src,
+                               const HostImage& dst) const {
+  auto fits = [this](const HostImage& img, Pixel_Format fmt) {
+    return img.format == fmt && img.width == pImpl->m_width &&
+           img.height == pImpl->m_height;
+  };
+  return fits(src, pImpl->m_src_fmt) && fits(dst, pImpl->m_dst_fmt);
+}
+
+TaskExecDetails
+ConvertHostFrame::Run(Buffer& src, Buffer& dst,
+                      std::optional<ColorspaceConversionContext> cc_ctx) {
+  auto const src_img =
+      HostImage::Make(src, pImpl->m_src_fmt, pImpl->m_width, pImpl->m_height);
+  if (!src_img) {
+    return s_invalid_src;
+  }
+
+  auto const dst_img =
+      HostImage::Make(dst, pImpl->m_dst_fmt, pImpl->m_width, pImpl->m_height);
+  if (!dst_img) {
+    return s_invalid_dst;
+  }
+
+  return Run(*src_img, *dst_img, cc_ctx);
+}
+
+TaskExecDetails
+ConvertHostFrame::Run(const HostImage& src, const HostImage& dst,
+                      std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+
+  if (!Matches(src, dst)) {
+    return s_invalid_src_dst;
+  }
+
+  return pImpl->m_impl(src, dst, cc_ctx);
+}
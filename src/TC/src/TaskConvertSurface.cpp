@@ -12,8 +12,10 @@
  */
 
 #include "CodecsSupport.hpp"
+#include "HostImage.hpp"
 #include "NppCommon.hpp"
 #include "Surfaces.hpp"
+#include "TaskStats.hpp"
 #include "Tasks.hpp"
 #include "Utils.hpp"
 
@@ -379,8 +381,7 @@ yuv444_bgr(Token& src_token, Token& dst_token, int gpu_id, CUstream stream,
                                             npp_ctx);
     break;
   default:
-    err = NPP_NO_OPERATION_WARNING;
-    break;
+    return s_unsupp_cc_ctx;
   }
 
   if (NPP_NO_ERROR != err) {
@@ -998,22 +999,42 @@ ConvertSurface::ConvertSurface(int gpu_id, CUstream str)
   SetupNppContext(m_gpu_id, m_stream, m_npp_ctx);
 }
 
+ConvertSurface::~ConvertSurface() = default;
+
 static bool Validate(Surface& src, Surface& dst) {
   if ((src.Width() != dst.Width()) || (src.Height() != dst.Height())) {
     return false;
   }
 
+  // Both Surfaces shall be either in host or in device memory
+  if (src.OnHost() != dst.OnHost()) {
+    return false;
+  }
+
   return true;
 }
 
 TaskExecDetails
 ConvertSurface::Run(Surface& src, Surface& dst,
                     std::optional<ColorspaceConversionContext> cc_ctx) {
+  static const auto stats_id =
+      TaskStats::Instance().GetCounterId("ConvertSurface");
+  return TaskStats::Instance().Measure(
+      stats_id, [&]() { return RunImpl(src, dst, cc_ctx); });
+}
+
+TaskExecDetails
+ConvertSurface::RunImpl(Surface& src, Surface& dst,
+                        std::optional<ColorspaceConversionContext> cc_ctx) {
 
   if (!Validate(src, dst)) {
     return s_invalid_src_dst;
   }
 
+  if (src.OnHost()) {
+    return RunOnHost(src, dst, cc_ctx);
+  }
+
   // These input formats require scratch buffer
   if (P10 == src.PixelFormat() || P12 == src.PixelFormat()) {
     auto src_plane = src.GetSurfacePlane();
@@ -1093,3 +1114,20 @@ ConvertSurface::Run(Surface& src, Surface& dst,
                    m_scratch ? std::optional(*m_scratch.get()) : std::nullopt,
                    cc_ctx);
 }
+
+TaskExecDetails
+ConvertSurface::RunOnHost(Surface& src, Surface& dst,
+                          std::optional<ColorspaceConversionContext> cc_ctx) {
+  auto const src_img = HostImage::Make(src);
+  auto const dst_img = HostImage::Make(dst);
+  if (!src_img || !dst_img) {
+    return s_invalid_src_dst;
+  }
+
+  if (!m_host || !m_host->Matches(*src_img, *dst_img)) {
+    m_host = std::make_unique<ConvertHostFrame>(
+        src.Width(), src.Height(), src.PixelFormat(), dst.PixelFormat());
+  }
+
+  return m_host->Run(*src_img, *dst_img, cc_ctx);
+}
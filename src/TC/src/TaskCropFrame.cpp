@@ -0,0 +1,332 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tasks.hpp"
+#include "Utils.hpp"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+extern "C" {
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+#include <libswscale/swscale.h>
+}
+
+namespace VPF {
+static const TaskExecDetails s_success(TaskExecStatus::TASK_EXEC_SUCCESS,
+                                       TaskExecInfo::SUCCESS);
+
+static const TaskExecDetails s_invalid_src(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid src buffer size");
+
+static const TaskExecDetails s_invalid_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid dst buffer size");
+
+static const TaskExecDetails s_invalid_rect(TaskExecStatus::TASK_EXEC_FAIL,
+                                            TaskExecInfo::INVALID_INPUT,
+                                            "crop is out of frame bounds");
+
+static const TaskExecDetails
+    s_size_mismatch(TaskExecStatus::TASK_EXEC_FAIL,
+                    TaskExecInfo::SRC_DST_SIZE_MISMATCH,
+                    "number of crops and dst buffers doesn't match");
+
+struct CropFrame_Impl {
+  uint32_t m_width;
+  uint32_t m_height;
+  AVPixelFormat m_src_fmt;
+  AVPixelFormat m_dst_fmt;
+
+  /// @brief Source chroma subsampling, log2
+  int m_hsub;
+  int m_vsub;
+
+  /// @brief Bytes per pixel for every source plane
+  int m_max_step[4];
+
+  struct SwsEntry {
+    std::shared_ptr<SwsContext> ctx;
+    ColorSpace space = UNSPEC;
+    ColorRange range = UDEF;
+  };
+
+  /// @brief Contexts for (crop width, crop height, dst width, dst height).
+  std::map<std::array<uint32_t, 4>, SwsEntry> m_cache;
+
+  /// @brief Tracker crops change size every frame, don't let cache grow
+  /// indefinitely.
+  static const size_t max_cache_size = 64U;
+
+  CropFrame_Impl(uint32_t width, uint32_t height, Pixel_Format src_fmt,
+                 Pixel_Format dst_fmt)
+      : m_width(width), m_height(height),
+        m_src_fmt(toFfmpegPixelFormat(src_fmt)),
+        m_dst_fmt(toFfmpegPixelFormat(dst_fmt)) {
+    if (AV_PIX_FMT_NONE == m_src_fmt) {
+      throw std::invalid_argument("CropFrame: unsupported src format " +
+                                  GetFormatName(src_fmt));
+    }
+
+    if (AV_PIX_FMT_NONE == m_dst_fmt) {
+      throw std::invalid_argument("CropFrame: unsupported dst format " +
+                                  GetFormatName(dst_fmt));
+    }
+
+    auto desc = av_pix_fmt_desc_get(m_src_fmt);
+    m_hsub = desc->log2_chroma_w;
+    m_vsub = desc->log2_chroma_h;
+
+    int max_step_comp[4] = {};
+    av_image_fill_max_pixsteps(m_max_step, max_step_comp, desc);
+  }
+
+  SwsContext* GetContext(uint32_t src_w, uint32_t src_h, uint32_t dst_w,
+                         uint32_t dst_h, const ColorspaceConversionContext& cc) {
+    std::array<uint32_t, 4> key = {src_w, src_h, dst_w, dst_h};
+    auto it = m_cache.find(key);
+    if (it == m_cache.end()) {
+      if (m_cache.size() >= max_cache_size) {
+        m_cache.clear();
+      }
+
+      SwsEntry entry;
+      entry.ctx = makeSwsContext(src_w, src_h, m_src_fmt, dst_w, dst_h,
+                                 m_dst_fmt, SWS_BILINEAR);
+      if (!entry.ctx) {
+        throw std::runtime_error("CropFrame: sws_getContext failed");
+      }
+      it = m_cache.emplace(key, entry).first;
+    }
+
+    auto& entry = it->second;
+    if (entry.space != cc.color_space || entry.range != cc.color_range) {
+      auto const colorSpace = toFfmpegColorSpace(cc.color_space);
+      auto const isJpegRange =
+          (toFfmpegColorRange(cc.color_range) == AVCOL_RANGE_JPEG);
+      auto const brightness = 0U, contrast = 1U << 16U,
+                 saturation = 1U << 16U;
+      auto err = sws_setColorspaceDetails(
+          entry.ctx.get(), sws_getCoefficients(colorSpace), isJpegRange,
+          sws_getCoefficients(colorSpace), isJpegRange, brightness, contrast,
+          saturation);
+      if (err < 0) {
+        return nullptr;
+      }
+      entry.space = cc.color_space;
+      entry.range = cc.color_range;
+    }
+
+    return entry.ctx.get();
+  }
+
+  CropRect Align(const CropRect& rect) const {
+    CropRect aligned = rect;
+    aligned.x = (rect.x >> m_hsub) << m_hsub;
+    aligned.y = (rect.y >> m_vsub) << m_vsub;
+    aligned.width += rect.x - aligned.x;
+    aligned.height += rect.y - aligned.y;
+    return aligned;
+  }
+
+  /* Snaps crop origin to chroma grid and moves plane pointers to it.
+   * Same arithmetics as libavfilter crop filter.
+   */
+  CropRect Align(const CropRect& rect, uint8_t* const frame_data[4],
+                 const int linesize[4], uint8_t* data[4]) const {
+    auto const aligned = Align(rect);
+
+    data[0] = frame_data[0] + aligned.y * linesize[0] +
+              aligned.x * m_max_step[0];
+    for (int i = 1; i < 3; i++) {
+      if (frame_data[i]) {
+        data[i] = frame_data[i] + (aligned.y >> m_vsub) * linesize[i] +
+                  ((aligned.x * m_max_step[i]) >> m_hsub);
+      }
+    }
+    if (frame_data[3]) {
+      data[3] = frame_data[3] + aligned.y * linesize[3] +
+                aligned.x * m_max_step[3];
+    }
+
+    return aligned;
+  }
+
+  bool IsInside(const CropRect& rect) const {
+    return rect.width && rect.height && rect.x < m_width &&
+           rect.y < m_height && rect.width <= m_width - rect.x &&
+           rect.height <= m_height - rect.y;
+  }
+
+  TaskExecDetails CropSingle(uint8_t* const frame_data[4],
+                             const int frame_linesize[4], const CropRect& rect,
+                             uint8_t* dst, size_t dst_size, uint32_t dst_w,
+                             uint32_t dst_h,
+                             const ColorspaceConversionContext& cc) {
+    if (!IsInside(rect)) {
+      return s_invalid_rect;
+    }
+
+    uint8_t* src_data[4] = {};
+    auto const aligned = Align(rect, frame_data, frame_linesize, src_data);
+
+    auto const out_w = dst_w ? dst_w : aligned.width;
+    auto const out_h = dst_h ? dst_h : aligned.height;
+    if (dst_size < getBufferSize(out_w, out_h, m_dst_fmt)) {
+      return s_invalid_dst;
+    }
+
+    auto ctx = GetContext(aligned.width, aligned.height, out_w, out_h, cc);
+    if (!ctx) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                             "unsupported cconv params");
+    }
+
+    uint8_t* dst_data[4] = {};
+    int dst_linesize[4] = {};
+    auto err = av_image_fill_arrays(dst_data, dst_linesize, dst, m_dst_fmt,
+                                    out_w, out_h, 1);
+    if (err < 0) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::INVALID_INPUT,
+                             AvErrorToString(err));
+    }
+
+    err = sws_scale(ctx, src_data, frame_linesize, 0, aligned.height, dst_data,
+                    dst_linesize);
+    if (err < 0) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                             AvErrorToString(err));
+    }
+
+    return s_success;
+  }
+
+  bool FillSrc(Buffer& src, uint8_t* data[4], int linesize[4]) const {
+    if (src.GetRawMemSize() < getBufferSize(m_width, m_height, m_src_fmt)) {
+      return false;
+    }
+
+    return av_image_fill_arrays(data, linesize, src.GetDataAs<uint8_t>(),
+                                m_src_fmt, m_width, m_height, 1) >= 0;
+  }
+};
+}; // namespace VPF
+
+CropFrame::CropFrame(uint32_t width, uint32_t height, Pixel_Format src_fmt,
+                     Pixel_Format dst_fmt) {
+  pImpl = new CropFrame_Impl(width, height, src_fmt, dst_fmt);
+}
+
+CropFrame::~CropFrame() { delete pImpl; }
+
+size_t CropFrame::GetDstSize(uint32_t width, uint32_t height) const {
+  return getBufferSize(width, height, pImpl->m_dst_fmt);
+}
+
+CropRect CropFrame::AlignRect(const CropRect& rect) const {
+  return pImpl->Align(rect);
+}
+
+TaskExecDetails CropFrame::Run(Buffer& src, const std::vector<CropRect>& rects,
+                               const std::vector<Buffer*>& dsts,
+                               uint32_t dst_width, uint32_t dst_height,
+                               std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  try {
+    if (rects.size() != dsts.size()) {
+      return s_size_mismatch;
+    }
+
+    uint8_t* src_data[4] = {};
+    int src_linesize[4] = {};
+    if (!pImpl->FillSrc(src, src_data, src_linesize)) {
+      return s_invalid_src;
+    }
+
+    if (!dst_width || !dst_height) {
+      dst_width = dst_height = 0U;
+    }
+
+    auto const cc = cc_ctx.value_or(ColorspaceConversionContext(BT_601, MPEG));
+    for (size_t i = 0U; i < rects.size(); i++) {
+      if (!dsts[i]) {
+        return s_invalid_dst;
+      }
+
+      auto res = pImpl->CropSingle(
+          src_data, src_linesize, rects[i], dsts[i]->GetDataAs<uint8_t>(),
+          dsts[i]->GetRawMemSize(), dst_width, dst_height, cc);
+      if (res.m_status != TaskExecStatus::TASK_EXEC_SUCCESS) {
+        return res;
+      }
+    }
+
+    return s_success;
+  } catch (std::exception& e) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           e.what());
+  } catch (...) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           "unknown exception");
+  }
+}
+
+TaskExecDetails
+CropFrame::RunBatch(Buffer& src, const std::vector<CropRect>& rects,
+                    Buffer& dst, uint32_t dst_width, uint32_t dst_height,
+                    std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  try {
+    if (!dst_width || !dst_height) {
+      return s_invalid_dst;
+    }
+
+    auto const crop_size = GetDstSize(dst_width, dst_height);
+    if (dst.GetRawMemSize() < crop_size * rects.size()) {
+      return s_invalid_dst;
+    }
+
+    uint8_t* src_data[4] = {};
+    int src_linesize[4] = {};
+    if (!pImpl->FillSrc(src, src_data, src_linesize)) {
+      return s_invalid_src;
+    }
+
+    auto const cc = cc_ctx.value_or(ColorspaceConversionContext(BT_601, MPEG));
+    for (size_t i = 0U; i < rects.size(); i++) {
+      auto res = pImpl->CropSingle(
+          src_data, src_linesize, rects[i],
+          dst.GetDataAs<uint8_t>() + i * crop_size, crop_size, dst_width,
+          dst_height, cc);
+      if (res.m_status != TaskExecStatus::TASK_EXEC_SUCCESS) {
+        return res;
+      }
+    }
+
+    return s_success;
+  } catch (std::exception& e) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           e.what());
+  } catch (...) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           "unknown exception");
+  }
+}
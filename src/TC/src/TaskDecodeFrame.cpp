@@ -13,18 +13,22 @@
 
 #include "CodecsSupport.hpp"
 #include "CudaUtils.hpp"
+#include "ProducerConsumerQueue.hpp"
+#include "TaskStats.hpp"
 #include "Tasks.hpp"
 #include "Utils.hpp"
 
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -46,6 +50,60 @@ using namespace VPF;
 
 namespace VPF {
 
+/* Software decoded frames take memory from HostMemPool, so frames of the same
+ * size reuse blocks across decoder instances instead of hitting the system
+ * allocator; Codec context opaque holds NUMA node to place frames on plus 1;
+ */
+static int get_pooled_buffer(AVCodecContext* avctx, AVFrame* frame,
+                             int flags) {
+  auto const format = (AVPixelFormat)frame->format;
+  auto const desc = av_pix_fmt_desc_get(format);
+  if (!(avctx->codec->capabilities & AV_CODEC_CAP_DR1) || !desc ||
+      (desc->flags & (AV_PIX_FMT_FLAG_HWACCEL | AV_PIX_FMT_FLAG_PAL))) {
+    return avcodec_default_get_buffer2(avctx, frame, flags);
+  }
+
+  int width = frame->width;
+  int height = frame->height;
+  int linesize_align[AV_NUM_DATA_POINTERS] = {};
+  avcodec_align_dimensions2(avctx, &width, &height, linesize_align);
+
+  // 64 is a multiple of any line alignment libavcodec asks for;
+  constexpr int alignment = 64;
+  int linesize[4] = {};
+  auto ret = av_image_fill_linesizes(linesize, format, width);
+  if (ret < 0) {
+    return ret;
+  }
+
+  for (auto& line : linesize) {
+    line = FFALIGN(line, alignment);
+  }
+
+  auto const size =
+      av_image_fill_pointers(frame->data, format, height, nullptr, linesize);
+  if (size < 0) {
+    return size;
+  }
+
+  // Extra padding for SIMD overreads, as default allocator does;
+  auto const node = (int)(intptr_t)avctx->opaque - 1;
+  frame->buf[0] = makePooledAVBuffer(size + 2 * alignment, node,
+                                     MemStats::DECODER_FRAMES);
+  if (!frame->buf[0]) {
+    return AVERROR(ENOMEM);
+  }
+
+  av_image_fill_pointers(frame->data, format, height, frame->buf[0]->data,
+                         linesize);
+  for (auto i = 0; i < 4; i++) {
+    frame->linesize[i] = linesize[i];
+  }
+  frame->extended_data = frame->data;
+
+  return 0;
+}
+
 #ifndef TEGRA_BUILD
 static AVPixelFormat get_format(AVCodecContext* avctx,
                                 const enum AVPixelFormat* pix_fmts) {
@@ -99,105 +157,6 @@ static std::string FindDecoderById(AVCodecID id) {
   return it->second;
 }
 
-template <typename T> class ProducerConsumerQueue {
-private:
-  std::queue<T> m_queue;
-  std::mutex m_mutex;
-  std::condition_variable m_cv_prod;
-  size_t m_capacity;
-  std::atomic<bool> m_closed = {false};
-  uint32_t m_timeout = 3000U;
-
-  /* Not thread safe, to be used with m_mutex locked.
-   */
-  bool full() const { return m_queue.size() == m_capacity; }
-  bool empty() const { return m_queue.empty(); }
-
-public:
-  enum class Status { Success = 0, Closed = 1, Empty = 2, Full = 3 };
-
-  static std::string toString(Status status) {
-    switch (status) {
-    case Status::Success:
-      return "Success";
-    case Status::Closed:
-      return "Closed";
-    case Status::Empty:
-      return "Empty";
-    case Status::Full:
-      return "Full";
-    default:
-      return "Unknow";
-    }
-  }
-
-  ProducerConsumerQueue(size_t capacity) : m_capacity(capacity) {}
-
-  unsigned int timeout_ms() const { return m_timeout; }
-
-  void close() { m_closed = true; }
-
-  void open() { m_closed = false; }
-
-  bool closed() const { return m_closed; }
-
-  Status push(const T& item) {
-    if (closed()) {
-      return Status::Closed;
-    }
-    std::unique_lock lock{m_mutex};
-    if (!m_cv_prod.wait_for(lock, std::chrono::milliseconds(m_timeout),
-                            [this] { return !full(); })) {
-      return Status::Full;
-    }
-    m_queue.push(item);
-    return Status::Success;
-  }
-
-  Status pop(T& item) {
-    if (closed()) {
-      return Status::Closed;
-    }
-    std::unique_lock lock{m_mutex};
-    if (empty()) {
-      return Status::Empty;
-    }
-    item = m_queue.front();
-    m_queue.pop();
-    m_cv_prod.notify_one();
-
-    return Status::Success;
-  }
-
-  Status pop() {
-    if (closed()) {
-      return Status::Closed;
-    }
-    std::unique_lock lock{m_mutex};
-    if (empty()) {
-      return Status::Empty;
-    }
-    m_queue.pop();
-    m_cv_prod.notify_one();
-
-    return Status::Success;
-  }
-
-  Status peek(T& item) {
-    if (closed()) {
-      return Status::Closed;
-    }
-    std::unique_lock lock{m_mutex};
-    if (empty()) {
-      return Status::Empty;
-    }
-    item = m_queue.front();
-    return Status::Success;
-  }
-
-  size_t capacity() const { return m_capacity; }
-};
-
 using PacketPtr = std::shared_ptr<AVPacket>;
 using PacketQueue = ProducerConsumerQueue<PacketPtr>;
 using QueueStatus = PacketQueue::Status;
@@ -210,6 +169,18 @@ struct FfmpegDecodeFrame_Impl {
   PacketQueue m_queue;
   std::shared_ptr<AVBufferRef> m_hw_ctx;
   std::map<AVFrameSideDataType, Buffer*> m_side_data;
+
+  // Side data types to save and references to side data of recent frames
+  std::set<AVFrameSideDataType> m_side_data_types = {
+      AV_FRAME_DATA_MOTION_VECTORS, AV_FRAME_DATA_DISPLAYMATRIX};
+
+  struct SideDataSlot {
+    int64_t pts = AV_NOPTS_VALUE;
+    std::vector<SideDataEntry> entries;
+  };
+  std::vector<SideDataSlot> m_side_data_ring = std::vector<SideDataSlot>(1U);
+  size_t m_side_data_last = 0U;
+  size_t m_side_data_count = 0U;
   std::shared_ptr<AVDictionary> m_options;
   std::shared_ptr<TimeoutHandler> m_timeout_handler;
   std::shared_ptr<AVIOContext> m_io_ctx;
@@ -231,6 +202,12 @@ struct FfmpegDecodeFrame_Impl {
   // User prefferred stream width. Mostly useful for HLS ABR streams.
   int m_preferred_width = -1;
 
+  // NUMA node decoded frames are placed on
+  int m_numa_node = Numa::ANY_NODE;
+
+  // CPUs libavcodec worker threads are pinned to, empty if not pinned
+  std::vector<int> m_cpus;
+
   // True if codec is opened, false otherwise
   bool m_codec_open = false;
 
@@ -248,28 +225,45 @@ struct FfmpegDecodeFrame_Impl {
     std::atomic<bool> m_cancel = {false};
   } m_state;
 
-  /* These are handy counters for debug:
+  /* Counters returned by GetStats():
    *
    * Packets read.
    * Packets sent.
    * Frames received.
    *
-   * Since incrementing them is negligible overhead, only output is put under
-   * conditional compilation. Change #if in class destructor to output values.
+   * Packets may be read and decoded by different threads and counters may
+   * be read by yet another one, so they are atomic.
    *
    * Please note that seek heavy influences the difference between these
    * counters values, that's ok.
    */
-  uint32_t m_num_pkt_read = 0U;
-  uint32_t m_num_pkt_sent = 0U;
-  uint32_t m_num_frm_recv = 0U;
+  std::atomic<uint64_t> m_num_pkt_read = 0U;
+  std::atomic<uint64_t> m_num_pkt_sent = 0U;
+  std::atomic<uint64_t> m_num_frm_recv = 0U;
+  std::atomic<uint64_t> m_num_bytes_read = 0U;
+  std::atomic<uint64_t> m_num_seeks = 0U;
+  std::atomic<uint64_t> m_num_frm_seek_discarded = 0U;
+  std::atomic<uint64_t> m_read_ns = 0U;
+  std::atomic<uint64_t> m_decode_ns = 0U;
+  std::atomic<uint64_t> m_copy_ns = 0U;
+
+  static void Inc(std::atomic<uint64_t>& counter, uint64_t delta = 1U) {
+    counter.fetch_add(delta, std::memory_order_relaxed);
+  }
+
+  static void AddTime(std::atomic<uint64_t>& counter,
+                      std::chrono::steady_clock::time_point start) {
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+    Inc(counter,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
 
   // Decoder operation mode
   DecodeMode m_mode = DecodeMode::ALL_FRAMES;
 
   bool IsCancel() const { return m_state.m_cancel.load(); }
 
-  void SetCancel() { m_state.m_cancel = true; }
+  void SetCancel(bool cancel) { m_state.m_cancel = cancel; }
 
   void SetMode(DecodeMode new_mode) { m_mode = new_mode; }
 
@@ -288,6 +282,60 @@ struct FfmpegDecodeFrame_Impl {
     return -1;
   }
 
+  /// @brief Throw exception which names malformed option
+  /// @param key option name
+  /// @param value option value
+  [[noreturn]] static void ThrowOnInvalidOption(const std::string& key,
+                                                const std::string& value) {
+    std::stringstream ss;
+    ss << "Invalid decoder option " << key << ": \"" << value << "\"";
+    throw std::invalid_argument(ss.str());
+  }
+
+  /// @brief Take NUMA node and CPU set out of options
+  /// @param ffmpeg_options options, NUMA related entries are erased
+  void ExtractNumaOptions(std::map<std::string, std::string>& ffmpeg_options) {
+    auto it = ffmpeg_options.find("cpu_set");
+    if (ffmpeg_options.end() != it) {
+      try {
+        m_cpus = Numa::ParseCpuList(it->second);
+      } catch (std::exception&) {
+        ThrowOnInvalidOption(it->first, it->second);
+      }
+
+      if (!m_cpus.empty()) {
+        m_numa_node = Numa::CpuNode(m_cpus.front());
+      }
+      ffmpeg_options.erase(it);
+    }
+
+    it = ffmpeg_options.find("numa_node");
+    if (ffmpeg_options.end() != it) {
+      if ("auto" == it->second) {
+        m_numa_node = Numa::NextNode();
+      } else {
+        try {
+          size_t pos = 0U;
+          m_numa_node = std::stoi(it->second, &pos);
+          if (pos != it->second.size()) {
+            ThrowOnInvalidOption(it->first, it->second);
+          }
+        } catch (std::exception&) {
+          ThrowOnInvalidOption(it->first, it->second);
+        }
+      }
+
+      if (m_numa_node < Numa::ANY_NODE || m_numa_node >= Numa::NumNodes()) {
+        ThrowOnInvalidOption(it->first, it->second);
+      }
+      ffmpeg_options.erase(it);
+
+      if (m_cpus.empty()) {
+        m_cpus = Numa::NodeCpus(m_numa_node);
+      }
+    }
+  }
+
   /// @brief Constructor
   /// @param URL input url
   /// @param ffmpeg_options list of options you would pass to ffmpeg cli
@@ -309,6 +357,9 @@ struct FfmpegDecodeFrame_Impl {
       ffmpeg_options.erase(it);
     }
 
+    // Same for NUMA placement options.
+    ExtractNumaOptions(ffmpeg_options);
+
     // Allocate format context first to set timeout before opening the input.
     AVFormatContext* fmt_ctx = avformat_alloc_context();
     if (!fmt_ctx) {
@@ -549,13 +600,22 @@ struct FfmpegDecodeFrame_Impl {
       m_stream = av_cuda_ctx->stream;
     }
 
+    if (!is_accelerated) {
+      m_avc_ctx->get_buffer2 = get_pooled_buffer;
+      m_avc_ctx->opaque = (void*)(intptr_t)(m_numa_node + 1);
+    }
+
     /* Set packet time base here because later packet PTS values will be
      * discarded. Without that, libavcodec won't be able to reconstruct
      * correct PTS values.
      */
     m_avc_ctx->pkt_timebase = m_fmt_ctx->streams[GetVideoStrIdx()]->time_base;
 
-    ret = avcodec_open2(m_avc_ctx.get(), p_codec, &options);
+    {
+      // Codec worker threads are spawned here and inherit the affinity.
+      ScopedThreadAffinity affinity(m_cpus);
+      ret = avcodec_open2(m_avc_ctx.get(), p_codec, &options);
+    }
     if (options) {
       av_dict_free(&options);
     }
@@ -620,22 +680,74 @@ struct FfmpegDecodeFrame_Impl {
                            TaskExecInfo::SUCCESS);
   }
 
-  void SaveMotionVectors() {
-    AVFrameSideDataType type = AV_FRAME_DATA_MOTION_VECTORS;
-    AVFrameSideData* sd = av_frame_get_side_data(m_frame.get(), type);
+  void SetSideDataTypes(const std::set<AVFrameSideDataType>& types,
+                        size_t history) {
+    m_side_data_types = types;
+    m_side_data_ring.assign(std::max<size_t>(history, 1U), SideDataSlot());
+    for (auto& slot : m_side_data_ring) {
+      slot.entries.reserve(types.size());
+    }
+    m_side_data_last = 0U;
+    m_side_data_count = 0U;
+  }
+
+  /* Side data may take hundreds of KB per frame (e.g. motion vectors), so it
+   * isn't copied. References to side data buffers are kept in a ring instead,
+   * slot memory is reused. Frame may have multiple entries of same type, e.g.
+   * SEI messages, all of them are saved.
+   */
+  void SaveSideDataRefs() {
+    m_side_data_last = (m_side_data_last + 1U) % m_side_data_ring.size();
+    m_side_data_count =
+        std::min(m_side_data_count + 1U, m_side_data_ring.size());
+
+    auto& slot = m_side_data_ring[m_side_data_last];
+    slot.pts = m_frame->pts;
+    slot.entries.clear();
+
+    for (auto i = 0; i < m_frame->nb_side_data; i++) {
+      auto sd = m_frame->side_data[i];
+      if (!sd->buf || !m_side_data_types.count(sd->type)) {
+        continue;
+      }
 
-    if (sd) {
-      auto it = m_side_data.find(type);
-      if (it == m_side_data.end()) {
-        m_side_data[type] = Buffer::MakeOwnMem(sd->size);
-        it = m_side_data.find(type);
-        memcpy(it->second->GetRawMemPtr(), sd->data, sd->size);
-      } else if (it->second->GetRawMemSize() != sd->size) {
-        it->second->Update(sd->size, sd->data);
+      auto ref = av_buffer_ref(sd->buf);
+      if (!ref) {
+        continue;
       }
+
+      SideDataEntry entry;
+      entry.type = sd->type;
+      entry.data = sd->data;
+      entry.size = sd->size;
+
+      // Buffer may be shared with frame, it's counted while history holds it;
+      auto const size = (size_t)sd->size;
+      MemStats::Instance().OnAlloc(MemStats::SIDE_DATA, size);
+      entry.ref = std::shared_ptr<AVBufferRef>(ref, [size](void* p) {
+        MemStats::Instance().OnFree(MemStats::SIDE_DATA, size);
+        av_buffer_unref((AVBufferRef**)&p);
+      });
+      slot.entries.push_back(entry);
     }
   }
 
+  const SideDataSlot* GetSideDataSlot(size_t frames_back) const {
+    if (frames_back >= m_side_data_count) {
+      return nullptr;
+    }
+
+    auto const size = m_side_data_ring.size();
+    return &m_side_data_ring[(m_side_data_last + size - frames_back) % size];
+  }
+
+  void ResetSideDataRefs() {
+    for (auto& slot : m_side_data_ring) {
+      slot.entries.clear();
+    }
+    m_side_data_count = 0U;
+  }
+
   void SaveDisplayMatrix() {
     AVFrameSideDataType type = AV_FRAME_DATA_DISPLAYMATRIX;
     AVFrameSideData* sd = av_frame_get_side_data(m_frame.get(), type);
@@ -647,17 +759,17 @@ struct FfmpegDecodeFrame_Impl {
     auto it = m_side_data.find(type);
 
     if (it == m_side_data.end()) {
-      m_side_data[type] = Buffer::MakeOwnMem(sizeof(angle));
-      it = m_side_data.find(type);
-      memcpy(it->second->GetRawMemPtr(), (void*)&angle, sizeof(angle));
-    } else if (it->second->GetRawMemSize() != sd->size) {
+      m_side_data[type] = Buffer::MakeOwnMem(sizeof(angle), &angle);
+    } else {
       it->second->Update(sizeof(angle), (void*)&angle);
     }
   }
 
   bool SaveSideData() {
-    SaveMotionVectors();
-    SaveDisplayMatrix();
+    SaveSideDataRefs();
+    if (m_side_data_types.count(AV_FRAME_DATA_DISPLAYMATRIX)) {
+      SaveDisplayMatrix();
+    }
     return true;
   }
 
@@ -716,6 +828,14 @@ struct FfmpegDecodeFrame_Impl {
    * It doesn't check if memory amount is sufficient.
    */
   DECODE_STATUS GetLastFrame(Token& dst) {
+    NvtxMark tick(__FUNCTION__);
+    if (DecodeMode::SIDE_DATA_ONLY == GetMode()) {
+      return DEC_SUCCESS;
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    AtScopeExit add_time([&]() { AddTime(m_copy_ns, start); });
+
     if (m_frame->hw_frames_ctx) {
       // Codec has HW acceleration and outputs to CUDA memory
       try {
@@ -746,6 +866,7 @@ struct FfmpegDecodeFrame_Impl {
   }
 
   DECODE_STATUS ReadPacket() {
+    NvtxMark tick(__FUNCTION__);
     if (m_state.m_over)
       return DEC_OVER;
 
@@ -767,7 +888,9 @@ struct FfmpegDecodeFrame_Impl {
       });
 
       m_timeout_handler->Reset();
+      auto const start = std::chrono::steady_clock::now();
       auto ret = av_read_frame(m_fmt_ctx.get(), pkt.get());
+      AddTime(m_read_ns, start);
 
       if (AVERROR_EOF == ret) {
         m_state.m_over = true;
@@ -786,9 +909,17 @@ struct FfmpegDecodeFrame_Impl {
         return DEC_ERROR;
       }
 
-      m_num_pkt_read++;
+      Inc(m_num_pkt_read);
+      Inc(m_num_bytes_read, pkt->size);
       if (is_desired_video_packet(pkt)) {
-        const auto status = m_queue.push(pkt);
+        // Packet is accounted until its last reference is gone.
+        auto const size = (size_t)pkt->size;
+        MemStats::Instance().OnAlloc(MemStats::PACKET_QUEUE, size);
+        auto queued = PacketPtr(pkt.get(), [pkt, size](void*) {
+          MemStats::Instance().OnFree(MemStats::PACKET_QUEUE, size);
+        });
+
+        const auto status = m_queue.push(queued);
         if (QueueStatus::Success != status) {
           std::cerr << "Failed to push packet: "
                     << PacketQueue::toString(status) << "\n";
@@ -802,6 +933,7 @@ struct FfmpegDecodeFrame_Impl {
   }
 
   DECODE_STATUS DecodePacket(Token& dst) {
+    NvtxMark tick(__FUNCTION__);
     if (m_state.m_noacpt)
       return ReceiveFrame(dst);
 
@@ -828,7 +960,9 @@ struct FfmpegDecodeFrame_Impl {
       m_queue.close();
     }
 
+    auto const start = std::chrono::steady_clock::now();
     auto ret = avcodec_send_packet(m_avc_ctx.get(), pkt.get());
+    AddTime(m_decode_ns, start);
 
     if (AVERROR_EOF == ret) {
       // Not an error, just flushing the queues.
@@ -840,7 +974,7 @@ struct FfmpegDecodeFrame_Impl {
       return DEC_ERROR;
     } else {
       // Decoder has accepted the packet, now it can be removed from queue.
-      m_num_pkt_sent++;
+      Inc(m_num_pkt_sent);
       m_queue.pop();
     }
 
@@ -848,9 +982,12 @@ struct FfmpegDecodeFrame_Impl {
   }
 
   DECODE_STATUS ReceiveFrame(Token& dst) {
+    NvtxMark tick(__FUNCTION__);
     SaveCurrentRes();
 
+    auto const start = std::chrono::steady_clock::now();
     auto ret = avcodec_receive_frame(m_avc_ctx.get(), m_frame.get());
+    AddTime(m_decode_ns, start);
     if (ret == AVERROR_EOF) {
       // Decoder won't output any more frames, signal decode end.
       return DEC_DONE;
@@ -862,7 +999,7 @@ struct FfmpegDecodeFrame_Impl {
       std::cerr << "avcodec_receive_frame failed: " << AvErrorToString(ret);
       return DEC_ERROR;
     } else {
-      m_num_frm_recv++;
+      Inc(m_num_frm_recv);
     }
 
     if (UpdGetResChange()) {
@@ -874,14 +1011,22 @@ struct FfmpegDecodeFrame_Impl {
     return GetLastFrame(dst);
   }
 
-  ~FfmpegDecodeFrame_Impl() {
-// For debug purposes
-#if 0
-    std::cout << "m_num_pkt_read: " << m_num_pkt_read << std::endl;
-    std::cout << "m_num_pkt_sent: " << m_num_pkt_sent << std::endl;
-    std::cout << "m_num_frm_recv: " << m_num_frm_recv << std::endl;
-#endif
+  void GetStats(DecoderStats& stats) {
+    stats.num_pkt_read = m_num_pkt_read.load(std::memory_order_relaxed);
+    stats.num_pkt_sent = m_num_pkt_sent.load(std::memory_order_relaxed);
+    stats.num_frm_recv = m_num_frm_recv.load(std::memory_order_relaxed);
+    stats.num_bytes_read = m_num_bytes_read.load(std::memory_order_relaxed);
+    stats.num_seeks = m_num_seeks.load(std::memory_order_relaxed);
+    stats.num_frm_seek_discarded =
+        m_num_frm_seek_discarded.load(std::memory_order_relaxed);
+    stats.read_ns = m_read_ns.load(std::memory_order_relaxed);
+    stats.decode_ns = m_decode_ns.load(std::memory_order_relaxed);
+    stats.copy_ns = m_copy_ns.load(std::memory_order_relaxed);
+    stats.queue_capacity = m_queue.capacity();
+    m_queue.occupancy(stats.queue_size, stats.max_queue_size);
+  }
 
+  ~FfmpegDecodeFrame_Impl() {
     for (auto& output : m_side_data) {
       if (output.second) {
         delete output.second;
@@ -1111,6 +1256,8 @@ struct FfmpegDecodeFrame_Impl {
                              AvErrorToString(ret));
     } else {
       avcodec_flush_buffers(m_avc_ctx.get());
+      ResetSideDataRefs();
+      Inc(m_num_seeks);
     }
 
     /* Discard existing frame timestamp and OEF flag.
@@ -1126,7 +1273,13 @@ struct FfmpegDecodeFrame_Impl {
 
     /* Decode in loop until we reach desired frame.
      */
+    auto num_decoded = 0U;
     while (m_frame->pts + start_time < timestamp) {
+      // Frame decoded at previous iteration is discarded.
+      if (num_decoded++) {
+        Inc(m_num_frm_seek_discarded);
+      }
+
       auto details = DecodeSingleFrame(dst);
       if (details.m_status != TaskExecStatus::TASK_EXEC_SUCCESS) {
         return details;
@@ -1147,6 +1300,14 @@ struct FfmpegDecodeFrame_Impl {
 
 TaskExecDetails DecodeFrame::Run(Token& dst, PacketData& pkt_data,
                                  std::optional<SeekContext> seek_ctx) {
+  static const auto stats_id =
+      TaskStats::Instance().GetCounterId("DecodeFrame");
+  return TaskStats::Instance().Measure(
+      stats_id, [&]() { return RunImpl(dst, pkt_data, seek_ctx); });
+}
+
+TaskExecDetails DecodeFrame::RunImpl(Token& dst, PacketData& pkt_data,
+                                     std::optional<SeekContext> seek_ctx) {
   AtScopeExit set_pkt_data([&]() { pkt_data = pImpl->m_packet_data; });
 
   if (seek_ctx.has_value())
@@ -1193,10 +1354,49 @@ TaskExecDetails DecodeFrame::GetSideData(AVFrameSideDataType data_type,
                            TaskExecInfo::SUCCESS);
   }
 
+  auto ref = GetSideDataRef(data_type);
+  if (ref) {
+    out.Update(ref->size, ref->data);
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_SUCCESS,
+                           TaskExecInfo::SUCCESS);
+  }
+
   return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
                          "decoder failed to get side data");
 }
 
+std::shared_ptr<AVBufferRef>
+DecodeFrame::GetSideDataRef(AVFrameSideDataType data_type) const {
+  auto slot = pImpl->GetSideDataSlot(0U);
+  if (!slot) {
+    return nullptr;
+  }
+
+  for (auto& entry : slot->entries) {
+    if (entry.type == data_type) {
+      return entry.ref;
+    }
+  }
+  return nullptr;
+}
+
+void DecodeFrame::SetSideDataTypes(const std::set<AVFrameSideDataType>& types,
+                                   size_t history) {
+  pImpl->SetSideDataTypes(types, history);
+}
+
+bool DecodeFrame::GetFrameSideData(size_t frames_back, int64_t& pts,
+                                   std::vector<SideDataEntry>& entries) const {
+  auto slot = pImpl->GetSideDataSlot(frames_back);
+  if (!slot) {
+    return false;
+  }
+
+  pts = slot->pts;
+  entries = slot->entries;
+  return true;
+}
+
 DecodeFrame* DecodeFrame::Make(const char* URL, NvDecoderClInterface& cli_iface,
                                int gpu_id, int pkt_queue_size,
                                std::shared_ptr<AVIOContext> p_io_ctx) {
@@ -1222,6 +1422,8 @@ bool DecodeFrame::IsAccelerated() const { return pImpl->IsAccelerated(); }
 
 bool DecodeFrame::IsVFR() const { return pImpl->IsVFR(); }
 
+int DecodeFrame::GetNumaNode() const { return pImpl->m_numa_node; }
+
 CUstream DecodeFrame::GetStream() const { return pImpl->GetStream(); }
 
 void DecodeFrame::SetMode(DecodeMode new_mode) { pImpl->SetMode(new_mode); }
@@ -1248,6 +1450,14 @@ void DecodeFrame::Probe(const char* URL, NvDecoderClInterface& cli_iface,
   }
 }
 
+DecoderStats DecodeFrame::GetStats() const {
+  DecoderStats stats;
+  pImpl->GetStats(stats);
+  return stats;
+}
+
+void DecodeFrame::SetCancel(bool cancel) { pImpl->SetCancel(cancel); }
+
 DECODE_STATUS DecodeFrame::ReadPacket() { return pImpl->ReadPacket(); }
 
 DECODE_STATUS DecodeFrame::DecodePacket(Token& dst) {
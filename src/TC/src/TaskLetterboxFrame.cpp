@@ -0,0 +1,371 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tasks.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+extern "C" {
+#include <libavutil/imgutils.h>
+#include <libswscale/swscale.h>
+}
+
+namespace VPF {
+static const TaskExecDetails s_success(TaskExecStatus::TASK_EXEC_SUCCESS,
+                                       TaskExecInfo::SUCCESS);
+
+static const TaskExecDetails s_invalid_src(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid src buffer size");
+
+static const TaskExecDetails s_invalid_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid dst buffer size");
+
+static const TaskExecDetails
+    s_unsupp_norm(TaskExecStatus::TASK_EXEC_FAIL,
+                  TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                  "normalization is only supported for float outputs");
+
+/// @brief Fill everything around picture rectangle with pad color.
+/// Packed 3 channel layout.
+template <typename T>
+static void PadPacked(T* dst, uint32_t width, uint32_t height,
+                      const LetterboxParams& p, const T color[3]) {
+  auto fill = [&](T* row, uint32_t count) {
+    for (uint32_t i = 0U; i < count; i++) {
+      row[i * 3U + 0U] = color[0];
+      row[i * 3U + 1U] = color[1];
+      row[i * 3U + 2U] = color[2];
+    }
+  };
+
+  auto const pitch = width * 3U;
+  auto const right = p.offset_x + p.width;
+  for (uint32_t y = 0U; y < height; y++) {
+    auto row = dst + y * pitch;
+    if (y < p.offset_y || y >= p.offset_y + p.height) {
+      // Fill first row element-wise, copy it to the rest.
+      if (y == 0U || y == p.offset_y + p.height) {
+        fill(row, width);
+      } else {
+        std::copy(row - pitch, row, row);
+      }
+      continue;
+    }
+
+    fill(row, p.offset_x);
+    fill(row + right * 3U, width - right);
+  }
+}
+
+/// @brief Fill everything around picture rectangle with pad color.
+/// Planar 3 channel layout.
+template <typename T>
+static void PadPlanar(T* dst, uint32_t width, uint32_t height,
+                      const LetterboxParams& p, const T color[3]) {
+  auto const right = p.offset_x + p.width;
+  auto const bottom = p.offset_y + p.height;
+  for (int c = 0; c < 3; c++) {
+    auto plane = dst + c * width * height;
+    std::fill(plane, plane + p.offset_y * width, color[c]);
+    for (uint32_t y = p.offset_y; y < bottom; y++) {
+      auto row = plane + y * width;
+      std::fill(row, row + p.offset_x, color[c]);
+      std::fill(row + right, row + width, color[c]);
+    }
+    std::fill(plane + bottom * width, plane + height * width, color[c]);
+  }
+}
+
+struct LetterboxFrame_Impl {
+  uint32_t m_src_width;
+  uint32_t m_src_height;
+  AVPixelFormat m_src_fmt;
+
+  uint32_t m_dst_width;
+  uint32_t m_dst_height;
+  Pixel_Format m_dst_fmt;
+
+  /// @brief 8 bit format swscale writes to
+  AVPixelFormat m_sws_fmt;
+
+  LetterboxParams m_params;
+
+  std::shared_ptr<SwsContext> m_ctx = nullptr;
+
+  /// @brief Scaled 8 bit picture which is widened to float
+  std::vector<uint8_t> m_scratch;
+
+  /// @brief Per channel 8 bit to float lookup tables
+  float m_lut[3][256];
+
+  LetterboxFrame_Impl(uint32_t src_width, uint32_t src_height,
+                      Pixel_Format src_fmt, uint32_t dst_width,
+                      uint32_t dst_height, Pixel_Format dst_fmt)
+      : m_src_width(src_width), m_src_height(src_height),
+        m_src_fmt(toFfmpegPixelFormat(src_fmt)), m_dst_width(dst_width),
+        m_dst_height(dst_height), m_dst_fmt(dst_fmt) {
+    if (!src_width || !src_height || !dst_width || !dst_height) {
+      throw std::invalid_argument("LetterboxFrame: zero frame size");
+    }
+
+    if (AV_PIX_FMT_NONE == m_src_fmt) {
+      throw std::invalid_argument("LetterboxFrame: unsupported src format " +
+                                  GetFormatName(src_fmt));
+    }
+
+    switch (m_dst_fmt) {
+    case RGB:
+    case RGB_32F:
+      m_sws_fmt = AV_PIX_FMT_RGB24;
+      break;
+    case BGR:
+      m_sws_fmt = AV_PIX_FMT_BGR24;
+      break;
+    case RGB_PLANAR:
+    case RGB_32F_PLANAR:
+      m_sws_fmt = AV_PIX_FMT_GBRP;
+      break;
+    default:
+      throw std::invalid_argument("LetterboxFrame: unsupported dst format " +
+                                  GetFormatName(dst_fmt));
+    }
+
+    m_params.scale = std::min(float(dst_width) / float(src_width),
+                              float(dst_height) / float(src_height));
+    m_params.width = std::clamp(
+        (uint32_t)std::lround(src_width * m_params.scale), 1U, dst_width);
+    m_params.height = std::clamp(
+        (uint32_t)std::lround(src_height * m_params.scale), 1U, dst_height);
+    m_params.offset_x = (dst_width - m_params.width) / 2U;
+    m_params.offset_y = (dst_height - m_params.height) / 2U;
+
+    m_ctx = makeSwsContext(m_src_width, m_src_height, m_src_fmt,
+                           m_params.width, m_params.height, m_sws_fmt,
+                           SWS_BILINEAR);
+
+    if (!m_ctx) {
+      throw std::runtime_error("LetterboxFrame: sws_getContext failed");
+    }
+
+    if (IsFloat()) {
+      m_scratch.resize(m_params.width * m_params.height * 3U);
+    }
+  }
+
+  bool IsFloat() const {
+    return RGB_32F == m_dst_fmt || RGB_32F_PLANAR == m_dst_fmt;
+  }
+
+  bool IsPlanar() const {
+    return RGB_PLANAR == m_dst_fmt || RGB_32F_PLANAR == m_dst_fmt;
+  }
+
+  size_t DstSize() const {
+    return (size_t)m_dst_width * m_dst_height * 3U *
+           (IsFloat() ? sizeof(float) : sizeof(uint8_t));
+  }
+
+  /* Fills swscale output pointers. 8 bit outputs are scaled straight into
+   * picture rectangle of destination, float outputs go through scratch.
+   * GBRP plane order is swizzled so that planes are stored as R, G, B.
+   */
+  void SetupOutput(Buffer& dst, uint8_t* data[4], int linesize[4]) {
+    uint8_t* base = nullptr;
+    size_t plane_size = 0U, pitch = 0U;
+
+    if (IsFloat()) {
+      base = m_scratch.data();
+      pitch = m_params.width;
+      plane_size = m_params.width * m_params.height;
+    } else {
+      auto const num_comp = IsPlanar() ? 1U : 3U;
+      pitch = m_dst_width;
+      plane_size = m_dst_width * m_dst_height;
+      base = dst.GetDataAs<uint8_t>() +
+             (m_params.offset_y * pitch + m_params.offset_x) * num_comp;
+    }
+
+    if (IsPlanar()) {
+      data[0] = base + plane_size;
+      data[1] = base + plane_size * 2U;
+      data[2] = base;
+      linesize[0] = linesize[1] = linesize[2] = pitch;
+    } else {
+      data[0] = base;
+      linesize[0] = pitch * 3U;
+    }
+  }
+
+  void BuildLut(const LetterboxOptions& opts) {
+    for (int c = 0; c < 3; c++) {
+      auto const mean = opts.normalize ? opts.mean[c] : 0.f;
+      auto const stddev = opts.normalize ? opts.stddev[c] : 1.f;
+      for (int v = 0; v < 256; v++) {
+        m_lut[c][v] = (v / 255.f - mean) / stddev;
+      }
+    }
+  }
+
+  /// @brief Widen scaled picture from scratch into float destination.
+  void Widen(Buffer& dst) {
+    auto out = dst.GetDataAs<float>();
+    auto const w = m_params.width, h = m_params.height;
+
+    if (IsPlanar()) {
+      for (int c = 0; c < 3; c++) {
+        auto const lut = m_lut[c];
+        auto src_plane = m_scratch.data() + c * w * h;
+        auto dst_plane = out + c * m_dst_width * m_dst_height;
+        for (uint32_t y = 0U; y < h; y++) {
+          auto src = src_plane + y * w;
+          auto dst = dst_plane + (m_params.offset_y + y) * m_dst_width +
+                     m_params.offset_x;
+          for (uint32_t x = 0U; x < w; x++) {
+            dst[x] = lut[src[x]];
+          }
+        }
+      }
+      return;
+    }
+
+    for (uint32_t y = 0U; y < h; y++) {
+      auto src = m_scratch.data() + y * w * 3U;
+      auto dst = out + ((m_params.offset_y + y) * m_dst_width +
+                        m_params.offset_x) *
+                           3U;
+      for (uint32_t x = 0U; x < w * 3U; x += 3U) {
+        dst[x + 0U] = m_lut[0][src[x + 0U]];
+        dst[x + 1U] = m_lut[1][src[x + 1U]];
+        dst[x + 2U] = m_lut[2][src[x + 2U]];
+      }
+    }
+  }
+
+  void Pad(Buffer& dst, const LetterboxOptions& opts) {
+    auto const& pc = opts.pad_color;
+    if (IsFloat()) {
+      const float color[3] = {m_lut[0][pc[0]], m_lut[1][pc[1]],
+                              m_lut[2][pc[2]]};
+      auto out = dst.GetDataAs<float>();
+      IsPlanar() ? PadPlanar(out, m_dst_width, m_dst_height, m_params, color)
+                 : PadPacked(out, m_dst_width, m_dst_height, m_params, color);
+      return;
+    }
+
+    auto out = dst.GetDataAs<uint8_t>();
+    if (BGR == m_dst_fmt) {
+      const uint8_t color[3] = {pc[2], pc[1], pc[0]};
+      PadPacked(out, m_dst_width, m_dst_height, m_params, color);
+    } else if (IsPlanar()) {
+      PadPlanar(out, m_dst_width, m_dst_height, m_params, pc.data());
+    } else {
+      PadPacked(out, m_dst_width, m_dst_height, m_params, pc.data());
+    }
+  }
+};
+}; // namespace VPF
+
+LetterboxFrame::LetterboxFrame(uint32_t src_width, uint32_t src_height,
+                               Pixel_Format src_fmt, uint32_t dst_width,
+                               uint32_t dst_height, Pixel_Format dst_fmt) {
+  pImpl = new LetterboxFrame_Impl(src_width, src_height, src_fmt, dst_width,
+                                  dst_height, dst_fmt);
+}
+
+LetterboxFrame::~LetterboxFrame() { delete pImpl; }
+
+const LetterboxParams& LetterboxFrame::GetParams() const {
+  return pImpl->m_params;
+}
+
+size_t LetterboxFrame::GetDstSize() const { return pImpl->DstSize(); }
+
+TaskExecDetails
+LetterboxFrame::Run(Buffer& src, Buffer& dst, const LetterboxOptions& opts,
+                    std::optional<ColorspaceConversionContext> cc_ctx) {
+  NvtxMark tick(__FUNCTION__);
+  try {
+    auto const src_size = getBufferSize(pImpl->m_src_width,
+                                        pImpl->m_src_height, pImpl->m_src_fmt);
+    if (src.GetRawMemSize() < src_size) {
+      return s_invalid_src;
+    }
+
+    if (dst.GetRawMemSize() < pImpl->DstSize()) {
+      return s_invalid_dst;
+    }
+
+    if (opts.normalize && !pImpl->IsFloat()) {
+      return s_unsupp_norm;
+    }
+
+    auto const ctx = cc_ctx.value_or(ColorspaceConversionContext(BT_601, MPEG));
+    auto const colorSpace = toFfmpegColorSpace(ctx.color_space);
+    auto const isJpegRange =
+        (toFfmpegColorRange(ctx.color_range) == AVCOL_RANGE_JPEG);
+    auto const brightness = 0U, contrast = 1U << 16U, saturation = 1U << 16U;
+    auto err = sws_setColorspaceDetails(
+        pImpl->m_ctx.get(), sws_getCoefficients(colorSpace), isJpegRange,
+        sws_getCoefficients(colorSpace), isJpegRange, brightness, contrast, saturation);
+    if (err < 0) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                             "unsupported cconv params");
+    }
+
+    uint8_t* src_data[4] = {};
+    int src_linesize[4] = {};
+    err = av_image_fill_arrays(src_data, src_linesize,
+                               src.GetDataAs<uint8_t>(), pImpl->m_src_fmt,
+                               pImpl->m_src_width, pImpl->m_src_height, 1);
+    if (err < 0) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::INVALID_INPUT,
+                             AvErrorToString(err));
+    }
+
+    uint8_t* dst_data[4] = {};
+    int dst_linesize[4] = {};
+    pImpl->SetupOutput(dst, dst_data, dst_linesize);
+
+    err = sws_scale(pImpl->m_ctx.get(), src_data, src_linesize, 0,
+                    pImpl->m_src_height, dst_data, dst_linesize);
+    if (err < 0) {
+      return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                             TaskExecInfo::UNSUPPORTED_FMT_CONV_PARAMS,
+                             AvErrorToString(err));
+    }
+
+    if (pImpl->IsFloat()) {
+      pImpl->BuildLut(opts);
+      pImpl->Widen(dst);
+    }
+
+    pImpl->Pad(dst, opts);
+    return s_success;
+  } catch (std::exception& e) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           e.what());
+  } catch (...) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           "unknown exception");
+  }
+}
@@ -11,6 +11,7 @@
  * limitations under the License.
  */
 
+#include "MemStats.hpp"
 #include "MemoryInterfaces.hpp"
 #include "NvCodecCLIOptions.h"
 #include "NvEncoder.h"
@@ -1091,6 +1092,14 @@ struct NvencEncodeFrame_Impl {
   }
 
   ~NvencEncodeFrame_Impl() {
+    auto& stats = MemStats::Instance();
+    for (; !packetQueue.empty(); packetQueue.pop()) {
+      stats.OnFree(MemStats::ENCODER_OUTPUT, packetQueue.front().size());
+    }
+    if (!lastPacket.empty()) {
+      stats.OnFree(MemStats::ENCODER_OUTPUT, lastPacket.size());
+    }
+
     pEncoderCuda->DestroyEncoder();
     delete pEncoderCuda;
     delete pElementaryVideo;
@@ -1196,11 +1205,17 @@ TaskExecDetails NvencEncodeFrame::Run() {
     /* Push encoded packets into queue;
      */
     for (auto& packet : encPackets) {
+      MemStats::Instance().OnAlloc(MemStats::ENCODER_OUTPUT, packet.size());
       pImpl->packetQueue.push(packet);
     }
 
-    /* Then return least recent packet;
+    /* Then return least recent packet; Previous one is counted until now
+     * because user gets it from output buffer;
      */
+    if (!pImpl->lastPacket.empty()) {
+      MemStats::Instance().OnFree(MemStats::ENCODER_OUTPUT,
+                                  pImpl->lastPacket.size());
+    }
     pImpl->lastPacket.clear();
     if (!pImpl->packetQueue.empty()) {
       pImpl->lastPacket = pImpl->packetQueue.front();
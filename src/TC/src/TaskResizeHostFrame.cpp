@@ -0,0 +1,275 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostImage.hpp"
+#include "Tasks.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace VPF {
+static const TaskExecDetails s_success(TaskExecStatus::TASK_EXEC_SUCCESS,
+                                       TaskExecInfo::SUCCESS);
+
+static const TaskExecDetails s_fail(TaskExecStatus::TASK_EXEC_FAIL,
+                                    TaskExecInfo::FAIL);
+
+static const TaskExecDetails s_invalid_src(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid src buffer size");
+
+static const TaskExecDetails s_invalid_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid dst buffer size");
+
+static const TaskExecDetails s_invalid_src_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                               TaskExecInfo::INVALID_INPUT,
+                                               "invalid src / dst");
+
+static double Lanczos3(double x) {
+  x = std::abs(x);
+  if (x < 1e-9) {
+    return 1.0;
+  }
+  if (x >= 3.0) {
+    return 0.0;
+  }
+
+  auto const pi_x = std::acos(-1.0) * x;
+  return 3.0 * std::sin(pi_x) * std::sin(pi_x / 3.0) / (pi_x * pi_x);
+}
+
+/// @brief Lanczos filtering taps along one axis.
+/// Filter is stretched when downscaling, so every source pixel contributes.
+/// Out of range positions are clamped to edge.
+struct LanczosTaps {
+  /// @brief Number of taps per destination pixel
+  uint32_t size = 0U;
+
+  /// @brief Source positions and normalized weights, size per pixel
+  std::vector<uint32_t> pos;
+  std::vector<float> w;
+
+  void Init(uint32_t src_len, uint32_t dst_len) {
+    auto const scale = (double)src_len / dst_len;
+    auto const stretch = std::max(scale, 1.0);
+    auto const support = 3.0 * stretch;
+
+    size = 2U * (uint32_t)std::ceil(support);
+    pos.resize(size * dst_len);
+    w.resize(size * dst_len);
+
+    for (uint32_t x = 0U; x < dst_len; x++) {
+      auto const center = (x + 0.5) * scale - 0.5;
+      auto const first = (int64_t)std::floor(center - support) + 1;
+
+      double sum = 0.0;
+      for (uint32_t t = 0U; t < size; t++) {
+        auto const src_x = first + t;
+        auto const weight = Lanczos3((src_x - center) / stretch);
+        pos[x * size + t] =
+            (uint32_t)std::clamp<int64_t>(src_x, 0, (int64_t)src_len - 1);
+        w[x * size + t] = (float)weight;
+        sum += weight;
+      }
+
+      for (uint32_t t = 0U; t < size; t++) {
+        w[x * size + t] = (float)(w[x * size + t] / sum);
+      }
+    }
+  }
+};
+
+template <typename T> inline T Store(float val);
+
+template <> inline uint8_t Store<uint8_t>(float val) {
+  return (uint8_t)std::clamp(std::lround(val), 0L, 255L);
+}
+
+template <> inline float Store<float>(float val) { return val; }
+
+struct ResizeHostFrame_Impl {
+  uint32_t m_src_width;
+  uint32_t m_src_height;
+  uint32_t m_dst_width;
+  uint32_t m_dst_height;
+  Pixel_Format m_fmt;
+
+  /// @brief Taps of every plane, made upon first run
+  std::array<LanczosTaps, 4> m_taps_x;
+  std::array<LanczosTaps, 4> m_taps_y;
+  bool m_has_taps = false;
+
+  /// @brief Horizontally filtered source rows and single destination row
+  std::vector<float> m_rows;
+  std::vector<float> m_acc;
+
+  ResizeHostFrame_Impl(uint32_t src_width, uint32_t src_height,
+                       uint32_t dst_width, uint32_t dst_height,
+                       Pixel_Format fmt)
+      : m_src_width(src_width), m_src_height(src_height),
+        m_dst_width(dst_width), m_dst_height(dst_height), m_fmt(fmt) {
+    auto const& formats = ResizeHostFrame::SupportedFormats();
+    auto const is_supported =
+        std::find(formats.begin(), formats.end(), fmt) != formats.end();
+
+    if (!is_supported || !HostImage::BufferSize(fmt, src_width, src_height) ||
+        !HostImage::BufferSize(fmt, dst_width, dst_height)) {
+      std::stringstream ss;
+      ss << "Unsupported resize params: " << GetFormatName(fmt) << " "
+         << src_width << "x" << src_height << " -> " << dst_width << "x"
+         << dst_height;
+      throw std::invalid_argument(ss.str());
+    }
+  }
+
+  /* Channels of packed plane are filtered independently, e.g. interleaved
+   * NV12 chroma or packed RGB. Horizontal pass goes first for every source
+   * row, then vertical pass blends filtered rows.
+   */
+  template <typename T>
+  void ResizePlane(const HostImage& src, const HostImage& dst,
+                   uint32_t plane) {
+    auto const chans = src.row_size[plane] / (src.cols[plane] * sizeof(T));
+    auto const row_len = dst.cols[plane] * chans;
+    auto const& tx = m_taps_x[plane];
+    auto const& ty = m_taps_y[plane];
+
+    m_rows.resize(row_len * src.rows[plane]);
+    for (uint32_t y = 0U; y < src.rows[plane]; y++) {
+      auto const in = src.Row<const T>(plane, y);
+      auto out = m_rows.data() + y * row_len;
+      for (uint32_t x = 0U; x < dst.cols[plane]; x++) {
+        auto const pos = tx.pos.data() + x * tx.size;
+        auto const w = tx.w.data() + x * tx.size;
+        for (size_t c = 0U; c < chans; c++) {
+          float acc = 0.f;
+          for (uint32_t t = 0U; t < tx.size; t++) {
+            acc += w[t] * in[pos[t] * chans + c];
+          }
+          out[x * chans + c] = acc;
+        }
+      }
+    }
+
+    m_acc.resize(row_len);
+    for (uint32_t y = 0U; y < dst.rows[plane]; y++) {
+      std::fill(m_acc.begin(), m_acc.end(), 0.f);
+      for (uint32_t t = 0U; t < ty.size; t++) {
+        auto const w = ty.w[y * ty.size + t];
+        auto const in = m_rows.data() + ty.pos[y * ty.size + t] * row_len;
+        for (size_t i = 0U; i < row_len; i++) {
+          m_acc[i] += w * in[i];
+        }
+      }
+
+      auto out = dst.Row<T>(plane, y);
+      for (size_t i = 0U; i < row_len; i++) {
+        out[i] = Store<T>(m_acc[i]);
+      }
+    }
+  }
+
+  void Run(const HostImage& src, const HostImage& dst) {
+    if (!m_has_taps) {
+      for (auto i = 0U; i < src.num_planes; i++) {
+        m_taps_x[i].Init(src.cols[i], dst.cols[i]);
+        m_taps_y[i].Init(src.rows[i], dst.rows[i]);
+      }
+      m_has_taps = true;
+    }
+
+    for (auto i = 0U; i < src.num_planes; i++) {
+      if (sizeof(float) == src.elem_size) {
+        ResizePlane<float>(src, dst, i);
+      } else {
+        ResizePlane<uint8_t>(src, dst, i);
+      }
+    }
+  }
+};
+} // namespace VPF
+
+ResizeHostFrame::ResizeHostFrame(uint32_t src_width, uint32_t src_height,
+                                 uint32_t dst_width, uint32_t dst_height,
+                                 Pixel_Format format)
+    : pImpl(new ResizeHostFrame_Impl(src_width, src_height, dst_width,
+                                     dst_height, format)) {}
+
+ResizeHostFrame::~ResizeHostFrame() { delete pImpl; }
+
+size_t ResizeHostFrame::GetSrcSize() const {
+  return HostImage::BufferSize(pImpl->m_fmt, pImpl->m_src_width,
+                               pImpl->m_src_height);
+}
+
+size_t ResizeHostFrame::GetDstSize() const {
+  return HostImage::BufferSize(pImpl->m_fmt, pImpl->m_dst_width,
+                               pImpl->m_dst_height);
+}
+
+const std::list<Pixel_Format>& ResizeHostFrame::SupportedFormats() {
+  static const std::list<Pixel_Format> formats(
+      {RGB, BGR, YUV420, YUV444, RGB_PLANAR, RGB_32F, RGB_32F_PLANAR, NV12});
+  return formats;
+}
+
+bool ResizeHostFrame::Matches(const HostImage& src,
+                              const HostImage& dst) const {
+  return src.format == pImpl->m_fmt && dst.format == pImpl->m_fmt &&
+         src.width == pImpl->m_src_width &&
+         src.height == pImpl->m_src_height &&
+         dst.width == pImpl->m_dst_width && dst.height == pImpl->m_dst_height;
+}
+
+TaskExecDetails ResizeHostFrame::Run(Buffer& src, Buffer& dst) {
+  auto const src_img = HostImage::Make(src, pImpl->m_fmt, pImpl->m_src_width,
+                                       pImpl->m_src_height);
+  if (!src_img) {
+    return s_invalid_src;
+  }
+
+  auto const dst_img = HostImage::Make(dst, pImpl->m_fmt, pImpl->m_dst_width,
+                                       pImpl->m_dst_height);
+  if (!dst_img) {
+    return s_invalid_dst;
+  }
+
+  return Run(*src_img, *dst_img);
+}
+
+TaskExecDetails ResizeHostFrame::Run(const HostImage& src,
+                                     const HostImage& dst) {
+  NvtxMark tick(__FUNCTION__);
+
+  if (!Matches(src, dst)) {
+    return s_invalid_src_dst;
+  }
+
+  try {
+    pImpl->Run(src, dst);
+  } catch (std::exception& e) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           e.what());
+  } catch (...) {
+    return s_fail;
+  }
+
+  return s_success;
+}
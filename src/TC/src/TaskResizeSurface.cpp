@@ -1,7 +1,9 @@
+#include "HostImage.hpp"
 #include "MemoryInterfaces.hpp"
 #include "NppCommon.hpp"
 #include "Tasks.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace VPF {
@@ -21,6 +23,9 @@ struct ResizeSurface_Impl {
   CUstream m_stream;
   NppStreamContext m_npp_ctx;
 
+  /// @brief Host Surfaces resizer, made for last seen params
+  std::unique_ptr<ResizeHostFrame> m_host;
+
   ResizeSurface_Impl(Pixel_Format format, int gpu_id, CUstream str)
       : m_gpu_id(gpu_id), m_stream(str) {
     SetupNppContext(m_gpu_id, m_stream, m_npp_ctx);
@@ -29,6 +34,29 @@ struct ResizeSurface_Impl {
   virtual ~ResizeSurface_Impl() = default;
 
   virtual TaskExecDetails Run(Surface& src, Surface& dst) = 0;
+
+  TaskExecDetails RunOnHost(Surface& src, Surface& dst) {
+    auto const& formats = ResizeHostFrame::SupportedFormats();
+    if (dst.PixelFormat() != src.PixelFormat() ||
+        std::find(formats.begin(), formats.end(), src.PixelFormat()) ==
+            formats.end()) {
+      return s_invalid_src_dst;
+    }
+
+    auto const src_img = HostImage::Make(src);
+    auto const dst_img = HostImage::Make(dst);
+    if (!src_img || !dst_img) {
+      return s_invalid_src_dst;
+    }
+
+    if (!m_host || !m_host->Matches(*src_img, *dst_img)) {
+      m_host = std::make_unique<ResizeHostFrame>(src.Width(), src.Height(),
+                                                 dst.Width(), dst.Height(),
+                                                 src.PixelFormat());
+    }
+
+    return m_host->Run(*src_img, *dst_img);
+  }
 };
 
 struct NppResizeSurfacePacked3C_Impl final : ResizeSurface_Impl {
@@ -324,5 +352,13 @@ TaskExecDetails ResizeSurface::Run() {
     return s_invalid_src_dst;
   }
 
+  if (pInputSurface->OnHost() != pOutputSurface->OnHost()) {
+    return s_invalid_src_dst;
+  }
+
+  if (pInputSurface->OnHost()) {
+    return pImpl->RunOnHost(*pInputSurface, *pOutputSurface);
+  }
+
   return pImpl->Run(*pInputSurface, *pOutputSurface);
 }
\ No newline at end of file
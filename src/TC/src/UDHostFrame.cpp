@@ -0,0 +1,334 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostImage.hpp"
+#include "Tasks.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+extern "C" {
+#include <libswscale/swscale.h>
+}
+
+namespace VPF {
+static const TaskExecDetails s_success(TaskExecStatus::TASK_EXEC_SUCCESS,
+                                       TaskExecInfo::SUCCESS);
+
+static const TaskExecDetails s_fail(TaskExecStatus::TASK_EXEC_FAIL,
+                                    TaskExecInfo::FAIL);
+
+static const TaskExecDetails s_invalid_src(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid src buffer size");
+
+static const TaskExecDetails s_invalid_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                           TaskExecInfo::INVALID_INPUT,
+                                           "invalid dst buffer size");
+
+static const TaskExecDetails s_invalid_src_dst(TaskExecStatus::TASK_EXEC_FAIL,
+                                               TaskExecInfo::INVALID_INPUT,
+                                               "invalid src / dst");
+
+/// @brief Linear filtering taps along one axis.
+/// Replicates CUDA texture unit in cudaFilterModeLinear mode with
+/// unnormalized coordinates: sample position is shifted by half texel,
+/// out of range texels are clamped, weight has 8 bit fractional part.
+struct LinearTaps {
+  std::vector<uint32_t> lo;
+  std::vector<uint32_t> hi;
+  std::vector<float> w;
+
+  void Init(uint32_t dst_size, uint32_t src_size, float scale) {
+    lo.resize(dst_size);
+    hi.resize(dst_size);
+    w.resize(dst_size);
+
+    auto const last = (int64_t)src_size - 1;
+    for (uint32_t i = 0U; i < dst_size; i++) {
+      auto const pos = (float)i / scale - .5f;
+      auto const base = std::floor(pos);
+      auto const idx = (int64_t)base;
+
+      lo[i] = (uint32_t)std::clamp<int64_t>(idx, 0, last);
+      hi[i] = (uint32_t)std::clamp<int64_t>(idx + 1, 0, last);
+      w[i] = std::round((pos - base) * 256.f) / 256.f;
+    }
+  }
+};
+
+template <typename T>
+static void BlendRows(const T* __restrict top, const T* __restrict bot,
+                      float w, float* __restrict dst, size_t count) {
+  for (size_t x = 0U; x < count; x++) {
+    dst[x] = (float)top[x] + w * ((float)bot[x] - (float)top[x]);
+  }
+}
+
+/// @brief Same as CUDA float to integer cast: saturate and truncate.
+/// Float output stays normalized.
+template <typename T> static inline T Denorm(float v) {
+  constexpr float scale = (float)std::numeric_limits<T>::max() + 1.f;
+  constexpr float max = (float)std::numeric_limits<T>::max();
+  return (T)std::min(std::max(v * scale, 0.f), max);
+}
+
+template <> inline float Denorm<float>(float v) { return v; }
+
+template <typename T>
+static void EmitYuv(const float* __restrict y, const float* __restrict u,
+                    const float* __restrict v, T* __restrict dst_y,
+                    T* __restrict dst_u, T* __restrict dst_v, size_t count) {
+  for (size_t x = 0U; x < count; x++) {
+    dst_y[x] = Denorm<T>(y[x]);
+    dst_u[x] = Denorm<T>(u[x]);
+    dst_v[x] = Denorm<T>(v[x]);
+  }
+}
+
+template <typename T, int STEP>
+static void EmitRgb(const float* __restrict y, const float* __restrict u,
+                    const float* __restrict v, RgbRow<T> dst, size_t count) {
+  for (size_t x = 0U; x < count; x++) {
+    auto const n_u = u[x] - .5f;
+    auto const n_v = v[x] - .5f;
+
+    dst.r[x * STEP] = Denorm<T>(y[x] + 1.140f * n_v);
+    dst.g[x * STEP] = Denorm<T>(y[x] - 0.394f * n_u - 0.581f * n_v);
+    dst.b[x * STEP] = Denorm<T>(y[x] + 2.032f * n_u);
+  }
+}
+
+struct UDHostFrame_Impl {
+  uint32_t m_src_width;
+  uint32_t m_src_height;
+  Pixel_Format m_src_fmt;
+  uint32_t m_dst_width;
+  uint32_t m_dst_height;
+  Pixel_Format m_dst_fmt;
+
+  /// @brief Semi-planar input sampling positions
+  LinearTaps m_luma_x;
+  LinearTaps m_luma_y;
+  LinearTaps m_chroma_x;
+  LinearTaps m_chroma_y;
+
+  /// @brief Vertically filtered source rows, interleaved for chroma
+  std::vector<float> m_src_luma;
+  std::vector<float> m_src_chroma;
+
+  /// @brief Normalized samples of single destination row
+  std::vector<float> m_y;
+  std::vector<float> m_u;
+  std::vector<float> m_v;
+
+  /// @brief Planar input resizers
+  std::shared_ptr<SwsContext> m_luma_ctx;
+  std::shared_ptr<SwsContext> m_chroma_ctx;
+
+  UDHostFrame_Impl(uint32_t src_width, uint32_t src_height,
+                   Pixel_Format src_fmt, uint32_t dst_width,
+                   uint32_t dst_height, Pixel_Format dst_fmt)
+      : m_src_width(src_width), m_src_height(src_height), m_src_fmt(src_fmt),
+        m_dst_width(dst_width), m_dst_height(dst_height), m_dst_fmt(dst_fmt) {
+    auto const& convs = UDSurface::SupportedConversions();
+    auto const it =
+        std::find(convs.begin(), convs.end(), std::make_pair(src_fmt, dst_fmt));
+    if (convs.end() == it) {
+      std::stringstream ss;
+      ss << "Unsupported pixel format conversion: " << GetFormatName(src_fmt);
+      ss << " -> " << GetFormatName(dst_fmt) << std::endl;
+      throw std::invalid_argument(ss.str());
+    }
+
+    if (NV12 == src_fmt || P10 == src_fmt) {
+      // Same scale factors and chroma texture size as in ResizeUtils.cu
+      auto const scale_x = 1.0f * dst_width / src_width;
+      auto const scale_y = 1.0f * dst_height / src_height;
+      m_luma_x.Init(dst_width, src_width, scale_x);
+      m_luma_y.Init(dst_height, src_height, scale_y);
+      m_chroma_x.Init(dst_width, src_width / 2, scale_x * 2);
+      m_chroma_y.Init(dst_height, src_height / 2, scale_y * 2);
+
+      m_src_luma.resize(src_width);
+      m_src_chroma.resize(src_width / 2 * 2);
+      m_y.resize(dst_width);
+      m_u.resize(dst_width);
+      m_v.resize(dst_width);
+      return;
+    }
+
+    auto const av_fmt =
+        YUV420 == src_fmt ? AV_PIX_FMT_GRAY8 : AV_PIX_FMT_GRAY16LE;
+    auto make_ctx = [&](uint32_t width, uint32_t height) {
+      auto ctx = makeSwsContext(width, height, av_fmt, dst_width, dst_height,
+                                av_fmt, SWS_LANCZOS);
+      if (!ctx) {
+        throw std::runtime_error("UDHostFrame: sws_getContext failed");
+      }
+      return ctx;
+    };
+
+    m_luma_ctx = make_ctx(src_width, src_height);
+    m_chroma_ctx = make_ctx((src_width + 1) / 2, (src_height + 1) / 2);
+  }
+
+  template <typename T> void SampleRow(const HostImage& src, uint32_t row) {
+    BlendRows(src.Row<const T>(0U, m_luma_y.lo[row]),
+              src.Row<const T>(0U, m_luma_y.hi[row]), m_luma_y.w[row],
+              m_src_luma.data(), m_src_luma.size());
+
+    BlendRows(src.Row<const T>(1U, m_chroma_y.lo[row]),
+              src.Row<const T>(1U, m_chroma_y.hi[row]), m_chroma_y.w[row],
+              m_src_chroma.data(), m_src_chroma.size());
+
+    constexpr float norm = 1.f / std::numeric_limits<T>::max();
+    for (uint32_t x = 0U; x < m_dst_width; x++) {
+      auto const l0 = m_src_luma[m_luma_x.lo[x]];
+      auto const l1 = m_src_luma[m_luma_x.hi[x]];
+      m_y[x] = (l0 + m_luma_x.w[x] * (l1 - l0)) * norm;
+
+      auto const c0 = 2U * m_chroma_x.lo[x];
+      auto const c1 = 2U * m_chroma_x.hi[x];
+      auto const wc = m_chroma_x.w[x];
+      auto const u0 = m_src_chroma[c0], u1 = m_src_chroma[c1];
+      auto const v0 = m_src_chroma[c0 + 1], v1 = m_src_chroma[c1 + 1];
+      m_u[x] = (u0 + wc * (u1 - u0)) * norm;
+      m_v[x] = (v0 + wc * (v1 - v0)) * norm;
+    }
+  }
+
+  template <typename SRC, typename DST>
+  void SemiPlanar(const HostImage& src, const HostImage& dst) {
+    for (uint32_t row = 0U; row < m_dst_height; row++) {
+      SampleRow<SRC>(src, row);
+
+      if (YUV444 == m_dst_fmt || YUV444_10bit == m_dst_fmt) {
+        EmitYuv<DST>(m_y.data(), m_u.data(), m_v.data(),
+                     dst.Row<DST>(0U, row), dst.Row<DST>(1U, row),
+                     dst.Row<DST>(2U, row), m_dst_width);
+      } else if (IsPlanarRgb(m_dst_fmt)) {
+        EmitRgb<DST, 1>(m_y.data(), m_u.data(), m_v.data(),
+                        RgbRowOf<DST>(dst, row), m_dst_width);
+      } else {
+        EmitRgb<DST, 3>(m_y.data(), m_u.data(), m_v.data(),
+                        RgbRowOf<DST>(dst, row), m_dst_width);
+      }
+    }
+  }
+
+  void Planar(const HostImage& src, const HostImage& dst) {
+    for (auto i = 0U; i < src.num_planes; i++) {
+      const uint8_t* src_data[4] = {src.data[i]};
+      const int src_stride[4] = {(int)src.pitch[i]};
+      uint8_t* dst_data[4] = {dst.data[i]};
+      const int dst_stride[4] = {(int)dst.pitch[i]};
+
+      auto ctx = i ? m_chroma_ctx.get() : m_luma_ctx.get();
+      if (sws_scale(ctx, src_data, src_stride, 0, src.rows[i], dst_data,
+                    dst_stride) < 0) {
+        throw std::runtime_error("UDHostFrame: sws_scale failed");
+      }
+    }
+  }
+};
+} // namespace VPF
+
+UDHostFrame::UDHostFrame(uint32_t src_width, uint32_t src_height,
+                         Pixel_Format src_fmt, uint32_t dst_width,
+                         uint32_t dst_height, Pixel_Format dst_fmt)
+    : pImpl(new UDHostFrame_Impl(src_width, src_height, src_fmt, dst_width,
+                                 dst_height, dst_fmt)) {}
+
+UDHostFrame::~UDHostFrame() { delete pImpl; }
+
+size_t UDHostFrame::GetSrcSize() const {
+  return HostImage::BufferSize(pImpl->m_src_fmt, pImpl->m_src_width,
+                               pImpl->m_src_height);
+}
+
+size_t UDHostFrame::GetDstSize() const {
+  return HostImage::BufferSize(pImpl->m_dst_fmt, pImpl->m_dst_width,
+                               pImpl->m_dst_height);
+}
+
+bool UDHostFrame::Matches(const HostImage& src, const HostImage& dst) const {
+  return src.format == pImpl->m_src_fmt && src.width == pImpl->m_src_width &&
+         src.height == pImpl->m_src_height && dst.format == pImpl->m_dst_fmt &&
+         dst.width == pImpl->m_dst_width && dst.height == pImpl->m_dst_height;
+}
+
+TaskExecDetails UDHostFrame::Run(Buffer& src, Buffer& dst) {
+  auto const src_img = HostImage::Make(src, pImpl->m_src_fmt,
+                                       pImpl->m_src_width, pImpl->m_src_height);
+  if (!src_img) {
+    return s_invalid_src;
+  }
+
+  auto const dst_img = HostImage::Make(dst, pImpl->m_dst_fmt,
+                                       pImpl->m_dst_width, pImpl->m_dst_height);
+  if (!dst_img) {
+    return s_invalid_dst;
+  }
+
+  return Run(*src_img, *dst_img);
+}
+
+TaskExecDetails UDHostFrame::Run(const HostImage& src, const HostImage& dst) {
+  NvtxMark tick(__FUNCTION__);
+
+  if (!Matches(src, dst)) {
+    return s_invalid_src_dst;
+  }
+
+  try {
+    switch (pImpl->m_src_fmt) {
+    case NV12:
+      switch (pImpl->m_dst_fmt) {
+      case YUV444:
+      case RGB:
+      case RGB_PLANAR:
+        pImpl->SemiPlanar<uint8_t, uint8_t>(src, dst);
+        break;
+      default:
+        pImpl->SemiPlanar<uint8_t, float>(src, dst);
+        break;
+      }
+      break;
+    case P10:
+      if (YUV444_10bit == pImpl->m_dst_fmt) {
+        pImpl->SemiPlanar<uint16_t, uint16_t>(src, dst);
+      } else {
+        pImpl->SemiPlanar<uint16_t, float>(src, dst);
+      }
+      break;
+    default:
+      pImpl->Planar(src, dst);
+      break;
+    }
+  } catch (std::exception& e) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL, TaskExecInfo::FAIL,
+                           e.what());
+  } catch (...) {
+    return s_fail;
+  }
+
+  return s_success;
+}
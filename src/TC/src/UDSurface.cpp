@@ -11,6 +11,7 @@
  * limitations under the License.
  */
 
+#include "HostImage.hpp"
 #include "MemoryInterfaces.hpp"
 #include "NppCommon.hpp"
 #include "ResizeUtils.hpp"
@@ -133,6 +134,10 @@ UDSurface::SupportedConversions() {
 }
 
 TaskExecDetails UDSurface::Run(Surface& src, Surface& dst) {
+  if (src.OnHost() != dst.OnHost()) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                           TaskExecInfo::INVALID_INPUT);
+  }
 
   auto& convs = SupportedConversions();
   bool found = false;
@@ -148,6 +153,10 @@ TaskExecDetails UDSurface::Run(Surface& src, Surface& dst) {
                            TaskExecInfo::NOT_SUPPORTED);
   }
 
+  if (src.OnHost()) {
+    return RunOnHost(src, dst);
+  }
+
   CudaCtxPush ctxPush(GetContextByStream(m_gpu_id, m_stream));
 
   TaskExecInfo info = TaskExecInfo::SUCCESS;
@@ -179,4 +188,23 @@ TaskExecDetails UDSurface::Run(Surface& src, Surface& dst) {
 UDSurface::UDSurface(int gpu_id, CUstream stream)
     : m_gpu_id(gpu_id), m_stream(stream) {
   SetupNppContext(gpu_id, stream, m_ctx);
+}
+
+UDSurface::~UDSurface() = default;
+
+TaskExecDetails UDSurface::RunOnHost(Surface& src, Surface& dst) {
+  auto const src_img = HostImage::Make(src);
+  auto const dst_img = HostImage::Make(dst);
+  if (!src_img || !dst_img) {
+    return TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                           TaskExecInfo::INVALID_INPUT);
+  }
+
+  if (!m_host || !m_host->Matches(*src_img, *dst_img)) {
+    m_host = std::make_unique<UDHostFrame>(src.Width(), src.Height(),
+                                           src.PixelFormat(), dst.Width(),
+                                           dst.Height(), dst.PixelFormat());
+  }
+
+  return m_host->Run(*src_img, *dst_img);
 }
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "Utils.hpp"
+#include "HostMemPool.hpp"
+#include "MemStats.hpp"
 #include <iostream>
+#include <new>
 #include <vector>
 
 extern "C" {
 #include <libavformat/avformat.h>
 #include <libavutil/frame.h>
 #include <libavutil/imgutils.h>
+#include <libswscale/swscale.h>
 }
 
 std::string AvErrorToString(int av_error_code) {
@@ -74,6 +78,61 @@ std::string GetFormatName(Pixel_Format fmt) {
   return it->second;
 }
 
+/* Block size, component and NUMA node are packed into AVBuffer opaque, so no
+ * extra allocation is made per frame; Node takes lower 16 bits, component
+ * takes next 4 bits;
+ */
+static void* packPooledAVBuffer(size_t size, int node,
+                                MemStats::Component component) {
+  return (void*)(((uintptr_t)size << 20U) | ((uintptr_t)component << 16U) |
+                 (uint16_t)(node + 1));
+}
+
+static void freePooledAVBuffer(void* opaque, uint8_t* data) {
+  auto const size = (size_t)((uintptr_t)opaque >> 20U);
+  auto const component =
+      (MemStats::Component)(((uintptr_t)opaque >> 16U) & 0xFU);
+  auto const node = (int)((uintptr_t)opaque & 0xFFFFU) - 1;
+  MemStats::Instance().OnFree(component, size);
+  HostMemPool::Instance().Free(data, size, node);
+}
+
+AVBufferRef* makePooledAVBuffer(size_t size, int node,
+                                MemStats::Component component) {
+  auto data = (uint8_t*)HostMemPool::Instance().Allocate(size, node);
+  if (!data) {
+    return nullptr;
+  }
+
+  auto buf = av_buffer_create(data, size, freePooledAVBuffer,
+                              packPooledAVBuffer(size, node, component), 0);
+  if (!buf) {
+    HostMemPool::Instance().Free(data, size, node);
+    return nullptr;
+  }
+
+  MemStats::Instance().OnAlloc(component, size);
+  return buf;
+}
+
+std::shared_ptr<SwsContext> makeSwsContext(int src_w, int src_h,
+                                           AVPixelFormat src_fmt, int dst_w,
+                                           int dst_h, AVPixelFormat dst_fmt,
+                                           int flags) {
+  auto ctx = sws_getContext(src_w, src_h, src_fmt, dst_w, dst_h, dst_fmt,
+                            flags, nullptr, nullptr, nullptr);
+  if (!ctx) {
+    return nullptr;
+  }
+
+  // Context size isn't known, only number of contexts is;
+  MemStats::Instance().OnAlloc(MemStats::SWSCALE, 0U);
+  return std::shared_ptr<SwsContext>(ctx, [](auto* p) {
+    MemStats::Instance().OnFree(MemStats::SWSCALE, 0U);
+    sws_freeContext(p);
+  });
+}
+
 std::shared_ptr<AVFrame> makeAVFrame(int width, int height, int format) {
   std::shared_ptr<AVFrame> frame(av_frame_alloc(),
                                  [](auto* p) { av_frame_free(&p); });
@@ -81,10 +140,27 @@ std::shared_ptr<AVFrame> makeAVFrame(int width, int height, int format) {
   frame->height = height;
   frame->format = format;
 
-  // Use 0 for auto-alignment according to ffmpeg doc;
-  auto ret = av_frame_get_buffer(frame.get(), 0);
+  // Same line alignment as av_frame_get_buffer uses on AVX-512 builds;
+  auto const alignment = 64;
+  auto const size = av_image_get_buffer_size((AVPixelFormat)format, width,
+                                             height, alignment);
+  if (size < 0) {
+    throw std::runtime_error("Failed to get frame buffer size: " +
+                             AvErrorToString(size));
+  }
+
+  // Extra padding for SIMD overreads, as av_frame_get_buffer does;
+  frame->buf[0] = makePooledAVBuffer(size + alignment);
+  if (!frame->buf[0]) {
+    throw std::bad_alloc();
+  }
+
+  auto ret = av_image_fill_arrays(frame->data, frame->linesize,
+                                  frame->buf[0]->data, (AVPixelFormat)format,
+                                  width, height, alignment);
   if (ret < 0) {
-    throw std::runtime_error("meaningful message");
+    throw std::runtime_error("Failed to fill frame planes: " +
+                             AvErrorToString(ret));
   }
 
   return frame;
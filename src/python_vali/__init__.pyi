@@ -1,3 +1,4 @@
+import asyncio
 import numpy
 from typing import Any, ClassVar, overload
 
@@ -28,6 +29,7 @@ MB_PER_SEC_MAX: NV_ENC_CAPS
 MORE: DecodeStatus
 MORE_DATA_NEEDED: TaskExecInfo
 MPEG: ColorRange
+MotionVectorDtype: numpy.dtype
 NOT_SUPPORTED: TaskExecInfo
 NO_PTS: int
 NUM_MAX_BFRAMES: NV_ENC_CAPS
@@ -45,6 +47,7 @@ RGB_32F: PixelFormat
 RGB_32F_PLANAR: PixelFormat
 RGB_PLANAR: PixelFormat
 SEPARATE_COLOUR_PLANE: NV_ENC_CAPS
+SIDE_DATA_ONLY: DecodeMode
 SRC_DST_FMT_MISMATCH: TaskExecInfo
 SRC_DST_SIZE_MISMATCH: TaskExecInfo
 SUCCESS: DecodeStatus
@@ -143,6 +146,16 @@ class ColorspaceConversionContext:
     @overload
     def __init__(self, color_space: ColorSpace, color_range: ColorRange) -> None: ...
 
+class CropRect:
+    height: int
+    width: int
+    x: int
+    y: int
+    @overload
+    def __init__(self) -> None: ...
+    @overload
+    def __init__(self, x: int, y: int, width: int, height: int) -> None: ...
+
 class CudaStreamEvent:
     def __init__(self, stream: int, gpu_id: int) -> None: ...
     def Record(self) -> None: ...
@@ -170,6 +183,7 @@ class DecodeMode:
     __members__: ClassVar[dict] = ...  # read-only
     ALL_FRAMES: ClassVar[DecodeMode] = ...
     KEY_FRAMES: ClassVar[DecodeMode] = ...
+    SIDE_DATA_ONLY: ClassVar[DecodeMode] = ...
     __entries: ClassVar[dict] = ...
     def __init__(self, value: int) -> None: ...
     def __eq__(self, other: object) -> bool: ...
@@ -202,6 +216,33 @@ class DecodeStatus:
     @property
     def value(self) -> int: ...
 
+class DecoderStats:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def copy_ns(self) -> int: ...
+    @property
+    def decode_ns(self) -> int: ...
+    @property
+    def max_queue_size(self) -> int: ...
+    @property
+    def num_bytes_read(self) -> int: ...
+    @property
+    def num_frm_recv(self) -> int: ...
+    @property
+    def num_frm_seek_discarded(self) -> int: ...
+    @property
+    def num_pkt_read(self) -> int: ...
+    @property
+    def num_pkt_sent(self) -> int: ...
+    @property
+    def num_seeks(self) -> int: ...
+    @property
+    def queue_capacity(self) -> int: ...
+    @property
+    def queue_size(self) -> int: ...
+    @property
+    def read_ns(self) -> int: ...
+
 class FfmpegLogLevel:
     __members__: ClassVar[dict] = ...  # read-only
     DEBUG: ClassVar[FfmpegLogLevel] = ...
@@ -223,6 +264,87 @@ class FfmpegLogLevel:
     @property
     def value(self) -> int: ...
 
+class HostBuffer:
+    def __init__(self, format: PixelFormat, width: int, height: int, numa_node: int = ...) -> None: ...
+    def __dlpack__(self, stream: None = ...) -> capsule: ...
+    def __dlpack_device__(self) -> tuple[DLDeviceType, int]: ...
+    @property
+    def Format(self) -> PixelFormat: ...
+    @property
+    def Height(self) -> int: ...
+    @property
+    def NumBytes(self) -> int: ...
+    @property
+    def NumaNode(self) -> int: ...
+    @property
+    def Shape(self) -> list[int]: ...
+    @property
+    def Width(self) -> int: ...
+    @property
+    def __array_interface__(self) -> dict: ...
+
+class HostMemPoolStats:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def bytes_cached(self) -> int: ...
+    @property
+    def bytes_in_use(self) -> int: ...
+    @property
+    def high_water_mark(self) -> int: ...
+    @property
+    def hit_rate(self) -> float: ...
+    @property
+    def hits(self) -> int: ...
+    @property
+    def misses(self) -> int: ...
+
+class LetterboxOptions:
+    mean: list[float]
+    normalize: bool
+    pad_color: list[int]
+    std: list[float]
+    def __init__(self) -> None: ...
+
+class LetterboxParams:
+    def __init__(self) -> None: ...
+    @property
+    def height(self) -> int: ...
+    @property
+    def offset_x(self) -> int: ...
+    @property
+    def offset_y(self) -> int: ...
+    @property
+    def scale(self) -> float: ...
+    @property
+    def width(self) -> int: ...
+
+class MediaParams:
+    b_frames: int
+    bit_depth: int
+    codec: str
+    container: str
+    fps: int
+    gop_size: int
+    height: int
+    num_audio_tracks: int
+    num_data_tracks: int
+    num_frames: int
+    res_switches: list[ResolutionSwitch]
+    vfr_pattern: list[int]
+    width: int
+    def __init__(self) -> None: ...
+
+class MotionSummary:
+    def __init__(self) -> None: ...
+    @property
+    def histogram(self) -> list[int]: ...
+    @property
+    def max_magnitude(self) -> float: ...
+    @property
+    def mean_magnitude(self) -> float: ...
+    @property
+    def num_vectors(self) -> int: ...
+
 class MotionVector:
     dst_x: int
     dst_y: int
@@ -348,6 +470,7 @@ class PyDecoder:
     def __init__(self, input: str, opts: dict[str, str], gpu_id: int = ..., pkt_queue_size: int = ...) -> None: ...
     @overload
     def __init__(self, buffered_reader: object, opts: dict[str, str], gpu_id: int = ..., pkt_queue_size: int = ...) -> None: ...
+    def DecodeMotionVectors(self, mvs: numpy.ndarray, counts: numpy.ndarray) -> tuple[int, TaskExecInfo]: ...
     def DecodePacketToFrame(self, frame: numpy.ndarray) -> DecodeStatus: ...
     def DecodePacketToSurface(self, surf) -> DecodeStatus: ...
     def DecodePacketToSurfaceAsync(self, surf) -> DecodeStatus: ...
@@ -356,6 +479,20 @@ class PyDecoder:
     @overload
     def DecodeSingleFrame(self, frame: numpy.ndarray, pkt_data: PacketData, seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
     @overload
+    def DecodeSingleFrame(self, frame: HostBuffer, seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
+    @overload
+    def DecodeSingleFrame(self, frame: HostBuffer, pkt_data: PacketData, seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
+    @overload
+    def DecodeSingleFrame(self, ring: ShmFrameRing, timeout_ms: int = ..., seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
+    @overload
+    def DecodeSingleFrameAsync(self, frame: numpy.ndarray, seek_ctx: SeekContext | None = ...) -> asyncio.Future[tuple[bool, TaskExecInfo]]: ...
+    @overload
+    def DecodeSingleFrameAsync(self, frame: numpy.ndarray, pkt_data: PacketData, seek_ctx: SeekContext | None = ...) -> asyncio.Future[tuple[bool, TaskExecInfo]]: ...
+    @overload
+    def DecodeSingleFrameAsync(self, frame: HostBuffer, seek_ctx: SeekContext | None = ...) -> asyncio.Future[tuple[bool, TaskExecInfo]]: ...
+    @overload
+    def DecodeSingleFrameAsync(self, frame: HostBuffer, pkt_data: PacketData, seek_ctx: SeekContext | None = ...) -> asyncio.Future[tuple[bool, TaskExecInfo]]: ...
+    @overload
     def DecodeSingleSurface(self, surf, seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
     @overload
     def DecodeSingleSurface(self, surf, pkt_data: PacketData, seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
@@ -363,10 +500,14 @@ class PyDecoder:
     def DecodeSingleSurfaceAsync(self, surf, seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
     @overload
     def DecodeSingleSurfaceAsync(self, surf, pkt_data: PacketData, seek_ctx: SeekContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
+    def GetMotionSummary(self, num_bins: int = ..., bin_width: float = ...) -> MotionSummary: ...
+    def GetSideData(self, frames_back: int = ...) -> list[SideData]: ...
     @staticmethod
     def Probe(input: str) -> list[StreamParams]: ...
     def ReadPacket(self) -> DecodeStatus: ...
     def SetMode(self, arg0: DecodeMode) -> None: ...
+    def SetSideDataTypes(self, types: list[SideDataType], history: int = ...) -> None: ...
+    def Stats(self) -> DecoderStats: ...
     @property
     def AvgFramerate(self) -> float: ...
     @property
@@ -404,10 +545,14 @@ class PyDecoder:
     @property
     def MotionVectors(self) -> list[MotionVector]: ...
     @property
+    def MotionVectorsArray(self) -> numpy.ndarray: ...
+    @property
     def NumFrames(self) -> int: ...
     @property
     def NumStreams(self) -> int: ...
     @property
+    def NumaNode(self) -> int: ...
+    @property
     def Profile(self) -> int: ...
     @property
     def StartTime(self) -> float: ...
@@ -422,10 +567,28 @@ class PyDecoder:
 
 class PyFrameConverter:
     def __init__(self, width: int, height: int, src_format: PixelFormat, dst_format: PixelFormat) -> None: ...
+    @overload
     def Run(self, src: numpy.ndarray, dst: numpy.ndarray, cc_ctx: ColorspaceConversionContext) -> tuple[bool, TaskExecInfo]: ...
+    @overload
+    def Run(self, src: HostBuffer, dst: HostBuffer, cc_ctx: ColorspaceConversionContext) -> tuple[bool, TaskExecInfo]: ...
+    @overload
+    def RunBatch(self, src: numpy.ndarray, dst: numpy.ndarray, cc_ctx: ColorspaceConversionContext) -> tuple[bool, list[TaskExecInfo]]: ...
+    @overload
+    def RunBatch(self, srcs: list[numpy.ndarray], dsts: list[numpy.ndarray], cc_ctx: ColorspaceConversionContext) -> tuple[bool, list[TaskExecInfo]]: ...
     @property
     def Format(self) -> PixelFormat: ...
 
+class PyFrameCropper:
+    def __init__(self, width: int, height: int, src_format: PixelFormat, dst_format: PixelFormat) -> None: ...
+    def Run(self, src: numpy.ndarray, rects: list[CropRect], dsts: list[numpy.ndarray], dst_width: int = ..., dst_height: int = ..., cc_ctx: ColorspaceConversionContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
+    def RunBatch(self, src: numpy.ndarray, rects: list[CropRect], dst: numpy.ndarray, dst_width: int, dst_height: int, cc_ctx: ColorspaceConversionContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
+
+class PyFrameLetterbox:
+    def __init__(self, src_width: int, src_height: int, src_format: PixelFormat, dst_width: int, dst_height: int, dst_format: PixelFormat) -> None: ...
+    def Run(self, src: numpy.ndarray, dst: numpy.ndarray, opts: LetterboxOptions = ..., cc_ctx: ColorspaceConversionContext | None = ...) -> tuple[bool, TaskExecInfo, LetterboxParams]: ...
+    @property
+    def Params(self) -> LetterboxParams: ...
+
 class PyFrameUploader:
     @overload
     def __init__(self, gpu_id: int) -> None: ...
@@ -433,6 +596,30 @@ class PyFrameUploader:
     def __init__(self, gpu_id: int, stream: int) -> None: ...
     def Run(self, src: numpy.ndarray, dst) -> tuple[bool, TaskExecInfo]: ...
 
+class PyHostFrameConverter:
+    def __init__(self, width: int, height: int, src_format: PixelFormat, dst_format: PixelFormat) -> None: ...
+    @staticmethod
+    def Conversions() -> list[tuple[PixelFormat, PixelFormat]]: ...
+    def Run(self, src: numpy.ndarray, dst: numpy.ndarray, cc_ctx: ColorspaceConversionContext | None = ...) -> tuple[bool, TaskExecInfo]: ...
+    @property
+    def Format(self) -> tuple[PixelFormat, PixelFormat]: ...
+
+class PyHostFrameUD:
+    def __init__(self, src_width: int, src_height: int, src_format: PixelFormat, dst_width: int, dst_height: int, dst_format: PixelFormat) -> None: ...
+    @overload
+    def Run(self, src: numpy.ndarray, dst: numpy.ndarray) -> tuple[bool, TaskExecInfo]: ...
+    @overload
+    def Run(self, src: HostBuffer, dst: HostBuffer) -> tuple[bool, TaskExecInfo]: ...
+    @staticmethod
+    def SupportedFormats() -> list[tuple[PixelFormat, PixelFormat]]: ...
+
+class PyHostFrameRotator:
+    def __init__(self, width: int, height: int, format: PixelFormat) -> None: ...
+    def DstSize(self, angle: float, shift_x: float = ..., shift_y: float = ...) -> tuple[int, int]: ...
+    def Run(self, src: numpy.ndarray, dst: numpy.ndarray, angle: float, shift_x: float = ..., shift_y: float = ...) -> tuple[bool, TaskExecInfo]: ...
+    @staticmethod
+    def SupportedFormats() -> list[PixelFormat]: ...
+
 class PyNvEncoder:
     @overload
     def __init__(self, settings: dict[str, str], gpu_id: int, format: PixelFormat = ..., verbose: bool = ...) -> None: ...
@@ -467,6 +654,15 @@ class PyNvJpegEncoder:
     def Context(self, compression: int, pixel_format: PixelFormat) -> NvJpegEncodeContext: ...
     def Run(self, context: NvJpegEncodeContext, surfaces: list[Surface]) -> tuple[list[numpy.ndarray], TaskExecInfo]: ...
 
+class PyPipeline:
+    def __init__(self) -> None: ...
+    def AddConverter(self, input: int, converter: PyFrameConverter, cc_ctx: ColorspaceConversionContext | None = ..., pool_size: int = ...) -> int: ...
+    def AddDecoder(self, decoder: PyDecoder, pool_size: int = ...) -> int: ...
+    def AddResizer(self, input: int, resizer: PyHostFrameUD, pool_size: int = ...) -> int: ...
+    def Pull(self, stage: int, batch_size: int = ..., timeout_ms: int = ...) -> tuple[list[tuple[HostBuffer, PacketData]], TaskExecInfo]: ...
+    def Start(self) -> None: ...
+    def Stop(self) -> None: ...
+
 class PySurfaceConverter:
     @overload
     def __init__(self, gpu_id: int) -> None: ...
@@ -520,6 +716,15 @@ class PySurfaceUD:
     @property
     def Stream(self) -> int: ...
 
+class ResolutionSwitch:
+    frame: int
+    height: int
+    width: int
+    @overload
+    def __init__(self) -> None: ...
+    @overload
+    def __init__(self, frame: int, width: int, height: int) -> None: ...
+
 class SeekContext:
     seek_frame: int
     seek_tssec: float
@@ -528,6 +733,52 @@ class SeekContext:
     @overload
     def __init__(self, seek_ts: float) -> None: ...
 
+class ShmFrameRing:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @staticmethod
+    def Attach(name: str) -> ShmFrameRing: ...
+    @staticmethod
+    def Create(name: str, num_slots: int, slot_size: int) -> ShmFrameRing: ...
+    def Acquire(self, timeout_ms: int = ...) -> tuple[HostBuffer, PacketData] | None: ...
+    @property
+    def Name(self) -> str: ...
+    @property
+    def NumSlots(self) -> int: ...
+    @property
+    def SlotSize(self) -> int: ...
+
+class SideData:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def __buffer__(self, flags: int) -> memoryview: ...
+    def __len__(self) -> int: ...
+    @property
+    def Pts(self) -> int: ...
+    @property
+    def Type(self) -> SideDataType: ...
+
+class SideDataType:
+    __members__: ClassVar[dict] = ...  # read-only
+    A53_CC: ClassVar[SideDataType] = ...
+    CONTENT_LIGHT_LEVEL: ClassVar[SideDataType] = ...
+    DISPLAYMATRIX: ClassVar[SideDataType] = ...
+    MASTERING_DISPLAY_METADATA: ClassVar[SideDataType] = ...
+    MOTION_VECTORS: ClassVar[SideDataType] = ...
+    REGIONS_OF_INTEREST: ClassVar[SideDataType] = ...
+    S12M_TIMECODE: ClassVar[SideDataType] = ...
+    SEI_UNREGISTERED: ClassVar[SideDataType] = ...
+    VIDEO_ENC_PARAMS: ClassVar[SideDataType] = ...
+    __entries: ClassVar[dict] = ...
+    def __init__(self, value: int) -> None: ...
+    def __eq__(self, other: object) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
 class StreamParams:
     avg_fps: float
     bit_rate: int
@@ -571,6 +822,8 @@ class Surface:
     @property
     def IsEmpty(self) -> bool: ...
     @property
+    def IsOnHost(self) -> bool: ...
+    @property
     def IsOwnMemory(self) -> bool: ...
     @property
     def NumPlanes(self) -> int: ...
@@ -598,6 +851,8 @@ class SurfacePlane:
     @property
     def HostFrameSize(self) -> int: ...
     @property
+    def IsOnHost(self) -> bool: ...
+    @property
     def Pitch(self) -> int: ...
     @property
     def Width(self) -> int: ...
@@ -635,6 +890,39 @@ class TaskExecInfo:
     @property
     def value(self) -> int: ...
 
+class TraceBackend:
+    __members__: ClassVar[dict] = ...  # read-only
+    CHROME: ClassVar[TraceBackend] = ...
+    NVTX: ClassVar[TraceBackend] = ...
+    OFF: ClassVar[TraceBackend] = ...
+    __entries: ClassVar[dict] = ...
+    def __init__(self, value: int) -> None: ...
+    def __eq__(self, other: object) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __index__(self) -> int: ...
+    def __int__(self) -> int: ...
+    def __ne__(self, other: object) -> bool: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
+def DumpTrace(path: str) -> int: ...
+def GenerateMedia(params: MediaParams, path: str) -> None: ...
+def GetHostMemPoolStats() -> HostMemPoolStats: ...
+def GetMemoryStats() -> dict[str, dict]: ...
 def GetNumGpus() -> int: ...
+def GetNumNumaNodes() -> int: ...
 def GetNvencParams() -> dict[str, str]: ...
+def GetSyntheticMedia(params: MediaParams, cache_dir: str = ...) -> str: ...
+def GetTaskStats() -> dict[str, dict]: ...
+def GetTraceBackend() -> TraceBackend: ...
+def ResetMemoryStatsPeaks() -> None: ...
+def ResetTaskStats() -> None: ...
 def SetFFMpegLogLevel(level: FfmpegLogLevel) -> None: ...
+def SetHostMemPoolHighWaterMark(bytes: int) -> None: ...
+def SetHostMemPoolHugePageThreshold(bytes: int) -> None: ...
+def SetMemoryStatsLogInterval(seconds: float) -> None: ...
+def SetTraceBackend(backend: TraceBackend, capacity: int = ...) -> None: ...
+def SetTraceTag(tag: str) -> None: ...
+def TrimHostMemPool() -> None: ...
@@ -0,0 +1,385 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+End-to-end throughput benchmarks.
+
+Run standard scenarios and save results:
+    python -m python_vali.bench run --json results.json
+
+Compare results with baseline, exit code is 1 if any scenario regressed,
+failed or is missing:
+    python -m python_vali.bench compare baseline.json results.json
+
+Inputs are synthetic clips made by GetSyntheticMedia, so results of
+different machines and releases are comparable. Every scenario runs in its
+own process, so peak RSS belongs to that scenario only.
+"""
+
+import argparse
+import concurrent.futures
+import json
+import multiprocessing
+import os
+import platform
+import random
+import sys
+import threading
+import time
+
+import numpy as np
+
+try:
+    import resource
+except ImportError:
+    # Not available on Windows, peak RSS isn't reported there.
+    resource = None
+
+import python_vali as vali
+
+# Metrics which gate regressions and whether bigger value is better.
+GATED_METRICS = {"fps": True, "latency_p50_ms": False}
+
+DEFAULT_THRESHOLD = 0.1
+
+# Fixed inputs, keep them unchanged or results won't be comparable.
+CLIPS = {
+    "720p": dict(codec="mpeg4", width=1280, height=720, num_frames=300,
+                 fps=30, gop_size=60, b_frames=2),
+    "1080p": dict(codec="mpeg4", width=1920, height=1080, num_frames=300,
+                  fps=30, gop_size=60, b_frames=2),
+}
+
+NUM_SEEKS = 50
+
+
+def get_clip(name: str, cache_dir: str) -> str:
+    params = vali.MediaParams()
+    for key, value in CLIPS[name].items():
+        setattr(params, key, value)
+    return vali.GetSyntheticMedia(params, cache_dir)
+
+
+class Recorder:
+    """
+    Collects per frame latencies of measured part of scenario.
+    """
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = []
+        self.start = None
+        self.cpu_start = None
+
+    def begin(self):
+        self.start = time.perf_counter()
+        self.cpu_start = time.process_time()
+
+    def add(self, latencies: list):
+        with self.lock:
+            self.latencies.extend(latencies)
+
+    def result(self) -> dict:
+        wall_time = time.perf_counter() - self.start
+        cpu_time = time.process_time() - self.cpu_start
+        lat_ms = np.array(self.latencies) * 1e3
+        return {
+            "frames": len(self.latencies),
+            "fps": len(self.latencies) / wall_time if wall_time else 0.0,
+            "latency_p50_ms": float(np.percentile(lat_ms, 50)),
+            "latency_p99_ms": float(np.percentile(lat_ms, 99)),
+            "wall_time_s": wall_time,
+            "cpu_time_s": cpu_time,
+        }
+
+
+def decode_frames(py_dec: vali.PyDecoder, num_frames: int = -1,
+                  converter=None) -> list:
+    """
+    Decodes given number of frames or until end of stream if it's negative.
+    Returns list of per frame latencies in seconds.
+    """
+    frame = np.ndarray(shape=(0), dtype=np.uint8)
+    rgb = np.ndarray(shape=(0), dtype=np.uint8)
+    cc_ctx = vali.ColorspaceConversionContext(
+        vali.ColorSpace.BT_709, vali.ColorRange.MPEG)
+
+    latencies = []
+    while num_frames < 0 or len(latencies) < num_frames:
+        start = time.perf_counter()
+        success, info = py_dec.DecodeSingleFrame(frame)
+        if not success:
+            if info == vali.TaskExecInfo.END_OF_STREAM:
+                break
+            raise RuntimeError(f"Decode failed: {info}")
+
+        if converter:
+            success, info = converter.Run(frame, rgb, cc_ctx)
+            if not success:
+                raise RuntimeError(f"Conversion failed: {info}")
+
+        latencies.append(time.perf_counter() - start)
+    return latencies
+
+
+def run_decode(clip: str, warmup: int, num_threads: int = 1,
+               convert: bool = False, reader: bool = False) -> dict:
+    """
+    Every thread decodes whole clip with its own decoder, first frames are
+    warm-up and aren't counted.
+    """
+    def make_decoder():
+        src = open(clip, "rb") if reader else clip
+        py_dec = vali.PyDecoder(src, {}, gpu_id=-1)
+        converter = None
+        if convert:
+            converter = vali.PyFrameConverter(
+                py_dec.Width, py_dec.Height, py_dec.Format,
+                vali.PixelFormat.RGB)
+        decode_frames(py_dec, warmup, converter)
+        return src, py_dec, converter
+
+    decoders = [make_decoder() for _ in range(num_threads)]
+    recorder = Recorder()
+
+    def worker(py_dec, converter):
+        recorder.add(decode_frames(py_dec, -1, converter))
+
+    recorder.begin()
+    with concurrent.futures.ThreadPoolExecutor(num_threads) as pool:
+        futures = [pool.submit(worker, py_dec, converter)
+                   for _, py_dec, converter in decoders]
+        for future in futures:
+            future.result()
+    result = recorder.result()
+
+    for src, _, _ in decoders:
+        if reader:
+            src.close()
+    return result
+
+
+def run_seek(clip: str, warmup: int, num_frames: int) -> dict:
+    """
+    Decodes single frame at random position, latency includes seek.
+    Number of frames is given because not every container stores it.
+    """
+    py_dec = vali.PyDecoder(clip, {}, gpu_id=-1)
+    frame = np.ndarray(shape=(0), dtype=np.uint8)
+    rng = random.Random(0)
+
+    def seek_once():
+        seek_ctx = vali.SeekContext(rng.randrange(num_frames))
+        start = time.perf_counter()
+        success, info = py_dec.DecodeSingleFrame(frame, seek_ctx)
+        if not success:
+            raise RuntimeError(f"Seek failed: {info}")
+        return time.perf_counter() - start
+
+    for _ in range(min(warmup, NUM_SEEKS)):
+        seek_once()
+
+    recorder = Recorder()
+    recorder.begin()
+    recorder.add([seek_once() for _ in range(NUM_SEEKS)])
+    return recorder.result()
+
+
+def get_scenarios(max_threads: int) -> dict:
+    """
+    Returns dict of scenario name to (function, clip name, kwargs).
+    """
+    scenarios = {
+        "decode_cpu_1080p": (run_decode, "1080p", {}),
+        "decode_convert_cpu_1080p": (run_decode, "1080p", {"convert": True}),
+        "decode_reader_cpu_1080p": (run_decode, "1080p", {"reader": True}),
+        "seek_cpu_1080p": (run_seek, "1080p",
+                           {"num_frames": CLIPS["1080p"]["num_frames"]}),
+    }
+
+    num_threads = 1
+    while num_threads <= max_threads:
+        scenarios[f"decode_cpu_720p_x{num_threads}"] = (
+            run_decode, "720p", {"num_threads": num_threads})
+        if num_threads == max_threads:
+            break
+        num_threads = min(num_threads * 2, max_threads)
+
+    return scenarios
+
+
+def peak_rss_mb() -> float:
+    if resource is None:
+        return None
+    rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Linux reports kilobytes, macOS reports bytes.
+    return rss / (1024 * 1024 if sys.platform == "darwin" else 1024)
+
+
+def run_scenario(name: str, max_threads: int, cache_dir: str,
+                 warmup: int) -> dict:
+    func, clip_name, kwargs = get_scenarios(max_threads)[name]
+    clip = get_clip(clip_name, cache_dir)
+    result = {"name": name}
+    result.update(func(clip, warmup, **kwargs))
+    result["peak_rss_mb"] = peak_rss_mb()
+    return result
+
+
+def run(args) -> int:
+    # Clips are made once before scenarios start.
+    for clip_name in CLIPS:
+        get_clip(clip_name, args.cache_dir)
+
+    results = []
+    failed = {}
+    ctx = multiprocessing.get_context("spawn")
+    for name in get_scenarios(args.threads):
+        if args.filter not in name:
+            continue
+
+        with concurrent.futures.ProcessPoolExecutor(1, ctx) as pool:
+            try:
+                res = pool.submit(run_scenario, name, args.threads,
+                                  args.cache_dir, args.warmup).result()
+            except Exception as e:
+                print(f"{name:<32} failed: {e}")
+                failed[name] = str(e)
+                continue
+
+        print(f"{name:<32} {res['fps']:10.1f} fps  "
+              f"p50 {res['latency_p50_ms']:8.2f} ms  "
+              f"p99 {res['latency_p99_ms']:8.2f} ms  "
+              f"cpu {res['cpu_time_s']:7.2f} s")
+        results.append(res)
+
+    report = {
+        "context": {
+            "vali_version": vali.__version__,
+            "python": platform.python_version(),
+            "platform": platform.platform(),
+            "num_cpus": os.cpu_count(),
+            "warmup": args.warmup,
+            "clips": CLIPS,
+        },
+        "scenarios": results,
+        "failed": failed,
+    }
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(report, f, indent=2)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        # Scenarios skipped by filter aren't missing.
+        baseline["scenarios"] = [res for res in baseline["scenarios"]
+                                 if args.filter in res["name"]]
+        return compare_reports(baseline, report, args.threshold)
+    return 1 if failed else 0
+
+
+def compare_reports(baseline: dict, current: dict, threshold: float) -> int:
+    """
+    Prints relative change of gated metrics. Returns 1 if any of them is
+    worse than baseline by more than threshold, if any scenario failed or
+    if baseline scenario is missing from current report, 0 otherwise.
+    """
+    base = {res["name"]: res for res in baseline["scenarios"]}
+    failed = current.get("failed", {})
+    regressed = []
+
+    for name, error in failed.items():
+        print(f"{name:<32} FAILED: {error}")
+        regressed.append(f"{name} failed")
+
+    names = {res["name"] for res in current["scenarios"]}
+    for name in base:
+        if name not in names and name not in failed:
+            print(f"{name:<32} MISSING")
+            regressed.append(f"{name} missing")
+
+    for res in current["scenarios"]:
+        if res["name"] not in base:
+            print(f"{res['name']:<32} not in baseline")
+            continue
+
+        for metric, bigger_is_better in GATED_METRICS.items():
+            old, new = base[res["name"]][metric], res[metric]
+            change = (new - old) / old if old else 0.0
+            worse = -change if bigger_is_better else change
+            status = "REGRESSED" if worse > threshold else "ok"
+            print(f"{res['name']:<32} {metric:<16} {old:10.2f} -> "
+                  f"{new:10.2f} ({change:+7.1%}) {status}")
+            if worse > threshold:
+                regressed.append(f"{res['name']} {metric}")
+
+    if regressed:
+        print(f"Regressed beyond {threshold:.0%} or broken: "
+              f"{', '.join(regressed)}")
+        return 1
+    return 0
+
+
+def compare(args) -> int:
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.current) as f:
+        current = json.load(f)
+    return compare_reports(baseline, current, args.threshold)
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(
+        prog="python -m python_vali.bench",
+        description="VALI end-to-end throughput benchmarks.")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = commands.add_parser("run", help="Run scenarios")
+    run_parser.add_argument("--json", default="",
+                            help="Save results to given file")
+    run_parser.add_argument("--filter", default="",
+                            help="Run scenarios with given substring only")
+    run_parser.add_argument("--threads", type=int,
+                            default=min(os.cpu_count() or 1, 8),
+                            help="Max number of decoders in scaling runs")
+    run_parser.add_argument("--warmup", type=int, default=30,
+                            help="Number of frames not counted")
+    run_parser.add_argument("--cache_dir", default="",
+                            help="Synthetic clips cache directory")
+    run_parser.add_argument("--baseline", default="",
+                            help="Compare results with given file")
+    run_parser.add_argument("--threshold", type=float,
+                            default=DEFAULT_THRESHOLD,
+                            help="Allowed relative regression")
+    run_parser.set_defaults(func=run)
+
+    cmp_parser = commands.add_parser("compare",
+                                     help="Compare results with baseline")
+    cmp_parser.add_argument("baseline")
+    cmp_parser.add_argument("current")
+    cmp_parser.add_argument("--threshold", type=float,
+                            default=DEFAULT_THRESHOLD,
+                            help="Allowed relative regression")
+    cmp_parser.set_defaults(func=compare)
+
+    args = parser.parse_args(argv)
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -19,8 +19,11 @@
 #include "CudaUtils.hpp"
 #include "MemoryInterfaces.hpp"
 #include "NvCodecCLIOptions.h"
+#include "Pipeline.hpp"
+#include "ShmFrameRing.hpp"
 #include "TC_CORE.hpp"
 #include "Tasks.hpp"
+#include "ThreadPool.hpp"
 
 #include <chrono>
 #include <iostream>
@@ -52,6 +55,76 @@ struct MotionVector {
   int motion_scale;
 };
 
+// Side data of decoded frame, exported to Python without copy.
+struct SideData {
+  SideDataEntry entry;
+  int64_t pts = AV_NOPTS_VALUE;
+};
+
+struct MotionSummary {
+  uint32_t num_vectors = 0U;
+  float mean_magnitude = 0.f;
+  float max_magnitude = 0.f;
+  std::vector<uint32_t> histogram;
+};
+
+// Deleter of "dltensor" capsules returned by __dlpack__ methods.
+void dlpack_capsule_deleter(PyObject* self);
+
+// Host frame stored in Buffer allocated from HostMemPool.
+// Memory is exported to numpy and DLPack consumers without copy, exported
+// tensors keep Buffer alive after HostBuffer is gone.
+class HostBuffer {
+  std::shared_ptr<Buffer> m_buf = nullptr;
+  Pixel_Format m_format = Pixel_Format::UNDEFINED;
+  uint32_t m_width = 0U;
+  uint32_t m_height = 0U;
+  uint32_t m_elem_size = 1U;
+  int m_numa_node = Numa::ANY_NODE;
+
+  // Shape and strides in elements, row-major.
+  std::vector<int64_t> m_shape;
+  std::vector<int64_t> m_strides;
+
+  void UpdateLayout();
+
+public:
+  HostBuffer(Pixel_Format format, uint32_t width, uint32_t height,
+             int numa_node = Numa::ANY_NODE);
+
+  // Wraps memory owned by someone else, e.g. shared memory ring slot.
+  // Buffer deleter may be used to give the memory back.
+  HostBuffer(std::shared_ptr<Buffer> buf, Pixel_Format format, uint32_t width,
+             uint32_t height);
+
+  // Reallocates memory if frame params differ from current ones.
+  // Memory is reused otherwise, so exported tensors see new frame data.
+  // New memory is placed on the same NUMA node.
+  void Reset(Pixel_Format format, uint32_t width, uint32_t height);
+
+  Buffer& GetBuffer() { return *m_buf.get(); }
+
+  // Exported tensors hold this reference, so memory outlives reallocation.
+  std::shared_ptr<Buffer> GetSharedBuffer() const { return m_buf; }
+
+  Pixel_Format GetFormat() const { return m_format; }
+  uint32_t GetWidth() const { return m_width; }
+  uint32_t GetHeight() const { return m_height; }
+  int GetNumaNode() const { return m_numa_node; }
+  size_t GetSize() const { return m_buf->GetRawMemSize(); }
+  void* GetData() const { return m_buf->GetRawMemPtr(); }
+
+  const std::vector<int64_t>& GetShape() const { return m_shape; }
+  const std::vector<int64_t>& GetStrides() const { return m_strides; }
+
+  DLDataType GetDataType() const;
+
+  // Numpy array interface type string, e.g. "|u1" or "<f4".
+  std::string GetTypeStr() const;
+
+  DLManagedTensor* ToDLPack() const;
+};
+
 class PyFrameUploader {
   std::unique_ptr<CudaUploadFrame> m_uploader = nullptr;
 
@@ -97,13 +170,31 @@ public:
 };
 
 class PyFrameConverter {
-  std::unique_ptr<ConvertFrame> m_up_cvt = nullptr;
-  std::unique_ptr<Buffer> m_up_ctx_buf = nullptr;
+  std::unique_ptr<TypedConvertFrame> m_up_cvt = nullptr;
   size_t m_width = 0U;
   size_t m_height = 0U;
   Pixel_Format m_src_fmt = Pixel_Format::UNDEFINED;
   Pixel_Format m_dst_fmt = Pixel_Format::UNDEFINED;
 
+  // One converter per worker thread for batch processing.
+  std::vector<std::unique_ptr<TypedConvertFrame>> m_workers;
+
+  std::vector<TaskExecInfo>
+  RunBatchImpl(const std::vector<std::pair<void*, void*>>& frames,
+               size_t src_size, size_t dst_size,
+               std::shared_ptr<ColorspaceConversionContext> context);
+
+  // Impl methods don't touch GIL, pipeline calls them from its threads.
+  bool RunImpl(Buffer& src, Buffer& dst,
+               std::shared_ptr<ColorspaceConversionContext> context,
+               TaskExecDetails& details);
+
+  bool RunImpl(HostBuffer& src, HostBuffer& dst,
+               std::shared_ptr<ColorspaceConversionContext> context,
+               TaskExecDetails& details);
+
+  friend class PyPipeline;
+
 public:
   PyFrameConverter(uint32_t width, uint32_t height, Pixel_Format inFormat,
                    Pixel_Format outFormat);
@@ -112,9 +203,131 @@ public:
            std::shared_ptr<ColorspaceConversionContext> context,
            TaskExecDetails& details);
 
+  bool Run(HostBuffer& src, HostBuffer& dst,
+           std::shared_ptr<ColorspaceConversionContext> context,
+           TaskExecDetails& details);
+
+  std::vector<TaskExecInfo>
+  RunBatch(std::vector<py::array>& srcs, std::vector<py::array>& dsts,
+           std::shared_ptr<ColorspaceConversionContext> context);
+
+  std::vector<TaskExecInfo>
+  RunBatch(py::array& src, py::array& dst,
+           std::shared_ptr<ColorspaceConversionContext> context);
+
   Pixel_Format GetFormat() const { return m_dst_fmt; }
 };
 
+class PyHostFrameConverter {
+  std::unique_ptr<ConvertHostFrame> m_cvt = nullptr;
+  Pixel_Format m_src_fmt = Pixel_Format::UNDEFINED;
+  Pixel_Format m_dst_fmt = Pixel_Format::UNDEFINED;
+
+public:
+  PyHostFrameConverter(uint32_t width, uint32_t height, Pixel_Format src_format,
+                       Pixel_Format dst_format);
+
+  bool Run(py::array& src, py::array& dst,
+           std::optional<ColorspaceConversionContext> context,
+           TaskExecDetails& details);
+
+  std::pair<Pixel_Format, Pixel_Format> GetFormat() const {
+    return std::make_pair(m_src_fmt, m_dst_fmt);
+  }
+
+  static std::list<std::pair<Pixel_Format, Pixel_Format>> GetConversions();
+};
+
+class PyHostFrameUD {
+  std::unique_ptr<UDHostFrame> m_ud = nullptr;
+  uint32_t m_src_width = 0U;
+  uint32_t m_src_height = 0U;
+  Pixel_Format m_src_fmt = Pixel_Format::UNDEFINED;
+  uint32_t m_dst_width = 0U;
+  uint32_t m_dst_height = 0U;
+  Pixel_Format m_dst_fmt = Pixel_Format::UNDEFINED;
+
+  // Doesn't touch GIL, pipeline calls it from its threads.
+  bool RunImpl(HostBuffer& src, HostBuffer& dst, TaskExecDetails& details);
+
+  friend class PyPipeline;
+
+public:
+  PyHostFrameUD(uint32_t src_width, uint32_t src_height,
+                Pixel_Format src_format, uint32_t dst_width,
+                uint32_t dst_height, Pixel_Format dst_format);
+
+  bool Run(py::array& src, py::array& dst, TaskExecDetails& details);
+
+  bool Run(HostBuffer& src, HostBuffer& dst, TaskExecDetails& details);
+
+  static std::list<std::pair<Pixel_Format, Pixel_Format>> SupportedFormats();
+};
+
+class PyHostFrameRotator {
+  std::unique_ptr<RotateHostFrame> m_rotator = nullptr;
+  uint32_t m_width = 0U;
+  uint32_t m_height = 0U;
+  uint32_t m_dst_width = 0U;
+  uint32_t m_dst_height = 0U;
+  Pixel_Format m_format = Pixel_Format::UNDEFINED;
+
+public:
+  PyHostFrameRotator(uint32_t width, uint32_t height, Pixel_Format format);
+
+  std::pair<uint32_t, uint32_t> DstSize(double angle, double shift_x,
+                                        double shift_y) const;
+
+  bool Run(double angle, double shift_x, double shift_y, py::array& src,
+           py::array& dst, TaskExecDetails& details);
+
+  static std::list<Pixel_Format> SupportedFormats();
+};
+
+class PyFrameLetterbox {
+  std::unique_ptr<LetterboxFrame> m_letterbox = nullptr;
+  size_t m_src_width = 0U;
+  size_t m_src_height = 0U;
+  Pixel_Format m_src_fmt = Pixel_Format::UNDEFINED;
+
+public:
+  PyFrameLetterbox(uint32_t src_width, uint32_t src_height,
+                   Pixel_Format src_format, uint32_t dst_width,
+                   uint32_t dst_height, Pixel_Format dst_format);
+
+  bool Run(py::array& src, py::array& dst, const LetterboxOptions& opts,
+           std::optional<ColorspaceConversionContext> context,
+           TaskExecDetails& details);
+
+  const LetterboxParams& GetParams() const {
+    return m_letterbox->GetParams();
+  }
+};
+
+class PyFrameCropper {
+  std::unique_ptr<CropFrame> m_cropper = nullptr;
+  size_t m_width = 0U;
+  size_t m_height = 0U;
+  Pixel_Format m_src_fmt = Pixel_Format::UNDEFINED;
+
+  bool CheckSrc(py::array& src, TaskExecDetails& details) const;
+
+public:
+  PyFrameCropper(uint32_t width, uint32_t height, Pixel_Format src_format,
+                 Pixel_Format dst_format);
+
+  bool Run(py::array& src, const std::vector<CropRect>& rects,
+           std::vector<py::array>& dsts, uint32_t dst_width,
+           uint32_t dst_height,
+           std::optional<ColorspaceConversionContext> context,
+           TaskExecDetails& details);
+
+  bool RunBatch(py::array& src, const std::vector<CropRect>& rects,
+                py::array& dst, uint32_t dst_width, uint32_t dst_height,
+                std::optional<ColorspaceConversionContext> context,
+                TaskExecDetails& details);
+};
+
 class PySurfaceResizer {
   std::unique_ptr<ResizeSurface> upResizer = nullptr;
 
@@ -149,16 +362,24 @@ private:
   bool m_is_seekable = true;
 };
 
+struct AsyncDecodeStrand;
+
 class PyDecoder {
   std::unique_ptr<DecodeFrame> upDecoder = nullptr;
   std::unique_ptr<BufferedReader> upBuff = nullptr;
 
+  // Async decode calls, created upon first call.
+  std::shared_ptr<AsyncDecodeStrand> m_async = nullptr;
+
   void* GetSideData(AVFrameSideDataType data_type, size_t& raw_size);
 
   uint32_t last_w;
   uint32_t last_h;
   int gpu_id;
 
+  // Decoded frames go here when only motion vectors are needed.
+  std::unique_ptr<Buffer> m_mv_frame = nullptr;
+
   void UpdateState();
 
 public:
@@ -180,12 +401,51 @@ public:
                          PacketData& pkt_data,
                          std::optional<SeekContext> seek_ctx);
 
+  bool DecodeSingleFrame(HostBuffer& frame, TaskExecDetails& details,
+                         PacketData& pkt_data,
+                         std::optional<SeekContext> seek_ctx);
+
   bool DecodeSingleSurface(Surface& surf, TaskExecDetails& details,
                            PacketData& pkt_data,
                            std::optional<SeekContext> seek_ctx);
 
+  // Decode on worker thread. Return asyncio future of running event loop
+  // which gets (success, info) tuple. Packet data is updated, if given, by
+  // the time future is done.
+  py::object DecodeSingleFrameAsync(py::array& frame, PacketData* pkt_data,
+                                    std::optional<SeekContext> seek_ctx);
+
+  py::object DecodeSingleFrameAsync(HostBuffer& frame, PacketData* pkt_data,
+                                    std::optional<SeekContext> seek_ctx);
+
   std::vector<MotionVector> GetMotionVectors();
 
+  // Returns motion vectors of last decoded frame as structured array which
+  // shares memory with libavutil side data.
+  py::array GetMotionVectorsArray();
+
+  // Selects side data types saved for every decoded frame.
+  void SetSideDataTypes(const std::vector<AVFrameSideDataType>& types,
+                        size_t history);
+
+  // Returns side data of recent frame, 0 is last decoded frame.
+  // Throws std::out_of_range if frame is out of history.
+  std::vector<SideData> GetFrameSideData(size_t frames_back) const;
+
+  // Waits for free ring slot and decodes frame into it.
+  bool DecodeSingleFrame(ShmFrameRing& ring, int timeout_ms,
+                         TaskExecDetails& details, PacketData& pkt_data,
+                         std::optional<SeekContext> seek_ctx);
+
+  // Computes motion vectors length statistics of last decoded frame.
+  MotionSummary GetMotionSummary(uint32_t num_bins, float bin_width);
+
+  // Decodes up to counts.size() frames and stores their motion vectors one
+  // after another. Returns number of decoded frames.
+  size_t DecodeMotionVectors(py::array_t<AVMotionVector>& mvs,
+                             py::array_t<int32_t>& counts,
+                             TaskExecDetails& details);
+
   uint32_t Width() const;
   uint32_t Height() const;
   uint32_t Level() const;
@@ -212,6 +472,8 @@ public:
 
   bool IsAccelerated() const;
   bool IsVFR() const;
+  int GetNumaNode() const;
+  DecoderStats GetStats() const;
 
   CUstream GetStream() const;
 
@@ -225,6 +487,19 @@ public:
 private:
   bool DecodeImpl(TaskExecDetails& details, PacketData& pkt_data, Token& dst,
                   std::optional<SeekContext> seek_ctx);
+
+  // Doesn't touch GIL, pipeline calls it from its threads.
+  bool DecodeHostFrameImpl(HostBuffer& frame, TaskExecDetails& details,
+                           PacketData& pkt_data,
+                           std::optional<SeekContext> seek_ctx);
+
+  // Queues async call, func is called on worker thread without GIL.
+  // Objects func refers to are kept alive by keep_alive until call is done.
+  py::object
+  SubmitAsync(std::function<bool(TaskExecDetails&, PacketData&)> func,
+              py::object keep_alive, PacketData* pkt_data);
+
+  friend class PyPipeline;
 };
 
 class PyNvEncoder {
@@ -348,4 +623,45 @@ public:
 
 private:
   std::shared_ptr<UDSurface> m_ud;
-};
\ No newline at end of file
+};
+
+// Builds pipeline of CPU stages which pass HostBuffer frames to each other.
+// Stages run on pipeline threads without GIL, so decoder, converters and
+// resizers added to pipeline must not be used until it's stopped.
+class PyPipeline {
+  // Stage output frame params, checked against downstream stage inputs.
+  struct StageInfo {
+    Pixel_Format format = Pixel_Format::UNDEFINED;
+    uint32_t width = 0U;
+    uint32_t height = 0U;
+    size_t pool_size = 0U;
+  };
+
+  std::unique_ptr<Pipeline> m_pipeline;
+  std::vector<StageInfo> m_stages;
+
+  const StageInfo& GetStage(size_t stage) const;
+
+public:
+  PyPipeline();
+  ~PyPipeline();
+
+  size_t AddDecoder(PyDecoder& decoder, size_t pool_size);
+
+  size_t AddConverter(size_t input, PyFrameConverter& converter,
+                      std::shared_ptr<ColorspaceConversionContext> context,
+                      size_t pool_size);
+
+  size_t AddResizer(size_t input, PyHostFrameUD& resizer, size_t pool_size);
+
+  void Start();
+  void Stop();
+
+  // Takes up to batch_size frames from sink stage. Returns SUCCESS if batch
+  // is full, reason why it isn't otherwise.
+  // Throws std::invalid_argument if batch doesn't fit into stage pool.
+  TaskExecDetails
+  Pull(size_t stage, size_t batch_size, int timeout_ms,
+       std::vector<std::pair<std::shared_ptr<HostBuffer>,
+                             std::shared_ptr<PacketData>>>& frames);
+};
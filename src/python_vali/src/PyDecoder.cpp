@@ -17,6 +17,10 @@
 #include "Utils.hpp"
 #include "VALI.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
 using namespace std;
 using namespace VPF;
 using namespace chrono;
@@ -87,15 +91,99 @@ bool PyDecoder::DecodeSingleFrame(py::array& frame, TaskExecDetails& details,
   }
 
   auto const frame_size = upDecoder->GetHostFrameSize();
-  if (frame_size != frame.nbytes()) {
+  if (frame_size != frame.nbytes() &&
+      DecodeMode::SIDE_DATA_ONLY != GetMode()) {
     frame.resize({frame_size}, false);
   }
 
-  auto dst = std::shared_ptr<Buffer>(
-      Buffer::Make(frame.nbytes(), frame.mutable_data()));
+  Buffer dst(frame.nbytes(), frame.mutable_data(), false);
 
   py::gil_scoped_release gil_release{};
-  return DecodeImpl(details, pkt_data, *dst.get(), seek_ctx);
+  return DecodeImpl(details, pkt_data, dst, seek_ctx);
+}
+
+bool PyDecoder::DecodeSingleFrame(HostBuffer& frame, TaskExecDetails& details,
+                                  PacketData& pkt_data,
+                                  std::optional<SeekContext> seek_ctx) {
+  py::gil_scoped_release gil_release{};
+  return DecodeHostFrameImpl(frame, details, pkt_data, seek_ctx);
+}
+
+bool PyDecoder::DecodeHostFrameImpl(HostBuffer& frame, TaskExecDetails& details,
+                                    PacketData& pkt_data,
+                                    std::optional<SeekContext> seek_ctx) {
+  if (IsAccelerated()) {
+    details.m_info = TaskExecInfo::FAIL;
+    return false;
+  }
+
+  if (DecodeMode::SIDE_DATA_ONLY == GetMode()) {
+    return DecodeImpl(details, pkt_data, frame.GetBuffer(), seek_ctx);
+  }
+
+  frame.Reset(PixelFormat(), Width(), Height());
+  if (frame.GetSize() != upDecoder->GetHostFrameSize()) {
+    details.m_info = TaskExecInfo::FAIL;
+    return false;
+  }
+
+  return DecodeImpl(details, pkt_data, frame.GetBuffer(), seek_ctx);
+}
+
+bool PyDecoder::DecodeSingleFrame(ShmFrameRing& ring, int timeout_ms,
+                                  TaskExecDetails& details,
+                                  PacketData& pkt_data,
+                                  std::optional<SeekContext> seek_ctx) {
+  if (IsAccelerated()) {
+    details.m_info = TaskExecInfo::FAIL;
+    return false;
+  }
+
+  auto const frame_size = upDecoder->GetHostFrameSize();
+  if (frame_size > ring.SlotSize()) {
+    details.m_info = TaskExecInfo::SRC_DST_SIZE_MISMATCH;
+    return false;
+  }
+
+  py::gil_scoped_release gil_release{};
+  auto const slot = ring.AcquireWrite(timeout_ms);
+  if (slot < 0) {
+    details.m_info = TaskExecInfo::FAIL;
+    details.m_msg = "no free ring slot";
+    return false;
+  }
+
+  auto dst = std::shared_ptr<Buffer>(
+      Buffer::Make(frame_size, ring.SlotData(slot)));
+
+  auto res = false;
+  try {
+    res = DecodeImpl(details, pkt_data, *dst.get(), seek_ctx);
+  } catch (...) {
+    ring.Abort(slot);
+    throw;
+  }
+
+  // Frame isn't returned upon resolution change.
+  if (!res || TaskExecInfo::RES_CHANGE == details.m_info) {
+    ring.Abort(slot);
+    return res;
+  }
+
+  ShmFrameInfo info;
+  info.size = frame_size;
+  info.width = Width();
+  info.height = Height();
+  info.format = PixelFormat();
+  info.key = pkt_data.key;
+  info.pts = pkt_data.pts;
+  info.dts = pkt_data.dts;
+  info.pos = pkt_data.pos;
+  info.bsl = pkt_data.bsl;
+  info.duration = pkt_data.duration;
+  ring.Publish(slot, info);
+
+  return true;
 }
 
 bool PyDecoder::DecodeSingleSurface(Surface& surf, TaskExecDetails& details,
@@ -177,6 +265,148 @@ std::vector<MotionVector> PyDecoder::GetMotionVectors() {
   return std::vector<MotionVector>();
 }
 
+py::array PyDecoder::GetMotionVectorsArray() {
+  auto ref = upDecoder->GetSideDataRef(AV_FRAME_DATA_MOTION_VECTORS);
+  if (!ref) {
+    return py::array_t<AVMotionVector>(0U);
+  }
+
+  // Capsule holds side data reference, array memory stays valid after next
+  // frame is decoded.
+  auto owner = new std::shared_ptr<AVBufferRef>(ref);
+  py::capsule base(owner, [](void* p) {
+    delete (std::shared_ptr<AVBufferRef>*)p;
+  });
+
+  auto const num_elems = (py::ssize_t)(ref->size / sizeof(AVMotionVector));
+  auto const stride = (py::ssize_t)sizeof(AVMotionVector);
+  py::array_t<AVMotionVector> mvs({num_elems}, {stride},
+                                  (AVMotionVector*)ref->data, base);
+
+  // Side data may be shared with other frame references.
+  mvs.attr("setflags")(py::arg("write") = false);
+  return mvs;
+}
+
+void PyDecoder::SetSideDataTypes(const std::vector<AVFrameSideDataType>& types,
+                                 size_t history) {
+  upDecoder->SetSideDataTypes({types.begin(), types.end()}, history);
+}
+
+std::vector<SideData> PyDecoder::GetFrameSideData(size_t frames_back) const {
+  int64_t pts = AV_NOPTS_VALUE;
+  std::vector<SideDataEntry> entries;
+  if (!upDecoder->GetFrameSideData(frames_back, pts, entries)) {
+    throw std::out_of_range("Frame is out of side data history");
+  }
+
+  std::vector<SideData> side_data(entries.size());
+  for (auto i = 0U; i < entries.size(); i++) {
+    side_data[i].entry = entries[i];
+    side_data[i].pts = pts;
+  }
+  return side_data;
+}
+
+MotionSummary PyDecoder::GetMotionSummary(uint32_t num_bins,
+                                          float bin_width) {
+  if (!num_bins || bin_width <= 0.f) {
+    throw std::invalid_argument("Invalid motion histogram params");
+  }
+
+  MotionSummary summary;
+  summary.histogram.resize(num_bins, 0U);
+
+  auto ref = upDecoder->GetSideDataRef(AV_FRAME_DATA_MOTION_VECTORS);
+  if (!ref) {
+    return summary;
+  }
+
+  auto const mvs = (const AVMotionVector*)ref->data;
+  summary.num_vectors = ref->size / sizeof(AVMotionVector);
+
+  double sum = 0.0;
+  for (auto i = 0U; i < summary.num_vectors; i++) {
+    auto const scale = mvs[i].motion_scale ? (float)mvs[i].motion_scale : 1.f;
+    auto const magnitude =
+        std::hypot((float)mvs[i].motion_x, (float)mvs[i].motion_y) / scale;
+
+    sum += magnitude;
+    summary.max_magnitude = std::max(summary.max_magnitude, magnitude);
+
+    auto const bin = std::min(num_bins - 1U, (uint32_t)(magnitude / bin_width));
+    summary.histogram[bin]++;
+  }
+
+  if (summary.num_vectors) {
+    summary.mean_magnitude = (float)(sum / summary.num_vectors);
+  }
+
+  return summary;
+}
+
+size_t PyDecoder::DecodeMotionVectors(py::array_t<AVMotionVector>& mvs,
+                                      py::array_t<int32_t>& counts,
+                                      TaskExecDetails& details) {
+  if (IsAccelerated()) {
+    details.m_info = TaskExecInfo::NOT_SUPPORTED;
+    return 0U;
+  }
+
+  if (mvs.ndim() != 1 || counts.ndim() != 1) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return 0U;
+  }
+
+  auto p_mvs = mvs.mutable_data();
+  auto p_counts = counts.mutable_data();
+  auto const capacity = (size_t)mvs.size();
+  auto const num_frames = (size_t)counts.size();
+
+  if (!m_mv_frame) {
+    m_mv_frame.reset(Buffer::MakeOwnMem(0U));
+  }
+
+  py::gil_scoped_release gil_release{};
+  PacketData pkt_data;
+  size_t offset = 0U;
+  size_t num_decoded = 0U;
+
+  while (num_decoded < num_frames) {
+    if (DecodeMode::SIDE_DATA_ONLY != GetMode()) {
+      m_mv_frame->Update(upDecoder->GetHostFrameSize());
+    }
+    if (!DecodeImpl(details, pkt_data, *m_mv_frame.get(), std::nullopt)) {
+      break;
+    }
+
+    // Stashed frame will be returned by next call.
+    if (TaskExecInfo::RES_CHANGE == details.m_info) {
+      continue;
+    }
+
+    auto ref = upDecoder->GetSideDataRef(AV_FRAME_DATA_MOTION_VECTORS);
+    auto num_elems = ref ? ref->size / sizeof(AVMotionVector) : 0U;
+    if (offset + num_elems > capacity) {
+      details.m_info = TaskExecInfo::SRC_DST_SIZE_MISMATCH;
+      num_elems = capacity - offset;
+    }
+
+    if (num_elems) {
+      memcpy(p_mvs + offset, ref->data, num_elems * sizeof(AVMotionVector));
+    }
+
+    p_counts[num_decoded++] = (int32_t)num_elems;
+    offset += num_elems;
+
+    if (TaskExecInfo::SRC_DST_SIZE_MISMATCH == details.m_info) {
+      break;
+    }
+  }
+
+  return num_decoded;
+}
+
 uint32_t PyDecoder::Width() const {
   Params params;
   upDecoder->GetParams(params);
@@ -291,6 +521,10 @@ Pixel_Format PyDecoder::PixelFormat() const {
 
 bool PyDecoder::IsAccelerated() const { return upDecoder->IsAccelerated(); }
 
+int PyDecoder::GetNumaNode() const { return upDecoder->GetNumaNode(); }
+
+DecoderStats PyDecoder::GetStats() const { return upDecoder->GetStats(); }
+
 bool PyDecoder::IsVFR() const {
   Params params;
   upDecoder->GetParams(params);
@@ -327,14 +561,83 @@ DECODE_STATUS PyDecoder::DecodePacketToFrame(py::array& frame) {
   if (frame_size != frame.nbytes())
     frame.resize({frame_size}, false);
 
-  auto dst = std::shared_ptr<Buffer>(
-      Buffer::Make(frame.nbytes(), frame.mutable_data()));
+  Buffer dst(frame.nbytes(), frame.mutable_data(), false);
 
   py::gil_scoped_release gil_release{};
-  return upDecoder->DecodePacket(*dst.get());
+  return upDecoder->DecodePacket(dst);
 }
 
 void Init_PyDecoder(py::module& m) {
+  py::class_<DecoderStats>(m, "DecoderStats", "Decoder statistics")
+      .def_readonly("num_pkt_read", &DecoderStats::num_pkt_read,
+                    R"pbdoc(
+         Number of packets read from input, including other streams.
+     )pbdoc")
+      .def_readonly("num_pkt_sent", &DecoderStats::num_pkt_sent,
+                    R"pbdoc(
+         Number of packets accepted by decoder.
+     )pbdoc")
+      .def_readonly("num_frm_recv", &DecoderStats::num_frm_recv,
+                    R"pbdoc(
+         Number of frames received from decoder.
+     )pbdoc")
+      .def_readonly("num_bytes_read", &DecoderStats::num_bytes_read,
+                    R"pbdoc(
+         Payload size of all packets read from input.
+     )pbdoc")
+      .def_readonly("num_seeks", &DecoderStats::num_seeks,
+                    R"pbdoc(
+         Number of seeks performed.
+     )pbdoc")
+      .def_readonly("num_frm_seek_discarded",
+                    &DecoderStats::num_frm_seek_discarded,
+                    R"pbdoc(
+         Number of frames decoded and discarded on the way to seek target.
+     )pbdoc")
+      .def_readonly("read_ns", &DecoderStats::read_ns,
+                    R"pbdoc(
+         Time spent reading packets from input in nanoseconds.
+     )pbdoc")
+      .def_readonly("decode_ns", &DecoderStats::decode_ns,
+                    R"pbdoc(
+         Time spent sending packets to decoder and receiving frames from it
+         in nanoseconds.
+     )pbdoc")
+      .def_readonly("copy_ns", &DecoderStats::copy_ns,
+                    R"pbdoc(
+         Time spent copying decoded frames to output in nanoseconds.
+     )pbdoc")
+      .def_readonly("queue_size", &DecoderStats::queue_size,
+                    R"pbdoc(
+         Number of packets in queue.
+     )pbdoc")
+      .def_readonly("max_queue_size", &DecoderStats::max_queue_size,
+                    R"pbdoc(
+         Max number of packets queue ever had. If it reaches queue capacity,
+         input is read faster than it's decoded.
+     )pbdoc")
+      .def_readonly("queue_capacity", &DecoderStats::queue_capacity,
+                    R"pbdoc(
+         Packet queue capacity, set by pkt_queue_size decoder argument.
+     )pbdoc")
+      .def("__repr__", [](const DecoderStats& self) {
+        std::stringstream ss;
+        ss << "num_pkt_read:           " << self.num_pkt_read << "\n";
+        ss << "num_pkt_sent:           " << self.num_pkt_sent << "\n";
+        ss << "num_frm_recv:           " << self.num_frm_recv << "\n";
+        ss << "num_bytes_read:         " << self.num_bytes_read << "\n";
+        ss << "num_seeks:              " << self.num_seeks << "\n";
+        ss << "num_frm_seek_discarded: " << self.num_frm_seek_discarded
+           << "\n";
+        ss << "read_ns:                " << self.read_ns << "\n";
+        ss << "decode_ns:              " << self.decode_ns << "\n";
+        ss << "copy_ns:                " << self.copy_ns << "\n";
+        ss << "queue_size:             " << self.queue_size << "\n";
+        ss << "max_queue_size:         " << self.max_queue_size << "\n";
+        ss << "queue_capacity:         " << self.queue_capacity << "\n";
+        return ss.str();
+      });
+
   py::class_<PyDecoder, shared_ptr<PyDecoder>>(m, "PyDecoder",
                                                "Video decoder class.")
       .def(py::init<const string&, const map<string, string>&, int, int>(),
@@ -350,6 +653,9 @@ void Init_PyDecoder(py::module& m) {
          :type input: str
          :param opts: Dictionary of options to pass to libavcodec API. Can include:
              - preferred_width: Select a stream with desired width from multiple video streams
+             - numa_node: NUMA node to place decoded frames on, "auto" picks nodes round-robin
+             - cpu_set: CPUs to pin libavcodec worker threads to in Linux format, e.g. "0-3,8".
+               Affinity of thread which calls decoding methods is left untouched.
              - Other FFmpeg options as key-value pairs
          :type opts: dict[str, str]
          :param gpu_id: GPU device ID to use for hardware acceleration. Default is 0.
@@ -372,6 +678,9 @@ void Init_PyDecoder(py::module& m) {
          :type buffered_reader: object
          :param opts: Dictionary of options to pass to libavcodec API. Can include:
              - preferred_width: Select a stream with desired width from multiple video streams
+             - numa_node: NUMA node to place decoded frames on, "auto" picks nodes round-robin
+             - cpu_set: CPUs to pin libavcodec worker threads to in Linux format, e.g. "0-3,8".
+               Affinity of thread which calls decoding methods is left untouched.
              - Other FFmpeg options as key-value pairs
          :type opts: dict[str, str]
          :param gpu_id: GPU device ID to use for hardware acceleration. Default is 0.
@@ -386,7 +695,8 @@ void Init_PyDecoder(py::module& m) {
                              R"pbdoc(
          Get the current decoder operation mode.
 
-         :return: Current decode mode (e.g., KEY_FRAMES, ALL_FRAMES)
+         :return: Current decode mode (e.g., KEY_FRAMES, ALL_FRAMES,
+             SIDE_DATA_ONLY)
          :rtype: DecodeMode
      )pbdoc")
       .def("SetMode", &PyDecoder::SetMode,
@@ -396,6 +706,13 @@ void Init_PyDecoder(py::module& m) {
 
          Changes how the decoder processes frames and handles seeking operations.
          When in KEY_FRAMES mode, seeking will return the closest previous key frame.
+         When in SIDE_DATA_ONLY mode, output frames and surfaces aren't touched,
+         only side data such as motion vectors and display rotation is updated.
+         Frames are still fully decoded, so switching back to ALL_FRAMES gives
+         correct pixels right away. To save time on deblocking, pass
+         "skip_loop_filter": "all" option to decoder constructor. Reference
+         frames are then stored without deblocking, so pixels decoded with
+         that option drift until next key frame.
          When switching modes, the internal frame queue is preserved to avoid discarding
          decoded frames that may be needed for future operations.
 
@@ -461,6 +778,204 @@ void Init_PyDecoder(py::module& m) {
              - info (TaskExecInfo): Detailed execution information
          :rtype: tuple[bool, TaskExecInfo]
          :raises RuntimeError: If called with hardware acceleration enabled
+     )pbdoc")
+      .def(
+          "DecodeSingleFrame",
+          [](PyDecoder& self, HostBuffer& frame,
+             std::optional<SeekContext>& seek_ctx) {
+            TaskExecDetails details;
+            PacketData pkt_data;
+
+            auto res =
+                self.DecodeSingleFrame(frame, details, pkt_data, seek_ctx);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("frame"), py::arg("seek_ctx") = std::nullopt,
+          R"pbdoc(
+         Decode a single video frame into host buffer.
+
+         This method is for CPU-only decoding (non-accelerated decoder).
+         HostBuffer is reallocated if its format or size doesn't match
+         decoder output. Decoded frame can be passed to numpy or torch
+         without copy via numpy.asarray() or from_dlpack().
+
+         :param frame: Host buffer to store the decoded frame
+         :type frame: HostBuffer
+         :param seek_ctx: Optional seek context for frame positioning
+         :type seek_ctx: Optional[SeekContext]
+         :return: Tuple containing:
+             - success (bool): True if decoding was successful
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: tuple[bool, TaskExecInfo]
+         :raises ValueError: If decoder pixel format isn't supported
+     )pbdoc")
+      .def(
+          "DecodeSingleFrame",
+          [](PyDecoder& self, HostBuffer& frame, PacketData& pkt_data,
+             std::optional<SeekContext>& seek_ctx) {
+            TaskExecDetails details;
+
+            auto res =
+                self.DecodeSingleFrame(frame, details, pkt_data, seek_ctx);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("frame"), py::arg("pkt_data"),
+          py::arg("seek_ctx") = std::nullopt,
+          R"pbdoc(
+         Decode a single video frame with packet data into host buffer.
+
+         Same as the overload above, packet metadata will be stored in
+         pkt_data.
+
+         :param frame: Host buffer to store the decoded frame
+         :type frame: HostBuffer
+         :param pkt_data: Object to store packet metadata
+         :type pkt_data: PacketData
+         :param seek_ctx: Optional seek context for frame positioning
+         :type seek_ctx: Optional[SeekContext]
+         :return: Tuple containing:
+             - success (bool): True if decoding was successful
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: tuple[bool, TaskExecInfo]
+         :raises ValueError: If decoder pixel format isn't supported
+     )pbdoc")
+      .def(
+          "DecodeSingleFrameAsync",
+          [](PyDecoder& self, py::array& frame,
+             std::optional<SeekContext>& seek_ctx) {
+            return self.DecodeSingleFrameAsync(frame, nullptr, seek_ctx);
+          },
+          py::arg("frame"), py::arg("seek_ctx") = std::nullopt,
+          R"pbdoc(
+         Decode a single video frame on VALI worker thread.
+
+         Must be called from coroutine running in asyncio event loop.
+         Same as DecodeSingleFrame but returns immediately. Calls of one
+         decoder run one by one in order they were made, calls of different
+         decoders run in parallel. Completion is signalled to event loop
+         through file descriptor, so no executor threads are needed.
+
+         Cancelling returned future skips queued call and stops running one.
+         Don't call other decoder methods while its calls are in flight.
+         Frame must not be used until future is done.
+
+         :param frame: Numpy array to store the decoded frame
+         :type frame: numpy.ndarray
+         :param seek_ctx: Optional seek context for frame positioning
+         :type seek_ctx: Optional[SeekContext]
+         :return: Future which gets tuple containing:
+             - success (bool): True if decoding was successful
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: asyncio.Future[tuple[bool, TaskExecInfo]]
+         :raises RuntimeError: If there's no running event loop
+     )pbdoc")
+      .def(
+          "DecodeSingleFrameAsync",
+          [](PyDecoder& self, py::array& frame, PacketData& pkt_data,
+             std::optional<SeekContext>& seek_ctx) {
+            return self.DecodeSingleFrameAsync(frame, &pkt_data, seek_ctx);
+          },
+          py::arg("frame"), py::arg("pkt_data"),
+          py::arg("seek_ctx") = std::nullopt,
+          R"pbdoc(
+         Decode a single video frame with packet data on VALI worker thread.
+
+         Same as the overload above, packet metadata will be stored in
+         pkt_data by the time future is done.
+
+         :param frame: Numpy array to store the decoded frame
+         :type frame: numpy.ndarray
+         :param pkt_data: Object to store packet metadata
+         :type pkt_data: PacketData
+         :param seek_ctx: Optional seek context for frame positioning
+         :type seek_ctx: Optional[SeekContext]
+         :return: Future which gets tuple containing:
+             - success (bool): True if decoding was successful
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: asyncio.Future[tuple[bool, TaskExecInfo]]
+         :raises RuntimeError: If there's no running event loop
+     )pbdoc")
+      .def(
+          "DecodeSingleFrameAsync",
+          [](PyDecoder& self, HostBuffer& frame,
+             std::optional<SeekContext>& seek_ctx) {
+            return self.DecodeSingleFrameAsync(frame, nullptr, seek_ctx);
+          },
+          py::arg("frame"), py::arg("seek_ctx") = std::nullopt,
+          R"pbdoc(
+         Decode a single video frame into host buffer on VALI worker thread.
+
+         Same as DecodeSingleFrame with host buffer but returns future, see
+         numpy overload for details.
+
+         :param frame: Host buffer to store the decoded frame
+         :type frame: HostBuffer
+         :param seek_ctx: Optional seek context for frame positioning
+         :type seek_ctx: Optional[SeekContext]
+         :return: Future which gets tuple containing:
+             - success (bool): True if decoding was successful
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: asyncio.Future[tuple[bool, TaskExecInfo]]
+         :raises RuntimeError: If there's no running event loop
+     )pbdoc")
+      .def(
+          "DecodeSingleFrameAsync",
+          [](PyDecoder& self, HostBuffer& frame, PacketData& pkt_data,
+             std::optional<SeekContext>& seek_ctx) {
+            return self.DecodeSingleFrameAsync(frame, &pkt_data, seek_ctx);
+          },
+          py::arg("frame"), py::arg("pkt_data"),
+          py::arg("seek_ctx") = std::nullopt,
+          R"pbdoc(
+         Decode a single video frame with packet data into host buffer on
+         VALI worker thread.
+
+         Same as the overload above, packet metadata will be stored in
+         pkt_data by the time future is done.
+
+         :param frame: Host buffer to store the decoded frame
+         :type frame: HostBuffer
+         :param pkt_data: Object to store packet metadata
+         :type pkt_data: PacketData
+         :param seek_ctx: Optional seek context for frame positioning
+         :type seek_ctx: Optional[SeekContext]
+         :return: Future which gets tuple containing:
+             - success (bool): True if decoding was successful
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: asyncio.Future[tuple[bool, TaskExecInfo]]
+         :raises RuntimeError: If there's no running event loop
+     )pbdoc")
+      .def(
+          "DecodeSingleFrame",
+          [](PyDecoder& self, ShmFrameRing& ring, int timeout_ms,
+             std::optional<SeekContext>& seek_ctx) {
+            TaskExecDetails details;
+            PacketData pkt_data;
+
+            auto res = self.DecodeSingleFrame(ring, timeout_ms, details,
+                                              pkt_data, seek_ctx);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("ring"), py::arg("timeout_ms") = -1,
+          py::arg("seek_ctx") = std::nullopt,
+          R"pbdoc(
+         Decode a single video frame into shared memory ring slot.
+
+         This method is for CPU-only decoding (non-accelerated decoder).
+         Waits for free slot, decodes frame straight into it and publishes
+         it along with packet metadata. Consumer processes get the frame
+         from ShmFrameRing.Acquire() without copy.
+
+         :param ring: Shared memory ring, slot size must fit decoded frame
+         :type ring: ShmFrameRing
+         :param timeout_ms: Free slot wait timeout, negative means no timeout
+         :type timeout_ms: int
+         :param seek_ctx: Optional seek context for frame positioning
+         :type seek_ctx: Optional[SeekContext]
+         :return: Tuple containing:
+             - success (bool): True if decoding was successful
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: tuple[bool, TaskExecInfo]
      )pbdoc")
       .def(
           "DecodeSingleSurface",
@@ -756,6 +1271,11 @@ void Init_PyDecoder(py::module& m) {
       .def_property_readonly("IsAccelerated", &PyDecoder::IsAccelerated,
                              R"pbdoc(
         Return true if decoder has HW acceleration support, false otherwise.
+    )pbdoc")
+      .def_property_readonly("NumaNode", &PyDecoder::GetNumaNode,
+                             R"pbdoc(
+        Return NUMA node decoded frames are placed on, -1 if there's no
+        placement preference. Only CPU decoder places frames.
     )pbdoc")
       .def_property_readonly("MotionVectors", &PyDecoder::GetMotionVectors,
                              py::call_guard<py::gil_scoped_release>(),
@@ -765,6 +1285,113 @@ void Init_PyDecoder(py::module& m) {
 
        :return: list of motion vectors
        :rtype: List[vali.MotionVector]
+    )pbdoc")
+      .def_property_readonly("MotionVectorsArray",
+                             &PyDecoder::GetMotionVectorsArray,
+                             R"pbdoc(
+        Return motion vectors of last decoded frame as read-only numpy
+        structured array of MotionVectorDtype.
+
+        Array shares memory with decoder side data, no copy is made. It stays
+        valid after next frame is decoded. If there are no motion vectors it
+        will return empty array.
+
+       :return: array of motion vectors
+       :rtype: numpy.ndarray
+    )pbdoc")
+      .def("SetSideDataTypes", &PyDecoder::SetSideDataTypes,
+           py::arg("types"), py::arg("history") = 1U,
+           py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(
+        Select side data types saved for every decoded frame.
+
+        Only selected types are saved. By default motion vectors and display
+        matrix of last decoded frame are saved. Side data isn't copied,
+        references to it are kept for given number of recent frames.
+
+        Some side data is only exported by libavcodec if asked to, e.g.
+        "flags2": "+export_mvs" for motion vectors and
+        "export_side_data": "+venc_params" for encoding parameters.
+
+       :param types: Side data types to save
+       :type types: list[SideDataType]
+       :param history: Number of recent frames to keep side data for
+       :type history: int
+    )pbdoc")
+      .def("GetSideData", &PyDecoder::GetFrameSideData,
+           py::arg("frames_back") = 0U,
+           R"pbdoc(
+        Get side data of recent decoded frame.
+
+        Returned objects share memory with decoder side data and support
+        buffer protocol, so numpy.asarray() and bytes() work on them.
+
+       :param frames_back: 0 for last decoded frame, 1 for previous one, etc.
+       :type frames_back: int
+       :return: Side data entries of selected types, in order of appearance
+       :rtype: list[SideData]
+       :raises IndexError: If frame is out of side data history
+    )pbdoc")
+      .def("Stats", &PyDecoder::GetStats,
+           py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(
+        Get decoder statistics since decoder creation.
+
+        Counters are atomic, so they may be taken from another thread while
+        decoder is busy. Compare read_ns to decode_ns to spot I/O bound
+        inputs, max_queue_size to queue_capacity to size pkt_queue_size.
+
+       :return: Decoder statistics
+       :rtype: DecoderStats
+    )pbdoc")
+      .def("GetMotionSummary", &PyDecoder::GetMotionSummary,
+           py::arg("num_bins") = 16U, py::arg("bin_width") = 1.f,
+           py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(
+        Compute motion statistics of last decoded frame.
+
+        Motion vectors lengths are measured in pixels. Use together with
+        SIDE_DATA_ONLY decode mode and "flags2": "+export_mvs" option for
+        cheap compressed domain motion analytics.
+
+       :param num_bins: Number of histogram bins
+       :type num_bins: int
+       :param bin_width: Histogram bin width in pixels
+       :type bin_width: float
+       :return: Motion statistics
+       :rtype: MotionSummary
+       :raises ValueError: If num_bins is 0 or bin_width isn't positive
+    )pbdoc")
+      .def(
+          "DecodeMotionVectors",
+          [](PyDecoder& self, py::array_t<AVMotionVector>& mvs,
+             py::array_t<int32_t>& counts) {
+            TaskExecDetails details;
+            auto res = self.DecodeMotionVectors(mvs, counts, details);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("mvs").noconvert(), py::arg("counts").noconvert(),
+          R"pbdoc(
+        Decode multiple frames and store their motion vectors into
+        preallocated array.
+
+        This method is for CPU-only decoding (non-accelerated decoder).
+        Pass "flags2": "+export_mvs" option to decoder to get motion vectors.
+        Decodes up to len(counts) frames. Motion vectors of all frames are
+        stored one after another, counts[i] is number of motion vectors of
+        i-th frame. Decoded pixels are discarded.
+
+        If mvs array is too small, motion vectors of last decoded frame are
+        truncated and SRC_DST_SIZE_MISMATCH is returned.
+
+       :param mvs: 1D array of MotionVectorDtype to store motion vectors
+       :type mvs: numpy.ndarray
+       :param counts: 1D int32 array to store motion vectors count per frame
+       :type counts: numpy.ndarray
+       :return: Tuple containing:
+           - num_frames (int): number of decoded frames
+           - info (TaskExecInfo): Detailed execution information
+       :rtype: tuple[int, TaskExecInfo]
     )pbdoc")
       .def_property_readonly("DisplayRotation", &PyDecoder::GetDisplayRotation,
                              py::call_guard<py::gil_scoped_release>(),
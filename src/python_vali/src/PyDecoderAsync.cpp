@@ -0,0 +1,285 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompletionQueue.hpp"
+#include "VALI.hpp"
+
+#include <deque>
+#include <unordered_map>
+
+using namespace VPF;
+namespace py = pybind11;
+
+/* Async decode works in two halves:
+ *
+ * Worker half runs decode calls on pool threads. Calls of one decoder are
+ * serialized by its strand, calls of different decoders run in parallel.
+ * Finished call id is pushed to completion queue of event loop which made
+ * the call.
+ *
+ * Loop half lives on event loop thread and holds GIL. It polls completion
+ * queue descriptor with loop.add_reader() and resolves futures. Python
+ * objects never leave this half, so workers don't need GIL.
+ */
+
+namespace VPF {
+struct AsyncDecodeJob {
+  enum State { QUEUED, RUNNING, CANCEL_REQUESTED, DONE, CANCELLED };
+
+  uint64_t id = 0U;
+  std::function<bool(TaskExecDetails&, PacketData&)> func;
+  std::shared_ptr<CompletionQueue> queue;
+
+  // Guarded by strand mutex.
+  State state = QUEUED;
+
+  // Written by worker before id is pushed to queue.
+  bool res = false;
+  TaskExecDetails details;
+  PacketData pkt_data = {};
+  std::string error;
+};
+
+struct AsyncDecodeStrand {
+  DecodeFrame* m_decoder = nullptr;
+
+  std::mutex m_mutex;
+  std::deque<std::shared_ptr<AsyncDecodeJob>> m_jobs;
+  bool m_running = false;
+
+  explicit AsyncDecodeStrand(DecodeFrame* decoder) : m_decoder(decoder) {}
+
+  static ThreadPool& Pool() {
+    static auto pool = new ThreadPool(); // Never destroyed
+    return *pool;
+  }
+
+  void Submit(std::shared_ptr<AsyncDecodeJob> job,
+              std::shared_ptr<AsyncDecodeStrand> self) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jobs.push_back(job);
+    if (!m_running) {
+      m_running = true;
+      Pool().Submit([self](size_t worker) { self->Drain(); });
+    }
+  }
+
+  /* Queued job is skipped. Running job is stopped by decoder cancel which
+   * is reset before next job starts.
+   */
+  void Cancel(AsyncDecodeJob& job) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (AsyncDecodeJob::QUEUED == job.state) {
+      job.state = AsyncDecodeJob::CANCELLED;
+    } else if (AsyncDecodeJob::RUNNING == job.state) {
+      job.state = AsyncDecodeJob::CANCEL_REQUESTED;
+      m_decoder->SetCancel(true);
+    }
+  }
+
+  void Drain() {
+    while (true) {
+      std::shared_ptr<AsyncDecodeJob> job;
+      auto skip = false;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_jobs.empty()) {
+          m_running = false;
+          return;
+        }
+
+        job = m_jobs.front();
+        m_jobs.pop_front();
+        skip = AsyncDecodeJob::CANCELLED == job->state;
+        if (!skip) {
+          job->state = AsyncDecodeJob::RUNNING;
+        }
+      }
+
+      if (!skip) {
+        try {
+          job->res = job->func(job->details, job->pkt_data);
+        } catch (std::exception& e) {
+          job->error = e.what();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (AsyncDecodeJob::CANCEL_REQUESTED == job->state) {
+          m_decoder->SetCancel(false);
+        }
+        job->state = AsyncDecodeJob::DONE;
+      }
+
+      // Decoder may be gone once loop sees this id.
+      job->queue->Push(job->id);
+    }
+  }
+};
+} // namespace VPF
+
+namespace {
+struct AsyncRequest {
+  std::shared_ptr<AsyncDecodeJob> job;
+  py::object future;
+  py::object keep_alive;
+  PacketData* pkt_data = nullptr;
+};
+
+struct AsyncLoop {
+  py::object loop;
+  std::shared_ptr<CompletionQueue> queue;
+  std::unordered_map<uint64_t, AsyncRequest> requests;
+};
+
+/* Loops with calls in flight, keyed by loop object which is kept alive by
+ * its entry; Guarded by GIL;
+ */
+std::unordered_map<PyObject*, AsyncLoop>& Loops() {
+  static auto loops =
+      new std::unordered_map<PyObject*, AsyncLoop>(); // Never destroyed
+  return *loops;
+}
+
+void OnReadable(PyObject* key) {
+  auto it = Loops().find(key);
+  if (Loops().end() == it) {
+    return;
+  }
+
+  auto& ctx = it->second;
+  std::vector<uint64_t> ids;
+  ctx.queue->Pop(ids);
+
+  for (auto id : ids) {
+    auto req_it = ctx.requests.find(id);
+    if (ctx.requests.end() == req_it) {
+      continue;
+    }
+
+    auto req = std::move(req_it->second);
+    ctx.requests.erase(req_it);
+
+    // Cancelled futures are done already.
+    if (req.future.attr("done")().cast<bool>()) {
+      continue;
+    }
+
+    auto& job = *req.job;
+    if (!job.error.empty()) {
+      req.future.attr("set_exception")(
+          py::handle(PyExc_RuntimeError)(job.error));
+      continue;
+    }
+
+    if (req.pkt_data) {
+      *req.pkt_data = job.pkt_data;
+    }
+    req.future.attr("set_result")(py::make_tuple(job.res, job.details.m_info));
+  }
+
+  // Loop isn't polled when idle, so closed loops aren't held.
+  if (ctx.requests.empty()) {
+    ctx.loop.attr("remove_reader")(ctx.queue->GetFd());
+    Loops().erase(it);
+  }
+}
+
+/* Returns Python object which wraps given C++ object, None for nullptr;
+ */
+template <typename T> py::object KeepAlive(T* ptr) {
+  return ptr ? py::cast(ptr, py::return_value_policy::reference) : py::none();
+}
+} // namespace
+
+py::object
+PyDecoder::SubmitAsync(std::function<bool(TaskExecDetails&, PacketData&)> func,
+                       py::object keep_alive, PacketData* pkt_data) {
+  static uint64_t next_id = 0U;
+
+  auto loop = py::module_::import("asyncio").attr("get_running_loop")();
+  auto it = Loops().find(loop.ptr());
+  if (Loops().end() == it) {
+    AsyncLoop ctx;
+    ctx.loop = loop;
+    ctx.queue = std::make_shared<CompletionQueue>();
+
+    auto key = loop.ptr();
+    loop.attr("add_reader")(ctx.queue->GetFd(),
+                            py::cpp_function([key]() { OnReadable(key); }));
+    it = Loops().emplace(key, std::move(ctx)).first;
+  }
+
+  if (!m_async) {
+    m_async = std::make_shared<AsyncDecodeStrand>(upDecoder.get());
+  }
+
+  auto job = std::make_shared<AsyncDecodeJob>();
+  job->id = next_id++;
+  job->func = std::move(func);
+  job->queue = it->second.queue;
+
+  auto future = loop.attr("create_future")();
+  auto strand = m_async;
+  future.attr("add_done_callback")(
+      py::cpp_function([strand, job](py::object done) {
+        if (done.attr("cancelled")().cast<bool>()) {
+          strand->Cancel(*job);
+        }
+      }));
+
+  it->second.requests.emplace(job->id,
+                              AsyncRequest{job, future, keep_alive, pkt_data});
+  strand->Submit(job, strand);
+  return future;
+}
+
+py::object
+PyDecoder::DecodeSingleFrameAsync(py::array& frame, PacketData* pkt_data,
+                                  std::optional<SeekContext> seek_ctx) {
+  auto const frame_size = upDecoder->GetHostFrameSize();
+  if (!IsAccelerated() && frame_size != frame.nbytes() &&
+      DecodeMode::SIDE_DATA_ONLY != GetMode()) {
+    frame.resize({frame_size}, false);
+  }
+
+  auto size = frame.nbytes();
+  auto data = frame.mutable_data();
+  auto func = [this, size, data, seek_ctx](TaskExecDetails& details,
+                                           PacketData& pkt_data) {
+    if (IsAccelerated()) {
+      details.m_info = TaskExecInfo::FAIL;
+      return false;
+    }
+
+    Buffer dst(size, data, false);
+    return DecodeImpl(details, pkt_data, dst, seek_ctx);
+  };
+
+  auto keep_alive = py::make_tuple(KeepAlive(this), frame, KeepAlive(pkt_data));
+  return SubmitAsync(func, keep_alive, pkt_data);
+}
+
+py::object
+PyDecoder::DecodeSingleFrameAsync(HostBuffer& frame, PacketData* pkt_data,
+                                  std::optional<SeekContext> seek_ctx) {
+  auto p_frame = &frame;
+  auto func = [this, p_frame, seek_ctx](TaskExecDetails& details,
+                                        PacketData& pkt_data) {
+    return DecodeHostFrameImpl(*p_frame, details, pkt_data, seek_ctx);
+  };
+
+  auto keep_alive =
+      py::make_tuple(KeepAlive(this), KeepAlive(p_frame), KeepAlive(pkt_data));
+  return SubmitAsync(func, keep_alive, pkt_data);
+}
@@ -15,6 +15,8 @@
 #include "Utils.hpp"
 #include "VALI.hpp"
 
+#include <algorithm>
+
 using namespace VPF;
 namespace py = pybind11;
 
@@ -23,8 +25,7 @@ PyFrameConverter::PyFrameConverter(uint32_t width, uint32_t height,
                                    Pixel_Format outFormat)
     : m_width(width), m_height(height), m_src_fmt(inFormat),
       m_dst_fmt(outFormat) {
-  m_up_cvt.reset(ConvertFrame::Make(width, height, inFormat, outFormat));
-  m_up_ctx_buf.reset(Buffer::MakeOwnMem(sizeof(ColorspaceConversionContext)));
+  m_up_cvt.reset(new TypedConvertFrame(width, height, inFormat, outFormat));
 }
 
 bool PyFrameConverter::Run(py::array& src, py::array& dst,
@@ -43,27 +44,136 @@ bool PyFrameConverter::Run(py::array& src, py::array& dst,
     dst.resize({dst_buf_size}, false);
   }
 
-  auto src_buf = std::shared_ptr<Buffer>(
-      Buffer::Make(src.nbytes(), (void*)src.mutable_data()));
+  Buffer src_buf(src.nbytes(), src.mutable_data(), false);
+  Buffer dst_buf(dst.nbytes(), dst.mutable_data(), false);
 
-  auto dst_buf = std::shared_ptr<Buffer>(
-      Buffer::Make(dst.nbytes(), (void*)dst.mutable_data()));
+  py::gil_scoped_release gil_release{};
+  return RunImpl(src_buf, dst_buf, context, details);
+}
 
+bool PyFrameConverter::Run(HostBuffer& src, HostBuffer& dst,
+                           std::shared_ptr<ColorspaceConversionContext> context,
+                           TaskExecDetails& details) {
   py::gil_scoped_release gil_release{};
+  return RunImpl(src, dst, context, details);
+}
 
-  m_up_cvt->ClearInputs();
-  m_up_cvt->SetInput(src_buf.get(), 0U);
-  m_up_cvt->SetInput(dst_buf.get(), 1U);
+bool PyFrameConverter::RunImpl(
+    HostBuffer& src, HostBuffer& dst,
+    std::shared_ptr<ColorspaceConversionContext> context,
+    TaskExecDetails& details) {
+  if (src.GetFormat() != m_src_fmt || src.GetWidth() != m_width ||
+      src.GetHeight() != m_height) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return false;
+  }
 
-  if (context) {
-    m_up_ctx_buf->CopyFrom(sizeof(ColorspaceConversionContext), context.get());
-    m_up_cvt->SetInput((Token*)m_up_ctx_buf.get(), 2U);
+  dst.Reset(m_dst_fmt, m_width, m_height);
+  return RunImpl(src.GetBuffer(), dst.GetBuffer(), context, details);
+}
+
+bool PyFrameConverter::RunImpl(
+    Buffer& src, Buffer& dst,
+    std::shared_ptr<ColorspaceConversionContext> context,
+    TaskExecDetails& details) {
+  if (!context) {
+    details = TaskExecDetails(TaskExecStatus::TASK_EXEC_FAIL,
+                              TaskExecInfo::INVALID_INPUT, "empty cc_ctx");
+    return false;
   }
 
-  details = m_up_cvt->Run();
+  details = m_up_cvt->Execute(src, dst, *context.get());
   return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
 }
 
+std::vector<TaskExecInfo> PyFrameConverter::RunBatchImpl(
+    const std::vector<std::pair<void*, void*>>& frames, size_t src_size,
+    size_t dst_size, std::shared_ptr<ColorspaceConversionContext> context) {
+  auto& pool = ThreadPool::Shared();
+  while (m_workers.size() < pool.NumThreads()) {
+    m_workers.emplace_back(
+        new TypedConvertFrame(m_width, m_height, m_src_fmt, m_dst_fmt));
+  }
+
+  std::vector<TaskExecInfo> infos(frames.size(), TaskExecInfo::INVALID_INPUT);
+  if (!context) {
+    return infos;
+  }
+
+  py::gil_scoped_release gil_release{};
+  pool.ParallelFor(frames.size(), [&](size_t idx, size_t worker) {
+    auto const& frame = frames[idx];
+    if (!frame.first || !frame.second) {
+      return;
+    }
+
+    Buffer src_buf(src_size, frame.first, false);
+    Buffer dst_buf(dst_size, frame.second, false);
+
+    infos[idx] =
+        m_workers[worker]->Execute(src_buf, dst_buf, *context.get()).m_info;
+  });
+
+  return infos;
+}
+
+std::vector<TaskExecInfo>
+PyFrameConverter::RunBatch(std::vector<py::array>& srcs,
+                           std::vector<py::array>& dsts,
+                           std::shared_ptr<ColorspaceConversionContext> context) {
+  if (srcs.size() != dsts.size()) {
+    throw std::invalid_argument("Number of src and dst frames doesn't match");
+  }
+
+  auto const src_buf_size =
+      getBufferSize(m_width, m_height, toFfmpegPixelFormat(m_src_fmt));
+  auto const dst_buf_size =
+      getBufferSize(m_width, m_height, toFfmpegPixelFormat(m_dst_fmt));
+
+  // Frames with wrong src size are skipped and reported as invalid input.
+  std::vector<std::pair<void*, void*>> frames(srcs.size(), {nullptr, nullptr});
+  for (size_t i = 0U; i < srcs.size(); i++) {
+    if (srcs[i].nbytes() != src_buf_size) {
+      continue;
+    }
+
+    if (dsts[i].nbytes() != dst_buf_size) {
+      dsts[i].resize({dst_buf_size}, false);
+    }
+
+    frames[i] = {srcs[i].mutable_data(), dsts[i].mutable_data()};
+  }
+
+  return RunBatchImpl(frames, src_buf_size, dst_buf_size, context);
+}
+
+std::vector<TaskExecInfo>
+PyFrameConverter::RunBatch(py::array& src, py::array& dst,
+                           std::shared_ptr<ColorspaceConversionContext> context) {
+  auto const src_buf_size =
+      getBufferSize(m_width, m_height, toFfmpegPixelFormat(m_src_fmt));
+  auto const dst_buf_size =
+      getBufferSize(m_width, m_height, toFfmpegPixelFormat(m_dst_fmt));
+
+  if (!src.nbytes() || src.nbytes() % src_buf_size) {
+    throw std::invalid_argument(
+        "Input tensor size isn't multiple of frame size");
+  }
+
+  auto const num_frames = src.nbytes() / src_buf_size;
+  if (dst.nbytes() != dst_buf_size * num_frames) {
+    dst.resize({dst_buf_size * num_frames}, false);
+  }
+
+  std::vector<std::pair<void*, void*>> frames(num_frames);
+  for (size_t i = 0U; i < num_frames; i++) {
+    frames[i] = {(uint8_t*)src.mutable_data() + i * src_buf_size,
+                 (uint8_t*)dst.mutable_data() + i * dst_buf_size};
+  }
+
+  return RunBatchImpl(frames, src_buf_size, dst_buf_size, context);
+}
+
 void Init_PyFrameConverter(py::module& m) {
   py::class_<PyFrameConverter>(
       m, "PyFrameConverter",
@@ -126,5 +236,96 @@ void Init_PyFrameConverter(py::module& m) {
          :rtype: tuple[bool, TaskExecInfo]
          :raises RuntimeError: If the conversion fails
          :raises ValueError: If the input array has incorrect dimensions
+     )pbdoc")
+      .def(
+          "Run",
+          [](PyFrameConverter& self, HostBuffer& src, HostBuffer& dst,
+             std::shared_ptr<ColorspaceConversionContext> cc_ctx) {
+            TaskExecDetails details;
+            return std::make_tuple(self.Run(src, dst, cc_ctx, details),
+                                   details.m_info);
+          },
+          py::arg("src"), py::arg("dst"), py::arg("cc_ctx"),
+          R"pbdoc(
+         Convert a frame stored in host buffer.
+
+         Input buffer must have the configured resolution and source format.
+         Output buffer is reallocated if its format or size doesn't match.
+
+         :param src: Input host buffer
+         :type src: HostBuffer
+         :param dst: Output host buffer
+         :type dst: HostBuffer
+         :param cc_ctx: Colorspace conversion context specifying color space and range
+         :type cc_ctx: ColorspaceConversionContext
+         :return: Tuple containing:
+             - success (bool): True if conversion was successful, False otherwise
+             - info (TaskExecInfo): Detailed information about the conversion operation
+         :rtype: tuple[bool, TaskExecInfo]
+     )pbdoc")
+      .def(
+          "RunBatch",
+          [](PyFrameConverter& self, py::array& src, py::array& dst,
+             std::shared_ptr<ColorspaceConversionContext> cc_ctx) {
+            auto infos = self.RunBatch(src, dst, cc_ctx);
+            auto const success =
+                std::all_of(infos.begin(), infos.end(), [](auto info) {
+                  return TaskExecInfo::SUCCESS == info;
+                });
+            return std::make_tuple(success, infos);
+          },
+          py::arg("src"), py::arg("dst"), py::arg("cc_ctx"),
+          R"pbdoc(
+         Convert batch of frames stored in single array.
+
+         Input array holds frames one after another, e.g. it may have
+         (N, ...) shape. Frames are converted in parallel on worker threads,
+         GIL is released once for the whole batch. The output array will be
+         automatically resized if needed to accommodate all converted frames.
+
+         :param src: Input numpy array containing frames to convert
+         :type src: numpy.ndarray
+         :param dst: Output numpy array that will receive converted frames
+         :type dst: numpy.ndarray
+         :param cc_ctx: Colorspace conversion context specifying color space and range
+         :type cc_ctx: ColorspaceConversionContext
+         :return: Tuple containing:
+             - success (bool): True if all frames were converted
+             - info (list[TaskExecInfo]): Status of every frame
+         :rtype: tuple[bool, list[TaskExecInfo]]
+         :raises ValueError: If input array size isn't multiple of frame size
+     )pbdoc")
+      .def(
+          "RunBatch",
+          [](PyFrameConverter& self, std::vector<py::array>& srcs,
+             std::vector<py::array>& dsts,
+             std::shared_ptr<ColorspaceConversionContext> cc_ctx) {
+            auto infos = self.RunBatch(srcs, dsts, cc_ctx);
+            auto const success =
+                std::all_of(infos.begin(), infos.end(), [](auto info) {
+                  return TaskExecInfo::SUCCESS == info;
+                });
+            return std::make_tuple(success, infos);
+          },
+          py::arg("srcs"), py::arg("dsts"), py::arg("cc_ctx"),
+          R"pbdoc(
+         Convert list of frames.
+
+         Frames are converted in parallel on worker threads, GIL is released
+         once for the whole batch. Output arrays will be automatically resized
+         if needed. Frames of wrong size are skipped and reported as
+         INVALID_INPUT.
+
+         :param srcs: Input numpy arrays containing frames to convert
+         :type srcs: list[numpy.ndarray]
+         :param dsts: Output numpy arrays that will receive converted frames
+         :type dsts: list[numpy.ndarray]
+         :param cc_ctx: Colorspace conversion context specifying color space and range
+         :type cc_ctx: ColorspaceConversionContext
+         :return: Tuple containing:
+             - success (bool): True if all frames were converted
+             - info (list[TaskExecInfo]): Status of every frame
+         :rtype: tuple[bool, list[TaskExecInfo]]
+         :raises ValueError: If number of src and dst frames doesn't match
      )pbdoc");
 }
\ No newline at end of file
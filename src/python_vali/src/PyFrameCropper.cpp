@@ -0,0 +1,227 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Utils.hpp"
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+PyFrameCropper::PyFrameCropper(uint32_t width, uint32_t height,
+                               Pixel_Format src_format,
+                               Pixel_Format dst_format)
+    : m_width(width), m_height(height), m_src_fmt(src_format) {
+  m_cropper =
+      std::make_unique<CropFrame>(width, height, src_format, dst_format);
+}
+
+bool PyFrameCropper::CheckSrc(py::array& src, TaskExecDetails& details) const {
+  auto const src_buf_size =
+      getBufferSize(m_width, m_height, toFfmpegPixelFormat(m_src_fmt));
+  if (src.nbytes() != src_buf_size) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return false;
+  }
+  return true;
+}
+
+bool PyFrameCropper::Run(py::array& src, const std::vector<CropRect>& rects,
+                         std::vector<py::array>& dsts, uint32_t dst_width,
+                         uint32_t dst_height,
+                         std::optional<ColorspaceConversionContext> context,
+                         TaskExecDetails& details) {
+  if (!CheckSrc(src, details)) {
+    return false;
+  }
+
+  if (rects.size() != dsts.size()) {
+    details.m_info = TaskExecInfo::SRC_DST_SIZE_MISMATCH;
+    return false;
+  }
+
+  auto const resize = dst_width && dst_height;
+  std::vector<std::unique_ptr<Buffer>> dst_bufs;
+  std::vector<Buffer*> dst_ptrs;
+  for (size_t i = 0U; i < rects.size(); i++) {
+    auto const aligned = m_cropper->AlignRect(rects[i]);
+    auto const dst_buf_size =
+        resize ? m_cropper->GetDstSize(dst_width, dst_height)
+               : m_cropper->GetDstSize(aligned.width, aligned.height);
+
+    auto& dst = dsts[i];
+    if (dst.nbytes() != dst_buf_size) {
+      dst.resize({dst_buf_size}, false);
+    }
+
+    dst_bufs.emplace_back(
+        Buffer::Make(dst.nbytes(), (void*)dst.mutable_data()));
+    dst_ptrs.push_back(dst_bufs.back().get());
+  }
+
+  Buffer src_buf(src.nbytes(), (void*)src.mutable_data(), false);
+
+  py::gil_scoped_release gil_release{};
+  details = m_cropper->Run(src_buf, rects, dst_ptrs, dst_width, dst_height,
+                           context);
+  return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
+}
+
+bool PyFrameCropper::RunBatch(
+    py::array& src, const std::vector<CropRect>& rects, py::array& dst,
+    uint32_t dst_width, uint32_t dst_height,
+    std::optional<ColorspaceConversionContext> context,
+    TaskExecDetails& details) {
+  if (!CheckSrc(src, details)) {
+    return false;
+  }
+
+  auto const dst_buf_size =
+      m_cropper->GetDstSize(dst_width, dst_height) * rects.size();
+  if (dst.nbytes() != dst_buf_size) {
+    dst.resize({dst_buf_size}, false);
+  }
+
+  Buffer src_buf(src.nbytes(), (void*)src.mutable_data(), false);
+  Buffer dst_buf(dst.nbytes(), (void*)dst.mutable_data(), false);
+
+  py::gil_scoped_release gil_release{};
+  details = m_cropper->RunBatch(src_buf, rects, dst_buf, dst_width,
+                                dst_height, context);
+  return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
+}
+
+void Init_PyFrameCropper(py::module& m) {
+  py::class_<CropRect, std::shared_ptr<CropRect>>(
+      m, "CropRect", "Region of interest within frame, in pixels.")
+      .def(py::init<>())
+      .def(py::init([](uint32_t x, uint32_t y, uint32_t width,
+                       uint32_t height) {
+             auto rect = std::make_shared<CropRect>();
+             rect->x = x;
+             rect->y = y;
+             rect->width = width;
+             rect->height = height;
+             return rect;
+           }),
+           py::arg("x"), py::arg("y"), py::arg("width"), py::arg("height"))
+      .def_readwrite("x", &CropRect::x)
+      .def_readwrite("y", &CropRect::y)
+      .def_readwrite("width", &CropRect::width)
+      .def_readwrite("height", &CropRect::height)
+      .def("__repr__", [](const CropRect& self) {
+        std::stringstream ss;
+        ss << "x: " << self.x << " y: " << self.y << " width: " << self.width
+           << " height: " << self.height;
+        return ss.str();
+      });
+
+  py::class_<PyFrameCropper>(
+      m, "PyFrameCropper",
+      "libswscale based converter of frame regions of interest.")
+      .def(py::init<uint32_t, uint32_t, Pixel_Format, Pixel_Format>(),
+           py::arg("width"), py::arg("height"), py::arg("src_format"),
+           py::arg("dst_format"),
+           R"pbdoc(
+         Create a new frame cropper instance.
+
+         Only source rows and columns covered by crops are read. Crop origin
+         is snapped to chroma subsampling grid of source format, e.g. to even
+         coordinates for NV12 and YUV420.
+
+         :param width: Width of source frames in pixels
+         :type width: int
+         :param height: Height of source frames in pixels
+         :type height: int
+         :param src_format: Pixel format of source frames
+         :type src_format: PixelFormat
+         :param dst_format: Pixel format of crops
+         :type dst_format: PixelFormat
+         :raises ValueError: If pixel formats are not supported
+     )pbdoc")
+      .def(
+          "Run",
+          [](PyFrameCropper& self, py::array& src,
+             const std::vector<CropRect>& rects, std::vector<py::array>& dsts,
+             uint32_t dst_width, uint32_t dst_height,
+             std::optional<ColorspaceConversionContext> cc_ctx) {
+            TaskExecDetails details;
+            return std::make_tuple(self.Run(src, rects, dsts, dst_width,
+                                            dst_height, cc_ctx, details),
+                                   details.m_info);
+          },
+          py::arg("src"), py::arg("rects"), py::arg("dsts"),
+          py::arg("dst_width") = 0U, py::arg("dst_height") = 0U,
+          py::arg("cc_ctx") = std::nullopt,
+          R"pbdoc(
+         Crop and convert regions of interest, each into its own array.
+
+         Output arrays are resized if their size doesn't match crop size.
+
+         :param src: Input numpy array containing the frame
+         :type src: numpy.ndarray
+         :param rects: Regions of interest
+         :type rects: list[CropRect]
+         :param dsts: Output numpy arrays, one per region
+         :type dsts: list[numpy.ndarray]
+         :param dst_width: Crops are resized to this width if both dst_width
+             and dst_height are non-zero
+         :type dst_width: int
+         :param dst_height: Crops are resized to this height if both dst_width
+             and dst_height are non-zero
+         :type dst_height: int
+         :param cc_ctx: Colorspace conversion context of input frame
+         :type cc_ctx: ColorspaceConversionContext
+         :return: Tuple containing:
+             - success (bool): True if all crops were processed
+             - info (TaskExecInfo): Detailed information about the operation
+         :rtype: tuple[bool, TaskExecInfo]
+     )pbdoc")
+      .def(
+          "RunBatch",
+          [](PyFrameCropper& self, py::array& src,
+             const std::vector<CropRect>& rects, py::array& dst,
+             uint32_t dst_width, uint32_t dst_height,
+             std::optional<ColorspaceConversionContext> cc_ctx) {
+            TaskExecDetails details;
+            return std::make_tuple(self.RunBatch(src, rects, dst, dst_width,
+                                                 dst_height, cc_ctx, details),
+                                   details.m_info);
+          },
+          py::arg("src"), py::arg("rects"), py::arg("dst"),
+          py::arg("dst_width"), py::arg("dst_height"),
+          py::arg("cc_ctx") = std::nullopt,
+          R"pbdoc(
+         Crop, convert and resize regions of interest into single batch.
+
+         Crops are stored one after another in output array which is resized
+         if its size doesn't match batch size.
+
+         :param src: Input numpy array containing the frame
+         :type src: numpy.ndarray
+         :param rects: Regions of interest
+         :type rects: list[CropRect]
+         :param dst: Output numpy array
+         :type dst: numpy.ndarray
+         :param dst_width: Width of every crop in batch
+         :type dst_width: int
+         :param dst_height: Height of every crop in batch
+         :type dst_height: int
+         :param cc_ctx: Colorspace conversion context of input frame
+         :type cc_ctx: ColorspaceConversionContext
+         :return: Tuple containing:
+             - success (bool): True if all crops were processed
+             - info (TaskExecInfo): Detailed information about the operation
+         :rtype: tuple[bool, TaskExecInfo]
+     )pbdoc");
+}
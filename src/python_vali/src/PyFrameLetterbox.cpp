@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Utils.hpp"
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+PyFrameLetterbox::PyFrameLetterbox(uint32_t src_width, uint32_t src_height,
+                                   Pixel_Format src_format, uint32_t dst_width,
+                                   uint32_t dst_height, Pixel_Format dst_format)
+    : m_src_width(src_width), m_src_height(src_height),
+      m_src_fmt(src_format) {
+  m_letterbox = std::make_unique<LetterboxFrame>(
+      src_width, src_height, src_format, dst_width, dst_height, dst_format);
+}
+
+bool PyFrameLetterbox::Run(py::array& src, py::array& dst,
+                           const LetterboxOptions& opts,
+                           std::optional<ColorspaceConversionContext> context,
+                           TaskExecDetails& details) {
+  auto const src_buf_size = getBufferSize(m_src_width, m_src_height,
+                                          toFfmpegPixelFormat(m_src_fmt));
+  if (src.nbytes() != src_buf_size) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return false;
+  }
+
+  auto const dst_buf_size = m_letterbox->GetDstSize();
+  if (dst.nbytes() != dst_buf_size) {
+    dst.resize({dst_buf_size / dst.itemsize()}, false);
+  }
+
+  Buffer src_buf(src.nbytes(), (void*)src.mutable_data(), false);
+  Buffer dst_buf(dst.nbytes(), (void*)dst.mutable_data(), false);
+
+  py::gil_scoped_release gil_release{};
+  details = m_letterbox->Run(src_buf, dst_buf, opts, context);
+  return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
+}
+
+void Init_PyFrameLetterbox(py::module& m) {
+  py::class_<LetterboxParams, std::shared_ptr<LetterboxParams>>(
+      m, "LetterboxParams",
+      "Placement of scaled picture within letterboxed frame.")
+      .def(py::init<>())
+      .def_readonly("scale", &LetterboxParams::scale,
+                    "Scale factor applied to both source dimensions")
+      .def_readonly("offset_x", &LetterboxParams::offset_x,
+                    "Horizontal offset of picture in destination frame")
+      .def_readonly("offset_y", &LetterboxParams::offset_y,
+                    "Vertical offset of picture in destination frame")
+      .def_readonly("width", &LetterboxParams::width,
+                    "Width of scaled picture")
+      .def_readonly("height", &LetterboxParams::height,
+                    "Height of scaled picture")
+      .def("__repr__", [](const LetterboxParams& self) {
+        std::stringstream ss;
+        ss << "scale:    " << self.scale << "\n";
+        ss << "offset_x: " << self.offset_x << "\n";
+        ss << "offset_y: " << self.offset_y << "\n";
+        ss << "width:    " << self.width << "\n";
+        ss << "height:   " << self.height << "\n";
+        return ss.str();
+      });
+
+  py::class_<LetterboxOptions, std::shared_ptr<LetterboxOptions>>(
+      m, "LetterboxOptions", "Letterbox padding and normalization settings.")
+      .def(py::init<>())
+      .def_readwrite("pad_color", &LetterboxOptions::pad_color,
+                     "Padding color in RGB order")
+      .def_readwrite("normalize", &LetterboxOptions::normalize,
+                     "Apply (x / 255 - mean) / std per channel. Float "
+                     "outputs only.")
+      .def_readwrite("mean", &LetterboxOptions::mean,
+                     "Per channel mean in RGB order")
+      .def_readwrite("std", &LetterboxOptions::stddev,
+                     "Per channel standard deviation in RGB order");
+
+  py::class_<PyFrameLetterbox>(
+      m, "PyFrameLetterbox",
+      "libswscale based letterbox for model input preprocessing.")
+      .def(py::init<uint32_t, uint32_t, Pixel_Format, uint32_t, uint32_t,
+                    Pixel_Format>(),
+           py::arg("src_width"), py::arg("src_height"), py::arg("src_format"),
+           py::arg("dst_width"), py::arg("dst_height"), py::arg("dst_format"),
+           R"pbdoc(
+         Create a new letterbox instance.
+
+         Picture is scaled with preserved aspect ratio to fit into destination
+         frame and centered. Remaining area is filled with pad color.
+
+         :param src_width: Width of input frames in pixels
+         :type src_width: int
+         :param src_height: Height of input frames in pixels
+         :type src_height: int
+         :param src_format: Pixel format of input frames
+         :type src_format: PixelFormat
+         :param dst_width: Width of output frames in pixels
+         :type dst_width: int
+         :param dst_height: Height of output frames in pixels
+         :type dst_height: int
+         :param dst_format: Pixel format of output frames. One of RGB, BGR,
+             RGB_PLANAR, RGB_32F, RGB_32F_PLANAR
+         :type dst_format: PixelFormat
+         :raises ValueError: If formats or sizes are not supported
+     )pbdoc")
+      .def_property_readonly("Params", &PyFrameLetterbox::GetParams,
+                             R"pbdoc(
+         Get picture placement within destination frame.
+
+         :return: Scale factor and offsets of scaled picture
+         :rtype: LetterboxParams
+     )pbdoc")
+      .def(
+          "Run",
+          [](PyFrameLetterbox& self, py::array& src, py::array& dst,
+             const LetterboxOptions& opts,
+             std::optional<ColorspaceConversionContext> cc_ctx) {
+            TaskExecDetails details;
+            auto res = self.Run(src, dst, opts, cc_ctx, details);
+            return std::make_tuple(res, details.m_info, self.GetParams());
+          },
+          py::arg("src"), py::arg("dst"),
+          py::arg("opts") = LetterboxOptions(),
+          py::arg("cc_ctx") = std::nullopt,
+          R"pbdoc(
+         Convert, scale and pad a frame.
+
+         Output array will be resized if its size doesn't match destination
+         frame size. Use numpy.float32 array for float output formats.
+
+         :param src: Input numpy array containing the frame
+         :type src: numpy.ndarray
+         :param dst: Output numpy array that will receive letterboxed frame
+         :type dst: numpy.ndarray
+         :param opts: Padding and normalization settings
+         :type opts: LetterboxOptions
+         :param cc_ctx: Colorspace conversion context of input frame
+         :type cc_ctx: ColorspaceConversionContext
+         :return: Tuple containing:
+             - success (bool): True if operation was successful
+             - info (TaskExecInfo): Detailed information about the operation
+             - params (LetterboxParams): Scale factor and offsets of picture
+         :rtype: tuple[bool, TaskExecInfo, LetterboxParams]
+     )pbdoc");
+}
@@ -32,11 +32,10 @@ PyFrameUploader::PyFrameUploader(int gpu_id, CUstream str) {
 
 bool PyFrameUploader::Run(py::array& src, Surface& dst,
                           TaskExecDetails details) {
-  auto buffer =
-      std::shared_ptr<Buffer>(Buffer::Make(src.nbytes(), src.mutable_data()));
+  Buffer buffer(src.nbytes(), src.mutable_data(), false);
   py::gil_scoped_release gil_release{};
 
-  m_uploader->SetInput(buffer.get(), 0U);
+  m_uploader->SetInput(&buffer, 0U);
   m_uploader->SetInput(&dst, 1U);
   details = m_uploader->Execute();
   return (TASK_EXEC_SUCCESS == details.m_status);
@@ -0,0 +1,299 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostImage.hpp"
+#include "VALI.hpp"
+#include "dlpack.h"
+
+#include <cstring>
+
+using namespace VPF;
+namespace py = pybind11;
+
+struct HostBufferDLPackContext {
+  std::shared_ptr<Buffer> buf;
+  std::vector<int64_t> shape;
+  std::vector<int64_t> strides;
+};
+
+static void HostBuffer_DLManagedTensor_Destroy(DLManagedTensor* self) {
+  if (!self) {
+    return;
+  }
+
+  delete (HostBufferDLPackContext*)self->manager_ctx;
+  delete self;
+}
+
+HostBuffer::HostBuffer(Pixel_Format format, uint32_t width, uint32_t height,
+                       int numa_node) {
+  if (numa_node < Numa::ANY_NODE || numa_node >= Numa::NumNodes()) {
+    throw std::invalid_argument("Invalid NUMA node: " +
+                                std::to_string(numa_node));
+  }
+
+  m_numa_node = numa_node;
+  Reset(format, width, height);
+}
+
+HostBuffer::HostBuffer(std::shared_ptr<Buffer> buf, Pixel_Format format,
+                       uint32_t width, uint32_t height)
+    : m_buf(buf), m_format(format), m_width(width), m_height(height) {
+  UpdateLayout();
+}
+
+void HostBuffer::Reset(Pixel_Format format, uint32_t width, uint32_t height) {
+  if (m_buf && format == m_format && width == m_width && height == m_height) {
+    return;
+  }
+
+  auto const size = HostImage::BufferSize(format, width, height);
+  if (!size) {
+    std::stringstream ss;
+    ss << "Unsupported host frame: " << GetFormatName(format) << " " << width
+       << "x" << height;
+    throw std::invalid_argument(ss.str());
+  }
+
+  m_buf.reset(Buffer::MakeOwnMem(size, m_numa_node));
+  m_format = format;
+  m_width = width;
+  m_height = height;
+  UpdateLayout();
+}
+
+void HostBuffer::UpdateLayout() {
+  auto img = HostImage::Make(*m_buf.get(), m_format, m_width, m_height);
+  if (!img) {
+    throw std::runtime_error("Failed to describe host frame layout");
+  }
+
+  m_elem_size = img->elem_size;
+  auto const size = (int64_t)GetSize();
+  auto const pitch = (int64_t)img->pitch[0];
+  auto const channels = pitch / (img->cols[0] * img->elem_size);
+
+  auto same_planes = true;
+  for (auto i = 1U; i < img->num_planes; i++) {
+    same_planes = same_planes && img->pitch[i] == img->pitch[0] &&
+                  img->rows[i] == img->rows[0];
+  }
+
+  if (1U == img->num_planes) {
+    // Packed formats, e.g. (H, W) for Y and (H, W, 3) for RGB.
+    m_shape = {img->rows[0], img->cols[0]};
+    if (channels > 1) {
+      m_shape.push_back(channels);
+    }
+  } else if (same_planes) {
+    // Full size planes, e.g. (3, H, W) for RGB_PLANAR and YUV444.
+    m_shape = {img->num_planes, img->rows[0], img->cols[0]};
+  } else if (0 == size % pitch) {
+    // Planes stacked as rows of luma width, e.g. (H * 3 / 2, W) for NV12.
+    m_shape = {size / pitch, pitch / img->elem_size};
+  } else {
+    m_shape = {size / img->elem_size};
+  }
+
+  m_strides.assign(m_shape.size(), 1);
+  for (auto i = (int)m_shape.size() - 2; i >= 0; i--) {
+    m_strides[i] = m_strides[i + 1] * m_shape[i + 1];
+  }
+}
+
+DLDataType HostBuffer::GetDataType() const {
+  DLDataType dtype;
+  dtype.code = sizeof(float) == m_elem_size ? kDLFloat : kDLUInt;
+  dtype.bits = m_elem_size * 8U;
+  dtype.lanes = 1U;
+  return dtype;
+}
+
+std::string HostBuffer::GetTypeStr() const {
+  std::stringstream ss;
+  ss << (1U == m_elem_size ? "|" : "<");
+  ss << (sizeof(float) == m_elem_size ? "f" : "u") << m_elem_size;
+  return ss.str();
+}
+
+DLManagedTensor* HostBuffer::ToDLPack() const {
+  auto ctx = new HostBufferDLPackContext{m_buf, m_shape, m_strides};
+
+  auto dlmt = new DLManagedTensor();
+  memset((void*)dlmt, 0, sizeof(*dlmt));
+
+  dlmt->manager_ctx = ctx;
+  dlmt->deleter = HostBuffer_DLManagedTensor_Destroy;
+
+  dlmt->dl_tensor.device.device_type = kDLCPU;
+  dlmt->dl_tensor.device.device_id = 0;
+  dlmt->dl_tensor.data = GetData();
+  dlmt->dl_tensor.ndim = (int32_t)ctx->shape.size();
+  dlmt->dl_tensor.byte_offset = 0U;
+  dlmt->dl_tensor.dtype = GetDataType();
+  dlmt->dl_tensor.shape = ctx->shape.data();
+  dlmt->dl_tensor.strides = ctx->strides.data();
+
+  return dlmt;
+}
+
+void Init_PyHostBuffer(py::module& m) {
+  py::class_<HostBuffer, std::shared_ptr<HostBuffer>>(
+      m, "HostBuffer",
+      "Host memory frame. It supports DLPack specification and numpy array "
+      "interface.")
+      .def(py::init<Pixel_Format, uint32_t, uint32_t, int>(),
+           py::arg("format"), py::arg("width"), py::arg("height"),
+           py::arg("numa_node") = -1,
+           R"pbdoc(
+         Constructor for HostBuffer.
+
+         Allocates host memory for single frame. Memory is taken from host
+         memory pool, so creating new HostBuffer for every frame is cheap.
+
+         Frame layout is the same as numpy arrays filled by PyDecoder and
+         PyFrameConverter have. Shape depends on pixel format:
+             - (H, W) for Y and GRAY12
+             - (H, W, 3) for RGB, BGR and RGB_32F
+             - (3, H, W) for RGB_PLANAR, RGB_32F_PLANAR and YUV444 formats
+             - (H * 3 / 2, W) for NV12, P10, P12 and YUV420 formats
+             - (H * 2, W) for YUV422
+         Formats with odd dimensions are exported as flat arrays.
+
+         :param format: Pixel format
+         :type format: Pixel_Format
+         :param width: Width in pixels
+         :type width: int
+         :param height: Height in pixels
+         :type height: int
+         :param numa_node: NUMA node to place memory on. Default is -1 which
+             means no placement preference. Memory placed on node is page
+             aligned and rounded up to whole pages.
+         :type numa_node: int
+         :raises ValueError: If format isn't supported or NUMA node is invalid
+     )pbdoc")
+      .def_property_readonly("Format", &HostBuffer::GetFormat,
+                             R"pbdoc(
+         Get pixel format.
+
+         :return: Pixel format
+         :rtype: Pixel_Format
+     )pbdoc")
+      .def_property_readonly("Width", &HostBuffer::GetWidth,
+                             R"pbdoc(
+         Get width in pixels.
+
+         :return: Width in pixels
+         :rtype: int
+     )pbdoc")
+      .def_property_readonly("Height", &HostBuffer::GetHeight,
+                             R"pbdoc(
+         Get height in pixels.
+
+         :return: Height in pixels
+         :rtype: int
+     )pbdoc")
+      .def_property_readonly("NumaNode", &HostBuffer::GetNumaNode,
+                             R"pbdoc(
+         Get NUMA node memory is placed on.
+
+         :return: NUMA node, -1 if there's no placement preference
+         :rtype: int
+     )pbdoc")
+      .def_property_readonly("NumBytes", &HostBuffer::GetSize,
+                             R"pbdoc(
+         Get frame size in bytes.
+
+         :return: Frame size in bytes
+         :rtype: int
+     )pbdoc")
+      .def_property_readonly("Shape", &HostBuffer::GetShape,
+                             R"pbdoc(
+         Get shape of exported tensor.
+
+         :return: Shape in elements
+         :rtype: list[int]
+     )pbdoc")
+      .def_property_readonly(
+          "__array_interface__",
+          [](HostBuffer& self) {
+            /* Data is passed as byte array which holds Buffer reference.
+             * Numpy makes it base of created array, so memory stays valid
+             * when HostBuffer is reallocated or destroyed. Raw pointer
+             * would only keep HostBuffer object alive, not its memory.
+             */
+            auto ref = new std::shared_ptr<Buffer>(self.GetSharedBuffer());
+            auto owner = py::capsule(ref, [](void* p) {
+              delete (std::shared_ptr<Buffer>*)p;
+            });
+            auto data = py::array_t<uint8_t>(
+                {(py::ssize_t)self.GetSize()}, (uint8_t*)self.GetData(), owner);
+
+            py::dict dict;
+            dict["version"] = 3;
+            dict["shape"] = py::tuple(py::cast(self.GetShape()));
+            dict["typestr"] = self.GetTypeStr();
+            dict["data"] = data;
+            dict["strides"] = py::none();
+            return dict;
+          },
+          R"pbdoc(
+         Numpy array interface.
+
+         numpy.asarray() creates array which shares memory with HostBuffer.
+         Array keeps memory alive after HostBuffer is reallocated to fit
+         other frame or destroyed.
+
+         :return: Array interface dictionary
+         :rtype: dict
+     )pbdoc")
+      .def(
+          "__dlpack_device__",
+          [](HostBuffer& self) {
+            return std::make_tuple(DLDeviceType::kDLCPU, 0);
+          },
+          R"pbdoc(
+         DLPack: get device information.
+
+         :return: Tuple containing device type and device ID
+         :rtype: tuple[DLDeviceType, int]
+     )pbdoc")
+      .def(
+          "__dlpack__",
+          [](HostBuffer& self, py::object stream) {
+            auto dlmt = self.ToDLPack();
+            return py::capsule(dlmt, "dltensor", dlpack_capsule_deleter);
+          },
+          py::arg("stream") = py::none(),
+          R"pbdoc(
+         DLPack: get capsule.
+
+         Tensor shares memory with HostBuffer. Memory stays valid after
+         HostBuffer is destroyed until consumer releases the tensor.
+
+         :param stream: Ignored, host memory needs no synchronization
+         :type stream: None
+         :return: DLPack capsule
+         :rtype: capsule
+     )pbdoc")
+      .def(
+          "__repr__",
+          [](HostBuffer& self) {
+            std::stringstream ss;
+            ss << "HostBuffer(" << GetFormatName(self.GetFormat()) << ", "
+               << self.GetWidth() << "x" << self.GetHeight() << ", "
+               << self.GetSize() << " bytes)";
+            return ss.str();
+          });
+}
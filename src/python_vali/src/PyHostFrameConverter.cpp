@@ -0,0 +1,123 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+PyHostFrameConverter::PyHostFrameConverter(uint32_t width, uint32_t height,
+                                           Pixel_Format src_format,
+                                           Pixel_Format dst_format)
+    : m_src_fmt(src_format), m_dst_fmt(dst_format) {
+  m_cvt = std::make_unique<ConvertHostFrame>(width, height, src_format,
+                                             dst_format);
+}
+
+bool PyHostFrameConverter::Run(
+    py::array& src, py::array& dst,
+    std::optional<ColorspaceConversionContext> context,
+    TaskExecDetails& details) {
+  if (src.nbytes() != m_cvt->GetSrcSize()) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return false;
+  }
+
+  auto const dst_buf_size = m_cvt->GetDstSize();
+  if (dst.nbytes() != dst_buf_size) {
+    dst.resize({dst_buf_size}, false);
+  }
+
+  Buffer src_buf(src.nbytes(), (void*)src.mutable_data(), false);
+  Buffer dst_buf(dst.nbytes(), (void*)dst.mutable_data(), false);
+
+  py::gil_scoped_release gil_release{};
+  details = m_cvt->Run(src_buf, dst_buf, context);
+  return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
+}
+
+std::list<std::pair<Pixel_Format, Pixel_Format>>
+PyHostFrameConverter::GetConversions() {
+  return ConvertHostFrame::GetSupportedConversions();
+}
+
+void Init_PyHostFrameConverter(py::module& m) {
+  py::class_<PyHostFrameConverter>(
+      m, "PyHostFrameConverter",
+      "CPU converter between different pixel formats. Same conversions and "
+      "results as PySurfaceConverter.")
+      .def(py::init<uint32_t, uint32_t, Pixel_Format, Pixel_Format>(),
+           py::arg("width"), py::arg("height"), py::arg("src_format"),
+           py::arg("dst_format"),
+           R"pbdoc(
+         Create a new host frame converter instance.
+
+         Converter supports same set of conversions as PySurfaceConverter and
+         uses same formulas, so output matches GPU output within rounding
+         error. Use it on hosts without GPU or as a reference in tests.
+
+         :param width: Width of the frames to convert in pixels
+         :type width: int
+         :param height: Height of the frames to convert in pixels
+         :type height: int
+         :param src_format: Pixel format of the input frames
+         :type src_format: Pixel_Format
+         :param dst_format: Pixel format for the output frames
+         :type dst_format: Pixel_Format
+         :raises ValueError: If conversion isn't supported
+     )pbdoc")
+      .def_property_readonly("Format", &PyHostFrameConverter::GetFormat,
+                             R"pbdoc(
+         Get the current pixel format configuration.
+
+         :return: Tuple of (source_format, destination_format)
+         :rtype: tuple[Pixel_Format, Pixel_Format]
+     )pbdoc")
+      .def(
+          "Run",
+          [](PyHostFrameConverter& self, py::array& src, py::array& dst,
+             std::optional<ColorspaceConversionContext> cc_ctx) {
+            TaskExecDetails details;
+            auto res = self.Run(src, dst, cc_ctx, details);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("src"), py::arg("dst"), py::arg("cc_ctx") = std::nullopt,
+          R"pbdoc(
+         Convert a frame between pixel formats.
+
+         The input array must have the correct size for the configured
+         resolution and source format. The output array will be automatically
+         resized if needed to accommodate the converted frame.
+
+         :param src: Input numpy array containing the frame to convert
+         :type src: numpy.ndarray
+         :param dst: Output numpy array that will receive the converted frame
+         :type dst: numpy.ndarray
+         :param cc_ctx: Optional colorspace conversion context that describes the color space
+             and color range to use for conversion. If not provided, same defaults as
+             in PySurfaceConverter are used.
+         :type cc_ctx: ColorspaceConversionContext, optional
+         :return: Tuple containing:
+             - success (bool): True if conversion was successful, False otherwise
+             - info (TaskExecInfo): Detailed information about the conversion operation
+         :rtype: tuple[bool, TaskExecInfo]
+     )pbdoc")
+      .def_static("Conversions", &PyHostFrameConverter::GetConversions,
+                  R"pbdoc(
+         Get list of supported pixel format conversions.
+
+         :return: List of tuples containing supported (input_format, output_format) pairs
+         :rtype: list[tuple[Pixel_Format, Pixel_Format]]
+     )pbdoc");
+}
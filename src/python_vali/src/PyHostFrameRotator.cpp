@@ -0,0 +1,155 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VALI.hpp"
+#include <cmath>
+
+using namespace VPF;
+namespace py = pybind11;
+
+PyHostFrameRotator::PyHostFrameRotator(uint32_t width, uint32_t height,
+                                       Pixel_Format format)
+    : m_width(width), m_height(height), m_dst_width(width),
+      m_dst_height(height), m_format(format) {
+  m_rotator =
+      std::make_unique<RotateHostFrame>(width, height, width, height, format);
+}
+
+std::pair<uint32_t, uint32_t>
+PyHostFrameRotator::DstSize(double angle, double shift_x,
+                            double shift_y) const {
+  auto const is_quarter =
+      (std::fmod(angle, 90.0) == 0.0) && (shift_x == 0.0) && (shift_y == 0.0);
+  auto const is_odd = (std::labs(std::lround(angle) / 90) % 2) == 1;
+
+  if (is_quarter && is_odd) {
+    return std::make_pair(m_height, m_width);
+  }
+  return std::make_pair(m_width, m_height);
+}
+
+bool PyHostFrameRotator::Run(double angle, double shift_x, double shift_y,
+                             py::array& src, py::array& dst,
+                             TaskExecDetails& details) {
+  auto const dst_size = DstSize(angle, shift_x, shift_y);
+  if (dst_size.first != m_dst_width || dst_size.second != m_dst_height) {
+    m_rotator = std::make_unique<RotateHostFrame>(
+        m_width, m_height, dst_size.first, dst_size.second, m_format);
+    m_dst_width = dst_size.first;
+    m_dst_height = dst_size.second;
+  }
+
+  if (src.nbytes() != m_rotator->GetSrcSize()) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return false;
+  }
+
+  auto const dst_buf_size = m_rotator->GetDstSize();
+  if (dst.nbytes() != dst_buf_size) {
+    if (!dst.itemsize() || dst_buf_size % dst.itemsize()) {
+      details.m_info = TaskExecInfo::INVALID_INPUT;
+      return false;
+    }
+    dst.resize({dst_buf_size / dst.itemsize()}, false);
+  }
+
+  Buffer src_buf(src.nbytes(), (void*)src.mutable_data(), false);
+  Buffer dst_buf(dst.nbytes(), (void*)dst.mutable_data(), false);
+
+  py::gil_scoped_release gil_release{};
+  details = m_rotator->Run(angle, shift_x, shift_y, src_buf, dst_buf);
+  return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
+}
+
+std::list<Pixel_Format> PyHostFrameRotator::SupportedFormats() {
+  return RotateHostFrame::SupportedFormats();
+}
+
+void Init_PyHostFrameRotator(py::module& m) {
+  py::class_<PyHostFrameRotator>(m, "PyHostFrameRotator", "CPU Frame rotator")
+      .def(py::init<uint32_t, uint32_t, Pixel_Format>(), py::arg("width"),
+           py::arg("height"), py::arg("format"),
+           R"pbdoc(
+         Constructor for PyHostFrameRotator.
+
+         CPU counterpart of PySurfaceRotator. Rotation by multiple of 90
+         degrees without shift changes image orientation, subsampled chroma
+         of NV12, P10, YUV420 and YUV420_10bit is handled properly.
+         Arbitrary angles use bilinear interpolation.
+
+         :param width: Width of input frames in pixels
+         :type width: int
+         :param height: Height of input frames in pixels
+         :type height: int
+         :param format: Pixel format of input and output frames
+         :type format: Pixel_Format
+         :raises ValueError: If format isn't supported
+     )pbdoc")
+      .def_static("SupportedFormats", &PyHostFrameRotator::SupportedFormats,
+                  R"pbdoc(
+         Get list of supported pixel formats.
+
+         :return: List of supported pixel formats
+         :rtype: list[Pixel_Format]
+     )pbdoc")
+      .def("DstSize", &PyHostFrameRotator::DstSize, py::arg("angle"),
+           py::arg("shift_x") = 0.0, py::arg("shift_y") = 0.0,
+           R"pbdoc(
+         Get size of rotated frame.
+
+         Width and height are swapped for 90 and 270 degrees rotation
+         without shift, otherwise they are same as input ones.
+
+         :param angle: Rotation angle in degrees
+         :type angle: float
+         :param shift_x: Shift along X axis in pixels (default: 0.0)
+         :type shift_x: float
+         :param shift_y: Shift along Y axis in pixels (default: 0.0)
+         :type shift_y: float
+         :return: Tuple containing output width and height
+         :rtype: tuple[int, int]
+     )pbdoc")
+      .def(
+          "Run",
+          [](PyHostFrameRotator& self, py::array& src, py::array& dst,
+             double angle, double shift_x, double shift_y) {
+            TaskExecDetails details;
+            auto res = self.Run(angle, shift_x, shift_y, src, dst, details);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("src"), py::arg("dst"), py::arg("angle"),
+          py::arg("shift_x") = 0.0, py::arg("shift_y") = 0.0,
+          R"pbdoc(
+         Rotate input frame.
+
+         The output array will be resized if needed, its dtype is kept.
+         Destination pixels which map outside of input frame keep their
+         values, same as PySurfaceRotator does.
+
+         :param src: Input numpy array
+         :type src: numpy.ndarray
+         :param dst: Output numpy array
+         :type dst: numpy.ndarray
+         :param angle: Rotation angle in degrees
+         :type angle: float
+         :param shift_x: Shift along X axis in pixels (default: 0.0)
+         :type shift_x: float
+         :param shift_y: Shift along Y axis in pixels (default: 0.0)
+         :type shift_y: float
+         :return: Tuple containing:
+             - success (bool): True if rotation was successful, False otherwise
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: tuple[bool, TaskExecInfo]
+     )pbdoc");
+}
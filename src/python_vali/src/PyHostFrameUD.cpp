@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+PyHostFrameUD::PyHostFrameUD(uint32_t src_width, uint32_t src_height,
+                             Pixel_Format src_format, uint32_t dst_width,
+                             uint32_t dst_height, Pixel_Format dst_format)
+    : m_src_width(src_width), m_src_height(src_height), m_src_fmt(src_format),
+      m_dst_width(dst_width), m_dst_height(dst_height), m_dst_fmt(dst_format) {
+  m_ud = std::make_unique<UDHostFrame>(src_width, src_height, src_format,
+                                       dst_width, dst_height, dst_format);
+}
+
+bool PyHostFrameUD::Run(py::array& src, py::array& dst,
+                        TaskExecDetails& details) {
+  if (src.nbytes() != m_ud->GetSrcSize()) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return false;
+  }
+
+  auto const dst_buf_size = m_ud->GetDstSize();
+  if (dst.nbytes() != dst_buf_size) {
+    if (!dst.itemsize() || dst_buf_size % dst.itemsize()) {
+      details.m_info = TaskExecInfo::INVALID_INPUT;
+      return false;
+    }
+    dst.resize({dst_buf_size / dst.itemsize()}, false);
+  }
+
+  Buffer src_buf(src.nbytes(), (void*)src.mutable_data(), false);
+  Buffer dst_buf(dst.nbytes(), (void*)dst.mutable_data(), false);
+
+  py::gil_scoped_release gil_release{};
+  details = m_ud->Run(src_buf, dst_buf);
+  return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
+}
+
+bool PyHostFrameUD::Run(HostBuffer& src, HostBuffer& dst,
+                        TaskExecDetails& details) {
+  py::gil_scoped_release gil_release{};
+  return RunImpl(src, dst, details);
+}
+
+bool PyHostFrameUD::RunImpl(HostBuffer& src, HostBuffer& dst,
+                            TaskExecDetails& details) {
+  if (src.GetFormat() != m_src_fmt || src.GetWidth() != m_src_width ||
+      src.GetHeight() != m_src_height) {
+    details.m_info = TaskExecInfo::INVALID_INPUT;
+    return false;
+  }
+
+  dst.Reset(m_dst_fmt, m_dst_width, m_dst_height);
+  details = m_ud->Run(src.GetBuffer(), dst.GetBuffer());
+  return (details.m_status == TaskExecStatus::TASK_EXEC_SUCCESS);
+}
+
+std::list<std::pair<Pixel_Format, Pixel_Format>>
+PyHostFrameUD::SupportedFormats() {
+  return UDSurface::SupportedConversions();
+}
+
+void Init_PyHostFrameUD(py::module& m) {
+  py::class_<PyHostFrameUD>(m, "PyHostFrameUD",
+                            "CPU Frame Upsampler-Downscaler")
+      .def(py::init<uint32_t, uint32_t, Pixel_Format, uint32_t, uint32_t,
+                    Pixel_Format>(),
+           py::arg("src_width"), py::arg("src_height"), py::arg("src_format"),
+           py::arg("dst_width"), py::arg("dst_height"), py::arg("dst_format"),
+           R"pbdoc(
+         Constructor for PyHostFrameUD.
+
+         CPU counterpart of PySurfaceUD, supports same conversions.
+         NV12 and P10 inputs give results within 1 LSB of PySurfaceUD ones.
+         YUV420 and YUV420_10bit inputs are resized with libswscale Lanczos
+         filter and may differ by few LSB near sharp edges.
+
+         :param src_width: Width of input frames in pixels
+         :type src_width: int
+         :param src_height: Height of input frames in pixels
+         :type src_height: int
+         :param src_format: Pixel format of input frames
+         :type src_format: Pixel_Format
+         :param dst_width: Width of output frames in pixels
+         :type dst_width: int
+         :param dst_height: Height of output frames in pixels
+         :type dst_height: int
+         :param dst_format: Pixel format of output frames
+         :type dst_format: Pixel_Format
+         :raises ValueError: If conversion isn't supported
+     )pbdoc")
+      .def_static("SupportedFormats", &PyHostFrameUD::SupportedFormats,
+                  R"pbdoc(
+         Get list of supported pixel format conversions.
+
+         :return: List of tuples containing supported (input_format, output_format) pairs
+         :rtype: list[tuple[Pixel_Format, Pixel_Format]]
+     )pbdoc")
+      .def(
+          "Run",
+          [](PyHostFrameUD& self, py::array& src, py::array& dst) {
+            TaskExecDetails details;
+            auto res = self.Run(src, dst, details);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("src"), py::arg("dst"),
+          R"pbdoc(
+         Convert input frame.
+
+         The output array will be resized if needed, its dtype is kept.
+         Use numpy.uint16 for 10 bit outputs and numpy.float32 for float ones.
+
+         :param src: Input numpy array
+         :type src: numpy.ndarray
+         :param dst: Output numpy array
+         :type dst: numpy.ndarray
+         :return: Tuple containing:
+             - success (bool): True if conversion was successful, False otherwise
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: tuple[bool, TaskExecInfo]
+     )pbdoc")
+      .def(
+          "Run",
+          [](PyHostFrameUD& self, HostBuffer& src, HostBuffer& dst) {
+            TaskExecDetails details;
+            auto res = self.Run(src, dst, details);
+            return std::make_tuple(res, details.m_info);
+          },
+          py::arg("src"), py::arg("dst"),
+          R"pbdoc(
+         Convert frame stored in host buffer.
+
+         Input buffer must have the configured resolution and source format.
+         Output buffer is reallocated if its format or size doesn't match.
+
+         :param src: Input host buffer
+         :type src: HostBuffer
+         :param dst: Output host buffer
+         :type dst: HostBuffer
+         :return: Tuple containing:
+             - success (bool): True if conversion was successful, False otherwise
+             - info (TaskExecInfo): Detailed execution information
+         :rtype: tuple[bool, TaskExecInfo]
+     )pbdoc");
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostMemPool.hpp"
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+void Init_PyHostMemPool(py::module& m) {
+  py::class_<HostMemPool::Stats>(m, "HostMemPoolStats",
+                                 "Host memory pool statistics")
+      .def_readonly("bytes_in_use", &HostMemPool::Stats::bytes_in_use,
+                    R"pbdoc(
+         Bytes allocated from pool and not freed yet.
+     )pbdoc")
+      .def_readonly("bytes_cached", &HostMemPool::Stats::bytes_cached,
+                    R"pbdoc(
+         Bytes kept in free blocks for reuse.
+     )pbdoc")
+      .def_readonly("high_water_mark", &HostMemPool::Stats::high_water_mark,
+                    R"pbdoc(
+         Max amount of bytes kept in free blocks.
+     )pbdoc")
+      .def_readonly("hits", &HostMemPool::Stats::hits,
+                    R"pbdoc(
+         Number of allocations served from free blocks.
+     )pbdoc")
+      .def_readonly("misses", &HostMemPool::Stats::misses,
+                    R"pbdoc(
+         Number of allocations served by system allocator.
+     )pbdoc")
+      .def_property_readonly("hit_rate", &HostMemPool::Stats::HitRate,
+                             R"pbdoc(
+         Share of allocations served from free blocks, from 0.0 to 1.0.
+     )pbdoc")
+      .def("__repr__", [](const HostMemPool::Stats& self) {
+        std::stringstream ss;
+        ss << "bytes_in_use:    " << self.bytes_in_use << "\n";
+        ss << "bytes_cached:    " << self.bytes_cached << "\n";
+        ss << "high_water_mark: " << self.high_water_mark << "\n";
+        ss << "hits:            " << self.hits << "\n";
+        ss << "misses:          " << self.misses << "\n";
+        ss << "hit_rate:        " << self.HitRate() << "\n";
+        return ss.str();
+      });
+
+  m.def(
+      "GetHostMemPoolStats",
+      []() { return HostMemPool::Instance().GetStats(); },
+      R"pbdoc(
+         Get statistics of host memory pool used for frames, packets and
+         side data.
+
+         :return: Pool statistics
+         :rtype: HostMemPoolStats
+     )pbdoc");
+
+  m.def(
+      "SetHostMemPoolHighWaterMark",
+      [](size_t bytes) { HostMemPool::Instance().SetHighWaterMark(bytes); },
+      py::arg("bytes"), py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Set max amount of memory kept by host memory pool for reuse.
+         Cached memory above the limit is released immediately.
+
+         :param bytes: Limit in bytes
+         :type bytes: int
+     )pbdoc");
+
+  m.def(
+      "SetHostMemPoolHugePageThreshold",
+      [](size_t bytes) { HostMemPool::Instance().SetHugePageThreshold(bytes); },
+      py::arg("bytes"), py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Let host memory pool back big blocks with transparent huge pages.
+         Blocks allocated afterwards which are this size or bigger are aligned
+         to 2 MB and marked with MADV_HUGEPAGE hint. Huge pages are off by
+         default.
+
+         :param bytes: Min block size in bytes, 0 turns huge pages off
+         :type bytes: int
+     )pbdoc");
+
+  m.def(
+      "TrimHostMemPool", []() { HostMemPool::Instance().Trim(); },
+      py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Release all memory cached by host memory pool.
+     )pbdoc");
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MediaGenerator.hpp"
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+void Init_PyMediaGenerator(py::module& m) {
+  py::class_<ResolutionSwitch, std::shared_ptr<ResolutionSwitch>>(
+      m, "ResolutionSwitch",
+      "Video resolution change starting from given frame.")
+      .def(py::init<>())
+      .def(py::init([](uint32_t frame, uint32_t width, uint32_t height) {
+             return ResolutionSwitch{frame, width, height};
+           }),
+           py::arg("frame"), py::arg("width"), py::arg("height"))
+      .def_readwrite("frame", &ResolutionSwitch::frame,
+                     "Number of first frame with new resolution")
+      .def_readwrite("width", &ResolutionSwitch::width, "New width")
+      .def_readwrite("height", &ResolutionSwitch::height, "New height");
+
+  py::class_<MediaParams, std::shared_ptr<MediaParams>>(
+      m, "MediaParams", "Synthetic clip description.")
+      .def(py::init<>())
+      .def_readwrite("codec", &MediaParams::codec,
+                     "libavcodec software encoder name, e. g. mpeg4, mjpeg, "
+                     "ffv1")
+      .def_readwrite("container", &MediaParams::container,
+                     "File extension, muxer is chosen by it")
+      .def_readwrite("width", &MediaParams::width, "Width in pixels")
+      .def_readwrite("height", &MediaParams::height, "Height in pixels")
+      .def_readwrite("num_frames", &MediaParams::num_frames,
+                     "Number of video frames")
+      .def_readwrite("fps", &MediaParams::fps, "Nominal frame rate")
+      .def_readwrite("gop_size", &MediaParams::gop_size, "GOP size")
+      .def_readwrite("b_frames", &MediaParams::b_frames,
+                     "Max number of consecutive B-frames")
+      .def_readwrite("bit_depth", &MediaParams::bit_depth, "8 or 10")
+      .def_readwrite("vfr_pattern", &MediaParams::vfr_pattern,
+                     "Frame durations in 1 / fps units, cycled. Empty for "
+                     "constant frame rate")
+      .def_readwrite("num_audio_tracks", &MediaParams::num_audio_tracks,
+                     "Number of AAC tracks")
+      .def_readwrite("num_data_tracks", &MediaParams::num_data_tracks,
+                     "Number of KLV data tracks. Container must support "
+                     "them, e. g. ts")
+      .def_readwrite("res_switches", &MediaParams::res_switches,
+                     "Resolution switches in ascending frame order");
+
+  m.def("GenerateMedia", &MediaGenerator::Generate, py::arg("params"),
+        py::arg("path"), py::call_guard<py::gil_scoped_release>(),
+        R"pbdoc(
+         Encode synthetic clip with libavcodec software encoder.
+
+         Frames have gradient background and moving box. File appears when
+         it's complete.
+
+         :param params: Clip description
+         :type params: MediaParams
+         :param path: Output file path, container is guessed by extension
+         :type path: str
+         :raises ValueError: If parameters are invalid or not supported by
+             encoder or container
+         :raises RuntimeError: If encoding fails
+     )pbdoc");
+
+  m.def("GetSyntheticMedia", &MediaGenerator::GetCached, py::arg("params"),
+        py::arg("cache_dir") = "", py::call_guard<py::gil_scoped_release>(),
+        R"pbdoc(
+         Get path of cached synthetic clip, generate it if it's not in cache.
+
+         :param params: Clip description
+         :type params: MediaParams
+         :param cache_dir: Cache directory. If empty, VALI_MEDIA_CACHE
+             environment variable is used, then vali_media in temporary
+             directory
+         :type cache_dir: str
+         :return: Clip path
+         :rtype: str
+         :raises ValueError: If parameters are invalid or not supported by
+             encoder or container
+         :raises RuntimeError: If encoding fails
+     )pbdoc");
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MemStats.hpp"
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+void Init_PyMemStats(py::module& m) {
+  m.def(
+      "GetMemoryStats",
+      []() {
+        auto& stats = MemStats::Instance();
+        py::dict res;
+        for (auto i = 0; i < MemStats::NUM_COMPONENTS; i++) {
+          auto const component = (MemStats::Component)i;
+          auto const counter = stats.Get(component);
+
+          py::dict entry;
+          entry["live_bytes"] = counter.live_bytes;
+          entry["live_allocs"] = counter.live_allocs;
+          entry["peak_bytes"] = counter.peak_bytes;
+          entry["total_allocs"] = counter.total_allocs;
+          res[py::str(MemStats::GetName(component))] = entry;
+        }
+        return res;
+      },
+      R"pbdoc(
+         Get host memory held by VALI components.
+
+         Counters are process-wide. Components are packet_queue (demuxed
+         packets waiting for decoder), decoder_frames (frames of software
+         decoders), buffers (memory owned by Buffer objects), side_data
+         (side data kept in decoder history), encoder_output (encoded
+         packets not yet returned), swscale (libswscale contexts, count
+         only) and host_frames (other frames taken from host memory pool).
+
+         :return: Dictionary keyed by component name. Values are
+             dictionaries with live_bytes, live_allocs, peak_bytes (max of
+             live bytes since last reset) and total_allocs
+         :rtype: dict[str, dict]
+     )pbdoc");
+
+  m.def(
+      "ResetMemoryStatsPeaks", []() { MemStats::Instance().ResetPeaks(); },
+      py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Set peak bytes of every component to its current live bytes.
+     )pbdoc");
+
+  m.def(
+      "SetMemoryStatsLogInterval",
+      [](double seconds) {
+        auto const interval = std::chrono::duration<double>(seconds);
+        MemStats::Instance().SetLogInterval(
+            std::chrono::duration_cast<std::chrono::milliseconds>(interval));
+      },
+      py::arg("seconds"), py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Periodically write one line memory summary to stderr.
+
+         Summary has live bytes and allocations of every component and
+         host memory pool usage.
+
+         :param seconds: Interval between lines. Zero or negative value
+             stops logging
+         :type seconds: float
+     )pbdoc");
+}
@@ -0,0 +1,330 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+constexpr auto TASK_EXEC_SUCCESS = TaskExecStatus::TASK_EXEC_SUCCESS;
+constexpr auto TASK_EXEC_FAIL = TaskExecStatus::TASK_EXEC_FAIL;
+
+// Frame passed between pipeline stages. Tokens are recycled by stage pools,
+// so frame memory is allocated once per token.
+struct HostFrameToken : public Token {
+  HostBuffer frame;
+  PacketData pkt_data = {};
+
+  HostFrameToken(Pixel_Format format, uint32_t width, uint32_t height)
+      : frame(format, width, height) {}
+};
+
+PyPipeline::PyPipeline() : m_pipeline(new Pipeline()) {}
+
+PyPipeline::~PyPipeline() {
+  // Decoder thread may wait for GIL to read from Python file object.
+  py::gil_scoped_release gil_release{};
+  m_pipeline.reset();
+}
+
+const PyPipeline::StageInfo& PyPipeline::GetStage(size_t stage) const {
+  if (stage >= m_stages.size()) {
+    throw std::invalid_argument("Invalid pipeline stage: " +
+                                std::to_string(stage));
+  }
+  return m_stages[stage];
+}
+
+size_t PyPipeline::AddDecoder(PyDecoder& decoder, size_t pool_size) {
+  if (decoder.IsAccelerated()) {
+    throw std::invalid_argument("Pipeline supports CPU decoders only");
+  }
+
+  StageInfo info;
+  info.format = decoder.PixelFormat();
+  info.width = decoder.Width();
+  info.height = decoder.Height();
+  info.pool_size = pool_size;
+
+  auto p_dec = &decoder;
+  auto func = [p_dec](const std::vector<Token*>& srcs, Token& dst) {
+    auto& token = static_cast<HostFrameToken&>(dst);
+    TaskExecDetails details;
+    auto res = p_dec->DecodeHostFrameImpl(token.frame, details,
+                                          token.pkt_data, std::nullopt);
+
+    // Downstream stages are made for particular resolution.
+    if (res && TaskExecInfo::RES_CHANGE == details.m_info) {
+      return TaskExecDetails(TASK_EXEC_FAIL, TaskExecInfo::RES_CHANGE,
+                             "resolution change");
+    }
+
+    details.m_status = res ? TASK_EXEC_SUCCESS : TASK_EXEC_FAIL;
+    return details;
+  };
+
+  auto factory = [info]() {
+    return new HostFrameToken(info.format, info.width, info.height);
+  };
+
+  auto const stage =
+      m_pipeline->AddStage("decoder", {}, func, factory, pool_size);
+  m_stages.push_back(info);
+  return stage;
+}
+
+size_t
+PyPipeline::AddConverter(size_t input, PyFrameConverter& converter,
+                         std::shared_ptr<ColorspaceConversionContext> context,
+                         size_t pool_size) {
+  auto const& src = GetStage(input);
+  if (src.format != converter.m_src_fmt || src.width != converter.m_width ||
+      src.height != converter.m_height) {
+    throw std::invalid_argument(
+        "Converter input doesn't match output of stage " +
+        std::to_string(input));
+  }
+
+  StageInfo info;
+  info.format = converter.m_dst_fmt;
+  info.width = converter.m_width;
+  info.height = converter.m_height;
+  info.pool_size = pool_size;
+
+  auto p_cvt = &converter;
+  auto func = [p_cvt, context](const std::vector<Token*>& srcs, Token& dst) {
+    auto& src_token = static_cast<HostFrameToken&>(*srcs[0]);
+    auto& dst_token = static_cast<HostFrameToken&>(dst);
+    TaskExecDetails details;
+    auto res = p_cvt->RunImpl(src_token.frame, dst_token.frame, context,
+                              details);
+
+    dst_token.pkt_data = src_token.pkt_data;
+    details.m_status = res ? TASK_EXEC_SUCCESS : TASK_EXEC_FAIL;
+    return details;
+  };
+
+  auto factory = [info]() {
+    return new HostFrameToken(info.format, info.width, info.height);
+  };
+
+  auto const stage =
+      m_pipeline->AddStage("converter", {input}, func, factory, pool_size);
+  m_stages.push_back(info);
+  return stage;
+}
+
+size_t PyPipeline::AddResizer(size_t input, PyHostFrameUD& resizer,
+                              size_t pool_size) {
+  auto const& src = GetStage(input);
+  if (src.format != resizer.m_src_fmt || src.width != resizer.m_src_width ||
+      src.height != resizer.m_src_height) {
+    throw std::invalid_argument("Resizer input doesn't match output of stage " +
+                                std::to_string(input));
+  }
+
+  StageInfo info;
+  info.format = resizer.m_dst_fmt;
+  info.width = resizer.m_dst_width;
+  info.height = resizer.m_dst_height;
+  info.pool_size = pool_size;
+
+  auto p_ud = &resizer;
+  auto func = [p_ud](const std::vector<Token*>& srcs, Token& dst) {
+    auto& src_token = static_cast<HostFrameToken&>(*srcs[0]);
+    auto& dst_token = static_cast<HostFrameToken&>(dst);
+    TaskExecDetails details;
+    auto res = p_ud->RunImpl(src_token.frame, dst_token.frame, details);
+
+    dst_token.pkt_data = src_token.pkt_data;
+    details.m_status = res ? TASK_EXEC_SUCCESS : TASK_EXEC_FAIL;
+    return details;
+  };
+
+  auto factory = [info]() {
+    return new HostFrameToken(info.format, info.width, info.height);
+  };
+
+  auto const stage =
+      m_pipeline->AddStage("resizer", {input}, func, factory, pool_size);
+  m_stages.push_back(info);
+  return stage;
+}
+
+void PyPipeline::Start() { m_pipeline->Start(); }
+
+void PyPipeline::Stop() { m_pipeline->Stop(); }
+
+TaskExecDetails PyPipeline::Pull(
+    size_t stage, size_t batch_size, int timeout_ms,
+    std::vector<std::pair<std::shared_ptr<HostBuffer>,
+                          std::shared_ptr<PacketData>>>& frames) {
+  // Batch would wait for frames which it holds itself.
+  if (batch_size > GetStage(stage).pool_size) {
+    throw std::invalid_argument("Batch size exceeds stage pool size");
+  }
+
+  frames.clear();
+  while (frames.size() < batch_size) {
+    PipelineToken token;
+    auto details = m_pipeline->Pull(stage, token, timeout_ms);
+    if (TASK_EXEC_SUCCESS != details.m_status) {
+      return details;
+    }
+
+    /* Frame shares memory with token. Token goes back to stage pool when
+     * frame and all arrays exported from it are gone.
+     */
+    auto& frame_token = static_cast<HostFrameToken&>(*token.get());
+    auto& src = frame_token.frame;
+    auto buf = std::shared_ptr<Buffer>(
+        Buffer::Make(src.GetSize(), src.GetData()), [token](Buffer* p) {
+          delete p;
+        });
+
+    frames.emplace_back(
+        std::make_shared<HostBuffer>(buf, src.GetFormat(), src.GetWidth(),
+                                     src.GetHeight()),
+        std::make_shared<PacketData>(frame_token.pkt_data));
+  }
+
+  return TaskExecDetails();
+}
+
+void Init_PyPipeline(py::module& m) {
+  py::class_<PyPipeline, std::shared_ptr<PyPipeline>>(
+      m, "PyPipeline",
+      "Pipeline of CPU processing stages running on separate threads.")
+      .def(py::init<>(),
+           R"pbdoc(
+         Create empty pipeline.
+
+         Stages are added with AddDecoder, AddConverter and AddResizer
+         methods which return stage index. Every stage runs on its own
+         thread without GIL, so stages overlap. Stages pass frames to each
+         other through bounded queues, frames are recycled by stage pools.
+         Stages without downstream stages are sinks, use Pull to get their
+         frames.
+
+         Objects added to pipeline are kept alive by it and must not be used
+         until pipeline is stopped.
+     )pbdoc")
+      .def("AddDecoder", &PyPipeline::AddDecoder, py::arg("decoder"),
+           py::arg("pool_size") = 4, py::keep_alive<1, 2>(),
+           R"pbdoc(
+         Add source stage which decodes frames.
+
+         Pipeline finishes when decoder reaches end of stream. Resolution
+         change stops the pipeline with RES_CHANGE info.
+
+         :param decoder: CPU decoder
+         :type decoder: PyDecoder
+         :param pool_size: Max number of stage frames in flight
+         :type pool_size: int
+         :return: Stage index
+         :rtype: int
+         :raises ValueError: If decoder is hardware accelerated
+     )pbdoc")
+      .def("AddConverter", &PyPipeline::AddConverter, py::arg("input"),
+           py::arg("converter"), py::arg("cc_ctx") = py::none(),
+           py::arg("pool_size") = 4, py::keep_alive<1, 3>(),
+           R"pbdoc(
+         Add stage which converts frames to other pixel format.
+
+         :param input: Index of upstream stage
+         :type input: int
+         :param converter: Frame converter
+         :type converter: PyFrameConverter
+         :param cc_ctx: Colorspace conversion context
+         :type cc_ctx: ColorspaceConversionContext
+         :param pool_size: Max number of stage frames in flight
+         :type pool_size: int
+         :return: Stage index
+         :rtype: int
+         :raises ValueError: If converter input doesn't match upstream stage output
+     )pbdoc")
+      .def("AddResizer", &PyPipeline::AddResizer, py::arg("input"),
+           py::arg("resizer"), py::arg("pool_size") = 4,
+           py::keep_alive<1, 3>(),
+           R"pbdoc(
+         Add stage which resizes frames.
+
+         :param input: Index of upstream stage
+         :type input: int
+         :param resizer: Frame resizer
+         :type resizer: PyHostFrameUD
+         :param pool_size: Max number of stage frames in flight
+         :type pool_size: int
+         :return: Stage index
+         :rtype: int
+         :raises ValueError: If resizer input doesn't match upstream stage output
+     )pbdoc")
+      .def("Start", &PyPipeline::Start,
+           R"pbdoc(
+         Start stage threads. Pipeline can be started once.
+
+         :raises RuntimeError: If pipeline was started before or is empty
+     )pbdoc")
+      .def("Stop", &PyPipeline::Stop,
+           py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(
+         Stop stage threads and drop queued frames.
+
+         Frames taken by Pull stay valid.
+     )pbdoc")
+      .def(
+          "Pull",
+          [](PyPipeline& self, size_t stage, size_t batch_size,
+             int timeout_ms) {
+            std::vector<std::pair<std::shared_ptr<HostBuffer>,
+                                  std::shared_ptr<PacketData>>>
+                frames;
+            TaskExecDetails details;
+            {
+              py::gil_scoped_release gil_release{};
+              details = self.Pull(stage, batch_size, timeout_ms, frames);
+            }
+
+            if (!details.m_msg.empty() &&
+                TaskExecInfo::MORE_DATA_NEEDED != details.m_info) {
+              av_log(nullptr, AV_LOG_ERROR, "Pipeline stopped by %s\n",
+                     details.m_msg.c_str());
+            }
+            return std::make_tuple(frames, details.m_info);
+          },
+          py::arg("stage"), py::arg("batch_size") = 1,
+          py::arg("timeout_ms") = -1,
+          R"pbdoc(
+         Take batch of frames from sink stage.
+
+         Frames share memory with pipeline. Frame goes back to stage pool
+         when it and all arrays exported from it are destroyed, so keep
+         frames only as long as needed. Otherwise stage runs out of frames
+         and pipeline stalls. Release previous batch before taking next one
+         unless stage pool fits both.
+
+         :param stage: Sink stage index
+         :type stage: int
+         :param batch_size: Number of frames to take
+         :type batch_size: int
+         :param timeout_ms: Wait timeout for every frame, negative means no timeout
+         :type timeout_ms: int
+         :return: Tuple containing:
+             - frames (list[tuple[HostBuffer, PacketData]]): Frames with their packet data
+             - info (TaskExecInfo): SUCCESS if batch is full. END_OF_STREAM if pipeline is done, MORE_DATA_NEEDED on timeout, failure info of stage which stopped the pipeline otherwise
+         :rtype: tuple[list[tuple[HostBuffer, PacketData]], TaskExecInfo]
+         :raises ValueError: If stage isn't a sink or batch size exceeds its pool size
+         :raises RuntimeError: If pipeline isn't started
+     )pbdoc");
+}
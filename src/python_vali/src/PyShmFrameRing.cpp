@@ -0,0 +1,137 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ShmFrameRing.hpp"
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+static py::object AcquireFrame(std::shared_ptr<ShmFrameRing> ring,
+                               int timeout_ms) {
+  ShmFrameInfo info;
+  int slot = -1;
+  {
+    py::gil_scoped_release gil_release{};
+    slot = ring->AcquireRead(info, timeout_ms);
+  }
+
+  if (slot < 0) {
+    return py::none();
+  }
+
+  /* Slot is given back when frame and all arrays exported from it are gone.
+   * Deleter holds the ring, so mapping outlives the frame.
+   */
+  auto buf = std::shared_ptr<Buffer>(
+      Buffer::Make(info.size, ring->SlotData(slot)), [ring, slot](Buffer* p) {
+        delete p;
+        ring->Release(slot);
+      });
+
+  auto frame = std::make_shared<HostBuffer>(buf, (Pixel_Format)info.format,
+                                            info.width, info.height);
+
+  auto pkt_data = std::make_shared<PacketData>();
+  pkt_data->key = info.key;
+  pkt_data->pts = info.pts;
+  pkt_data->dts = info.dts;
+  pkt_data->pos = info.pos;
+  pkt_data->bsl = info.bsl;
+  pkt_data->duration = info.duration;
+
+  return py::make_tuple(frame, pkt_data);
+}
+
+void Init_PyShmFrameRing(py::module& m) {
+  py::class_<ShmFrameRing, std::shared_ptr<ShmFrameRing>>(
+      m, "ShmFrameRing",
+      "Ring of frame slots in shared memory. Passes decoded frames between "
+      "processes without copy.")
+      .def_static(
+          "Create",
+          [](const std::string& name, uint32_t num_slots, size_t slot_size) {
+            return std::shared_ptr<ShmFrameRing>(
+                ShmFrameRing::Create(name, num_slots, slot_size));
+          },
+          py::arg("name"), py::arg("num_slots"), py::arg("slot_size"),
+          R"pbdoc(
+         Create shared memory ring.
+
+         Shared memory object is removed when ring created by this call is
+         destroyed. Use PyDecoder.HostFrameSize as slot size.
+
+         :param name: Shared memory object name
+         :type name: str
+         :param num_slots: Number of frame slots
+         :type num_slots: int
+         :param slot_size: Slot size in bytes
+         :type slot_size: int
+         :raises RuntimeError: If name is taken or memory can't be allocated
+     )pbdoc")
+      .def_static(
+          "Attach",
+          [](const std::string& name) {
+            return std::shared_ptr<ShmFrameRing>(ShmFrameRing::Attach(name));
+          },
+          py::arg("name"),
+          R"pbdoc(
+         Attach to ring created by other process.
+
+         :param name: Shared memory object name
+         :type name: str
+         :raises RuntimeError: If there's no ring with such name
+     )pbdoc")
+      .def_property_readonly("Name", &ShmFrameRing::Name,
+                             R"pbdoc(
+         Get shared memory object name.
+
+         :return: Name
+         :rtype: str
+     )pbdoc")
+      .def_property_readonly("NumSlots", &ShmFrameRing::NumSlots,
+                             R"pbdoc(
+         Get number of slots.
+
+         :return: Number of slots
+         :rtype: int
+     )pbdoc")
+      .def_property_readonly("SlotSize", &ShmFrameRing::SlotSize,
+                             R"pbdoc(
+         Get slot size in bytes.
+
+         :return: Slot size in bytes
+         :rtype: int
+     )pbdoc")
+      .def("Acquire", &AcquireFrame, py::arg("timeout_ms") = -1,
+           R"pbdoc(
+         Wait for next frame published by producer.
+
+         Frame shares memory with ring slot. Slot is given back to producer
+         when frame and all arrays exported from it are destroyed, so keep
+         them only as long as needed. Every frame is received by one
+         consumer only.
+
+         :param timeout_ms: Wait timeout, negative means no timeout
+         :type timeout_ms: int
+         :return: Tuple of frame and its packet data, None on timeout
+         :rtype: tuple[HostBuffer, PacketData] | None
+     )pbdoc")
+      .def("__repr__", [](ShmFrameRing& self) {
+        std::stringstream ss;
+        ss << "ShmFrameRing(" << self.Name() << ", " << self.NumSlots()
+           << " slots, " << self.SlotSize() << " bytes)";
+        return ss.str();
+      });
+}
@@ -83,7 +83,7 @@ string ToString(Surface& self) {
   return ss.str();
 }
 
-static void dlpack_capsule_deleter(PyObject* self) {
+void dlpack_capsule_deleter(PyObject* self) {
   if (PyCapsule_IsValid(self, "used_dltensor")) {
     return;
   }
@@ -158,8 +158,17 @@ void Init_PySurface(py::module& m) {
                              R"pbdoc(
          Get the CUDA device pointer to the surface plane data.
 
+         For planes located in host memory it's host memory address.
+
          :return: CUDA device pointer to the plane's data
          :rtype: int
+     )pbdoc")
+      .def_property_readonly("IsOnHost", &SurfacePlane::OnHost,
+                             R"pbdoc(
+         Check if the surface plane is located in host memory.
+
+         :return: True if plane memory is located in RAM, False otherwise
+         :rtype: bool
      )pbdoc")
       .def(
           "__dlpack_device__",
@@ -204,6 +213,11 @@ void Init_PySurface(py::module& m) {
       .def_property_readonly(
           "__cuda_array_interface__",
           [](shared_ptr<SurfacePlane> self) {
+            if (self->OnHost()) {
+              throw py::attribute_error(
+                  "SurfacePlane is located in host memory. Use DLPack.");
+            }
+
             CudaArrayInterfaceDescriptor cai;
             self->ToCAI(cai);
 
@@ -293,6 +307,16 @@ void Init_PySurface(py::module& m) {
 
          :return: Required host memory size in bytes
          :rtype: int
+     )pbdoc")
+      .def_property_readonly("IsOnHost", &Surface::OnHost,
+                             R"pbdoc(
+         Check if the surface is located in host memory.
+
+         Host surfaces are made with gpu_id=-1. They support DLPack with
+         kDLCPU device type and are processed on CPU by Surface tasks.
+
+         :return: True if surface memory is located in RAM, False otherwise
+         :rtype: bool
      )pbdoc")
       .def_property_readonly("IsOwnMemory", &Surface::OwnMemory,
                              R"pbdoc(
@@ -326,9 +350,10 @@ void Init_PySurface(py::module& m) {
           "Make",
           [](Pixel_Format format, uint32_t newWidth, uint32_t newHeight,
              int gpuID) {
+            auto const ctx = gpuID < 0 ? HostContext()
+                                       : CudaResMgr::Instance().GetCtx(gpuID);
             auto pNewSurf = shared_ptr<Surface>(
-                Surface::Make(format, newWidth, newHeight,
-                              CudaResMgr::Instance().GetCtx(gpuID)));
+                Surface::Make(format, newWidth, newHeight, ctx));
             return pNewSurf;
           },
           py::arg("format"), py::arg("width"), py::arg("height"),
@@ -338,6 +363,8 @@ void Init_PySurface(py::module& m) {
 
          Allocates a new surface with the given pixel format and dimensions
          on the specified GPU. The surface will be managed by the Python interpreter.
+         Negative gpu_id allocates pitched host memory, rows are aligned
+         to 64 bytes. Such surface needs no CUDA and supports DLPack.
 
          :param format: Pixel format for the new surface
          :type format: Pixel_Format
@@ -345,7 +372,7 @@ void Init_PySurface(py::module& m) {
          :type width: int
          :param height: Height of the surface in pixels
          :type height: int
-         :param gpu_id: ID of the GPU to allocate memory on
+         :param gpu_id: ID of the GPU to allocate memory on, -1 for host memory
          :type gpu_id: int
          :return: New surface with allocated memory
          :rtype: Surface
@@ -416,6 +443,11 @@ void Init_PySurface(py::module& m) {
                                      "methods for particular plane instead."));
             }
 
+            if (self.OnHost()) {
+              throw py::attribute_error(
+                  "Surface is located in host memory. Use DLPack.");
+            }
+
             auto plane = self.GetSurfacePlane(0U);
             CudaArrayInterfaceDescriptor cai;
             self.ToCAI(cai);
@@ -459,6 +491,7 @@ void Init_PySurface(py::module& m) {
           py::arg("capsule"), py::arg("format") = Pixel_Format::RGB,
           R"pbdoc(
         DLPack: Make Surface from dlpack, don not own memory.
+        Both kDLCUDA and kDLCPU tensors are accepted.
 
         :param capsule: capsule object with manager dltensor inside
         :param fmt: pixel format, by default python_vali.PixelFormat.RGB
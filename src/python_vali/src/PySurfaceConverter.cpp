@@ -24,12 +24,17 @@ constexpr auto TASK_EXEC_SUCCESS = TaskExecStatus::TASK_EXEC_SUCCESS;
 constexpr auto TASK_EXEC_FAIL = TaskExecStatus::TASK_EXEC_FAIL;
 
 PySurfaceConverter::PySurfaceConverter(int gpu_id)
-    : PySurfaceConverter(gpu_id, CudaResMgr::Instance().GetStream(gpu_id)) {}
+    : PySurfaceConverter(
+          gpu_id,
+          gpu_id < 0 ? nullptr : CudaResMgr::Instance().GetStream(gpu_id)) {}
 
 PySurfaceConverter::PySurfaceConverter(int gpu_id, CUstream str) {
   m_stream = str;
   upConverter = std::make_unique<ConvertSurface>(gpu_id, m_stream);
-  m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  // Host Surfaces are processed synchronously, there's no CUDA work to wait.
+  if (gpu_id >= 0) {
+    m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  }
 }
 
 bool PySurfaceConverter::Run(Surface& src, Surface& dst,
@@ -55,7 +60,7 @@ void Init_PySurfaceConverter(py::module& m) {
          Creates a new instance of PySurfaceConverter that will run on the specified GPU.
          The CUDA stream will be automatically created and managed.
 
-         :param gpu_id: The ID of the GPU to use for pixel format conversion
+         :param gpu_id: The ID of the GPU to use for pixel format conversion, -1 for host surfaces
          :type gpu_id: int
          :raises RuntimeError: If the specified GPU is not available
      )pbdoc")
@@ -78,8 +83,10 @@ void Init_PySurfaceConverter(py::module& m) {
              std::optional<ColorspaceConversionContext> cc_ctx) {
             TaskExecDetails details;
             auto res = self.Run(src, dst, cc_ctx, details);
-            self.m_event->Record();
-            self.m_event->Wait();
+            if (self.m_event) {
+              self.m_event->Record();
+              self.m_event->Wait();
+            }
             return std::make_tuple(res, details.m_info);
           },
           py::arg("src"), py::arg("dst"), py::arg("cc_ctx") = std::nullopt,
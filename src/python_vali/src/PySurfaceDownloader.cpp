@@ -35,12 +35,11 @@ PySurfaceDownloader::PySurfaceDownloader(int gpu_id, CUstream str) {
 
 bool PySurfaceDownloader::Run(Surface& src, py::array& dst,
                               TaskExecDetails& details) {
-  auto buffer =
-      std::shared_ptr<Buffer>(Buffer::Make(dst.nbytes(), dst.mutable_data()));
+  Buffer buffer(dst.nbytes(), dst.mutable_data(), false);
   py::gil_scoped_release gil_release{};
 
   upDownloader->SetInput(&src, 0U);
-  upDownloader->SetInput(buffer.get(), 1U);
+  upDownloader->SetInput(&buffer, 1U);
 
   details = upDownloader->Execute();
   return (TASK_EXEC_SUCCESS == details.m_status);
@@ -26,14 +26,17 @@ constexpr auto TASK_EXEC_SUCCESS = TaskExecStatus::TASK_EXEC_SUCCESS;
 constexpr auto TASK_EXEC_FAIL = TaskExecStatus::TASK_EXEC_FAIL;
 
 PySurfaceResizer::PySurfaceResizer(Pixel_Format format, int gpu_id)
-    : PySurfaceResizer(format, gpu_id,
-                       CudaResMgr::Instance().GetStream(gpu_id)) {}
+    : PySurfaceResizer(
+          format, gpu_id,
+          gpu_id < 0 ? nullptr : CudaResMgr::Instance().GetStream(gpu_id)) {}
 
 PySurfaceResizer::PySurfaceResizer(Pixel_Format format, int gpu_id,
                                    CUstream str) {
   m_stream = str;
   upResizer = std::make_unique<ResizeSurface>(format, gpu_id, m_stream);
-  m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  if (gpu_id >= 0) {
+    m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  }
 }
 
 bool PySurfaceResizer::Run(Surface& src, Surface& dst,
@@ -57,7 +60,7 @@ void Init_PySurfaceResizer(py::module& m) {
 
          :param format: The pixel format to use for resizing operations
          :type format: Pixel_Format
-         :param gpu_id: The ID of the GPU to use for resizing
+         :param gpu_id: The ID of the GPU to use for resizing, -1 for host surfaces
          :type gpu_id: int
          :raises RuntimeError: If the specified GPU is not available
      )pbdoc")
@@ -82,8 +85,10 @@ void Init_PySurfaceResizer(py::module& m) {
           [](PySurfaceResizer& self, Surface& src, Surface& dst) {
             TaskExecDetails details;
             auto res = self.Run(src, dst, details);
-            self.m_event->Record();
-            self.m_event->Wait();
+            if (self.m_event) {
+              self.m_event->Record();
+              self.m_event->Wait();
+            }
             return std::make_tuple(res, details.m_info);
           },
           py::arg("src"), py::arg("dst"),
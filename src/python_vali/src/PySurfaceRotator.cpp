@@ -23,12 +23,16 @@ constexpr auto TASK_EXEC_SUCCESS = TaskExecStatus::TASK_EXEC_SUCCESS;
 constexpr auto TASK_EXEC_FAIL = TaskExecStatus::TASK_EXEC_FAIL;
 
 PySurfaceRotator::PySurfaceRotator(int gpu_id)
-    : PySurfaceRotator(gpu_id, CudaResMgr::Instance().GetStream(gpu_id)) {}
+    : PySurfaceRotator(
+          gpu_id,
+          gpu_id < 0 ? nullptr : CudaResMgr::Instance().GetStream(gpu_id)) {}
 
 PySurfaceRotator::PySurfaceRotator(int gpu_id, CUstream str) {
   m_stream = str;
   m_rotator = std::make_unique<RotateSurface>(gpu_id, m_stream);
-  m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  if (gpu_id >= 0) {
+    m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  }
 }
 
 std::list<Pixel_Format> PySurfaceRotator::SupportedFormats() {
@@ -40,6 +44,12 @@ std::list<Pixel_Format> PySurfaceRotator::SupportedFormats() {
 bool PySurfaceRotator::Run(double angle, double shift_x, double shift_y,
                            Surface& src, Surface& dst,
                            TaskExecDetails& details) {
+  // RotateHostFrame treats multiples of 90 degrees on its own.
+  if (src.OnHost()) {
+    details = m_rotator->Run(angle, shift_x, shift_y, src, dst);
+    return (TASK_EXEC_SUCCESS == details.m_status);
+  }
+
   double angle_norm = angle;
   double norm_shift_x = shift_x;
   double norm_shift_y = shift_y;
@@ -86,7 +96,7 @@ void Init_PySurfaceRotator(py::module& m) {
          Creates a new instance of PySurfaceRotator that will run on the specified GPU.
          The CUDA stream will be automatically created and managed.
 
-         :param gpu_id: The ID of the GPU to use for rotation
+         :param gpu_id: The ID of the GPU to use for rotation, -1 for host surfaces
          :type gpu_id: int
          :raises RuntimeError: If the specified GPU is not available
      )pbdoc")
@@ -121,8 +131,10 @@ void Init_PySurfaceRotator(py::module& m) {
              double shift_x, double shift_y) {
             TaskExecDetails details;
             auto res = self.Run(angle, shift_x, shift_y, src, dst, details);
-            self.m_event->Record();
-            self.m_event->Wait();
+            if (self.m_event) {
+              self.m_event->Record();
+              self.m_event->Wait();
+            }
             return std::make_tuple(res, details.m_info);
           },
           py::arg("src"), py::arg("dst"), py::arg("angle"),
@@ -23,12 +23,16 @@ constexpr auto TASK_EXEC_SUCCESS = TaskExecStatus::TASK_EXEC_SUCCESS;
 constexpr auto TASK_EXEC_FAIL = TaskExecStatus::TASK_EXEC_FAIL;
 
 PySurfaceUD::PySurfaceUD(int gpu_id)
-    : PySurfaceUD(gpu_id, CudaResMgr::Instance().GetStream(gpu_id)) {}
+    : PySurfaceUD(
+          gpu_id,
+          gpu_id < 0 ? nullptr : CudaResMgr::Instance().GetStream(gpu_id)) {}
 
 PySurfaceUD::PySurfaceUD(int gpu_id, CUstream str) {
   m_stream = str;
   m_ud = std::make_unique<UDSurface>(gpu_id, m_stream);
-  m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  if (gpu_id >= 0) {
+    m_event = std::make_shared<CudaStreamEvent>(m_stream, gpu_id);
+  }
 }
 
 std::list<std::pair<Pixel_Format, Pixel_Format>>
@@ -52,7 +56,7 @@ void Init_PySurfaceUD(py::module& m) {
          Creates a new instance of PySurfaceUD that will run on the specified GPU.
          The CUDA stream will be automatically created and managed.
 
-         :param gpu_id: The ID of the GPU to use for processing
+         :param gpu_id: The ID of the GPU to use for processing, -1 for host surfaces
          :type gpu_id: int
          :raises RuntimeError: If the specified GPU is not available
      )pbdoc")
@@ -84,8 +88,10 @@ void Init_PySurfaceUD(py::module& m) {
           [](PySurfaceUD& self, Surface& src, Surface& dst) {
             TaskExecDetails details;
             auto res = self.Run(src, dst, details);
-            self.m_event->Record();
-            self.m_event->Wait();
+            if (self.m_event) {
+              self.m_event->Record();
+              self.m_event->Wait();
+            }
             return std::make_tuple(res, details.m_info);
           },
           py::arg("src"), py::arg("dst"),
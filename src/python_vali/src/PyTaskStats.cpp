@@ -0,0 +1,84 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TaskStats.hpp"
+#include "VALI.hpp"
+
+using namespace VPF;
+namespace py = pybind11;
+
+static py::dict CounterToDict(const TaskStats::Counter& counter) {
+  py::dict infos;
+  for (auto i = 0U; i < counter.infos.size(); i++) {
+    if (counter.infos[i]) {
+      infos[py::cast((TaskExecInfo)i)] = counter.infos[i];
+    }
+  }
+
+  // Non-empty buckets only, as (lower bound in us, count) pairs.
+  py::list histogram;
+  for (auto i = 0U; i < counter.histogram.size(); i++) {
+    if (counter.histogram[i]) {
+      histogram.append(py::make_tuple(
+          TaskStats::BucketLowerBound(i) / 1000.0, counter.histogram[i]));
+    }
+  }
+
+  py::dict res;
+  res["calls"] = counter.calls;
+  res["failures"] = counter.failures;
+  res["infos"] = infos;
+  res["total_ms"] = counter.total_ns / 1e6;
+  res["mean_us"] = counter.MeanNs() / 1e3;
+  res["p50_us"] = counter.QuantileNs(0.5) / 1e3;
+  res["p99_us"] = counter.QuantileNs(0.99) / 1e3;
+  res["max_us"] = counter.max_ns / 1e3;
+  res["histogram"] = histogram;
+  return res;
+}
+
+void Init_PyTaskStats(py::module& m) {
+  m.def(
+      "GetTaskStats",
+      []() {
+        py::dict res;
+        for (auto& counter : TaskStats::Instance().GetCounters()) {
+          res[py::str(counter.name)] = CounterToDict(counter);
+        }
+        return res;
+      },
+      R"pbdoc(
+         Get call statistics of processing tasks.
+
+         Statistics are collected for all decoders, converters and other
+         processing classes in the process, tasks of same kind share
+         counters. Only tasks called since last reset are listed.
+         Latency quantiles are estimated from histogram with log-linear
+         buckets, estimation error is within 12.5%. Max latency is exact.
+
+         :return: Dictionary keyed by task name. Values are dictionaries with
+             calls, failures (calls with failed status), infos (calls by
+             returned TaskExecInfo), total_ms, mean_us, p50_us, p99_us,
+             max_us and histogram (list of bucket lower bound in
+             microseconds and number of calls)
+         :rtype: dict[str, dict]
+     )pbdoc");
+
+  m.def(
+      "ResetTaskStats", []() { TaskStats::Instance().Reset(); },
+      py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Reset call statistics of processing tasks.
+     )pbdoc");
+}
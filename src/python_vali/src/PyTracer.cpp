@@ -0,0 +1,101 @@
+/*
+ * Copyright 2025 Vision Labs LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tracer.hpp"
+#include "VALI.hpp"
+#include <fstream>
+
+using namespace VPF;
+namespace py = pybind11;
+
+void Init_PyTracer(py::module& m) {
+  py::enum_<TraceBackend>(m, "TraceBackend")
+      .value("OFF", TraceBackend::OFF, "Tracing is off.")
+      .value("NVTX", TraceBackend::NVTX,
+             "NVTX ranges. Has effect only if VALI is built with USE_NVTX.")
+      .value("CHROME", TraceBackend::CHROME,
+             "In-memory ring of ranges, dumped in Chrome trace format.");
+
+  m.def(
+      "SetTraceBackend",
+      [](TraceBackend backend, size_t capacity) {
+        Tracer::Instance().SetBackend(backend, capacity);
+      },
+      py::arg("backend"), py::arg("capacity") = Tracer::DEFAULT_CAPACITY,
+      py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Select where trace ranges of decoders, converters and other
+         processing classes go. Default is NVTX.
+
+         Selecting CHROME starts new capture. Ranges are kept in ring buffer,
+         so capture holds last ranges only. Ring is reused if capacity is
+         same, otherwise old ring is freed once no thread records to it.
+
+         :param backend: Trace backend
+         :type backend: TraceBackend
+         :param capacity: Max number of ranges kept by CHROME backend
+         :type capacity: int
+         :raises ValueError: If capacity is zero
+     )pbdoc");
+
+  m.def(
+      "GetTraceBackend", []() { return Tracer::Instance().GetBackend(); },
+      R"pbdoc(
+         Get current trace backend.
+
+         :return: Trace backend
+         :rtype: TraceBackend
+     )pbdoc");
+
+  m.def(
+      "SetTraceTag",
+      [](const std::string& tag) { Tracer::Instance().SetThreadTag(tag); },
+      py::arg("tag"), py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Set tag of ranges recorded by calling thread, e. g. stream name.
+         Tag goes to range arguments. Pipeline stages are tagged by stage
+         kind.
+
+         :param tag: Tag, empty string means no tag
+         :type tag: str
+     )pbdoc");
+
+  m.def(
+      "DumpTrace",
+      [](const std::string& path) {
+        std::ofstream out(path);
+        if (!out) {
+          throw std::runtime_error("Can't open file " + path);
+        }
+
+        auto const num_ranges = Tracer::Instance().Dump(out);
+        if (!out.flush()) {
+          throw std::runtime_error("Can't write file " + path);
+        }
+        return num_ranges;
+      },
+      py::arg("path"), py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+         Write ranges of CHROME backend capture to file in Chrome trace JSON
+         format. File can be opened by Perfetto UI or chrome://tracing.
+
+         Capture isn't stopped, so it can be dumped periodically.
+
+         :param path: Output file path
+         :type path: str
+         :return: Number of ranges written
+         :rtype: int
+         :raises RuntimeError: If file can't be written
+     )pbdoc");
+}
@@ -52,6 +52,23 @@ void Init_PySurface(py::module&);
 
 void Init_PyFrameConverter(py::module&);
 
+void Init_PyFrameLetterbox(py::module&);
+
+void Init_PyFrameCropper(py::module&);
+
+void Init_PyHostFrameConverter(py::module&);
+
+void Init_PyHostFrameUD(py::module&);
+void Init_PyHostFrameRotator(py::module&);
+void Init_PyHostMemPool(py::module&);
+void Init_PyHostBuffer(py::module&);
+void Init_PyShmFrameRing(py::module&);
+void Init_PyPipeline(py::module&);
+void Init_PyTaskStats(py::module&);
+void Init_PyTracer(py::module&);
+void Init_PyMediaGenerator(py::module&);
+void Init_PyMemStats(py::module&);
+
 void Init_PyNvJpegEncoder(py::module& m);
 
 void Init_PySurfaceRotator(py::module& m);
@@ -105,11 +122,79 @@ PYBIND11_MODULE(_python_vali, m) {
         return ss.str();
       });
 
+  py::enum_<AVFrameSideDataType>(m, "SideDataType")
+      .value("MOTION_VECTORS", AV_FRAME_DATA_MOTION_VECTORS,
+             "Motion vectors, array of AVMotionVector.")
+      .value("DISPLAYMATRIX", AV_FRAME_DATA_DISPLAYMATRIX,
+             "3x3 display transformation matrix.")
+      .value("SEI_UNREGISTERED", AV_FRAME_DATA_SEI_UNREGISTERED,
+             "User data unregistered SEI message: 16 bytes UUID + payload.")
+      .value("A53_CC", AV_FRAME_DATA_A53_CC, "ATSC A53 closed captions.")
+      .value("MASTERING_DISPLAY_METADATA",
+             AV_FRAME_DATA_MASTERING_DISPLAY_METADATA,
+             "HDR mastering display metadata.")
+      .value("CONTENT_LIGHT_LEVEL", AV_FRAME_DATA_CONTENT_LIGHT_LEVEL,
+             "HDR content light level.")
+      .value("REGIONS_OF_INTEREST", AV_FRAME_DATA_REGIONS_OF_INTEREST,
+             "Regions of interest, array of AVRegionOfInterest.")
+      .value("VIDEO_ENC_PARAMS", AV_FRAME_DATA_VIDEO_ENC_PARAMS,
+             "Encoding parameters such as QP tables.")
+      .value("S12M_TIMECODE", AV_FRAME_DATA_S12M_TIMECODE,
+             "SMPTE 12-1 timecodes.");
+
+  py::class_<SideData, std::shared_ptr<SideData>>(
+      m, "SideData", py::buffer_protocol(),
+      "This class stores single side data entry of decoded frame. "
+      "It supports buffer protocol and shares memory with decoder.")
+      .def_property_readonly(
+          "Type", [](SideData& self) { return self.entry.type; },
+          "Side data type.")
+      .def_readonly("Pts", &SideData::pts,
+                    "Presentation timestamp of frame side data belongs to.")
+      .def("__len__", [](SideData& self) { return self.entry.size; })
+      .def_buffer([](SideData& self) -> py::buffer_info {
+        return py::buffer_info((void*)self.entry.data, 1U,
+                               py::format_descriptor<uint8_t>::format(), 1U,
+                               {(py::ssize_t)self.entry.size}, {1},
+                               /*readonly=*/true);
+      });
+
+  py::class_<MotionSummary, std::shared_ptr<MotionSummary>>(
+      m, "MotionSummary",
+      "This class stores motion statistics of a single frame.")
+      .def(py::init<>())
+      .def_readonly("num_vectors", &MotionSummary::num_vectors,
+                    "Number of motion vectors.")
+      .def_readonly("mean_magnitude", &MotionSummary::mean_magnitude,
+                    "Mean motion vector length in pixels.")
+      .def_readonly("max_magnitude", &MotionSummary::max_magnitude,
+                    "Max motion vector length in pixels.")
+      .def_readonly("histogram", &MotionSummary::histogram,
+                    "Number of motion vectors per length bin. Last bin also "
+                    "counts vectors which are longer.")
+      .def("__repr__", [](shared_ptr<MotionSummary> self) {
+        std::stringstream ss;
+        ss << "num_vectors:     " << self->num_vectors << "\n";
+        ss << "mean_magnitude:  " << self->mean_magnitude << "\n";
+        ss << "max_magnitude:   " << self->max_magnitude << "\n";
+        ss << "histogram:       [";
+        for (auto i = 0U; i < self->histogram.size(); i++) {
+          ss << (i ? ", " : "") << self->histogram[i];
+        }
+        ss << "]\n";
+        return ss.str();
+      });
+
   PYBIND11_NUMPY_DTYPE_EX(MotionVector, source, "source", w, "w", h, "h", src_x,
                           "src_x", src_y, "src_y", dst_x, "dst_x", dst_y,
                           "dst_y", motion_x, "motion_x", motion_y, "motion_y",
                           motion_scale, "motion_scale");
 
+  // Layout of libavutil motion vectors, used to export them without copy.
+  PYBIND11_NUMPY_DTYPE(AVMotionVector, source, w, h, src_x, src_y, dst_x,
+                       dst_y, flags, motion_x, motion_y, motion_scale);
+  m.attr("MotionVectorDtype") = py::dtype::of<AVMotionVector>();
+
   py::enum_<Pixel_Format>(m, "PixelFormat")
       .value("Y", Pixel_Format::Y, "Grayscale.")
       .value("RGB", Pixel_Format::RGB, "Interleaved 8 bit RGB.")
@@ -167,6 +252,9 @@ PYBIND11_MODULE(_python_vali, m) {
   py::enum_<DecodeMode>(m, "DecodeMode")
       .value("KEY_FRAMES", DecodeMode::KEY_FRAMES, "Decode key frames only.")
       .value("ALL_FRAMES", DecodeMode::ALL_FRAMES, "Decode everything.")
+      .value("SIDE_DATA_ONLY", DecodeMode::SIDE_DATA_ONLY,
+             "Decode everything, but output side data only. Frame pixels "
+             "aren't copied, deblocking is skipped.")
       .export_values();
 
   py::enum_<ColorRange>(m, "ColorRange")
@@ -401,6 +489,15 @@ PYBIND11_MODULE(_python_vali, m) {
          :rtype: int
      )pbdoc");
 
+  m.def("GetNumNumaNodes", &Numa::NumNodes, R"pbdoc(
+         Get the number of NUMA nodes in the system.
+
+         Systems without NUMA support are reported as single node.
+
+         :return: Number of NUMA nodes
+         :rtype: int
+     )pbdoc");
+
   m.def("GetNvencParams", &GetNvencInitParams, R"pbdoc(
          Get the list of parameters that can be used to initialize PyNvEncoder.
 
@@ -435,6 +532,32 @@ PYBIND11_MODULE(_python_vali, m) {
 
   Init_PyFrameConverter(m);
 
+  Init_PyFrameLetterbox(m);
+
+  Init_PyFrameCropper(m);
+
+  Init_PyHostFrameConverter(m);
+
+  Init_PyHostFrameUD(m);
+
+  Init_PyHostFrameRotator(m);
+
+  Init_PyHostMemPool(m);
+
+  Init_PyHostBuffer(m);
+
+  Init_PyShmFrameRing(m);
+
+  Init_PyPipeline(m);
+
+  Init_PyTaskStats(m);
+
+  Init_PyTracer(m);
+
+  Init_PyMediaGenerator(m);
+
+  Init_PyMemStats(m);
+
   Init_PyNvJpegEncoder(m);
 
   Init_PySurfaceRotator(m);
@@ -451,6 +574,7 @@ PYBIND11_MODULE(_python_vali, m) {
            :toctree: _generate
 
            GetNumGpus
+           GetNumNumaNodes
            GetNvencParams
            SetFFMpegLogLevel
            PySurfaceResizer
@@ -467,6 +591,34 @@ PYBIND11_MODULE(_python_vali, m) {
            CudaStreamEvent
            PySurfaceRotator
            PySurfaceUD
+           PyFrameLetterbox
+           PyFrameCropper
+           PyHostFrameConverter
+           PyHostFrameUD
+           PyHostFrameRotator
+           HostMemPoolStats
+           GetHostMemPoolStats
+           SetHostMemPoolHighWaterMark
+           SetHostMemPoolHugePageThreshold
+           TrimHostMemPool
+           HostBuffer
+           ShmFrameRing
+           PyPipeline
+           GetTaskStats
+           ResetTaskStats
+           TraceBackend
+           SetTraceBackend
+           GetTraceBackend
+           SetTraceTag
+           DumpTrace
+           DecoderStats
+           MediaParams
+           ResolutionSwitch
+           GenerateMedia
+           GetSyntheticMedia
+           GetMemoryStats
+           ResetMemoryStatsPeaks
+           SetMemoryStatsLogInterval
 
     )pbdoc";
 }
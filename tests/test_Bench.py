@@ -0,0 +1,135 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import python_vali.bench as bench
+import unittest
+import tempfile
+import json
+
+
+class TestBench(unittest.TestCase):
+    def setUp(self):
+        self.cache = tempfile.TemporaryDirectory()
+
+    def tearDown(self):
+        self.cache.cleanup()
+
+    @staticmethod
+    def make_report(fps: float, latency: float) -> dict:
+        return {"scenarios": [
+            {"name": "decode", "fps": fps, "latency_p50_ms": latency}]}
+
+    def test_compare(self):
+        """
+        This test checks that compare fails only when regression is beyond
+        threshold.
+        """
+        base = self.make_report(100.0, 10.0)
+        self.assertEqual(
+            bench.compare_reports(base, self.make_report(95.0, 10.5), 0.1), 0)
+        self.assertEqual(
+            bench.compare_reports(base, self.make_report(120.0, 5.0), 0.1), 0)
+        self.assertEqual(
+            bench.compare_reports(base, self.make_report(80.0, 10.0), 0.1), 1)
+        self.assertEqual(
+            bench.compare_reports(base, self.make_report(100.0, 12.0), 0.1), 1)
+
+    def test_compare_broken(self):
+        """
+        This test checks that compare fails when scenario has failed or is
+        missing from current report.
+        """
+        base = self.make_report(100.0, 10.0)
+        base["scenarios"].append(
+            {"name": "seek", "fps": 50.0, "latency_p50_ms": 20.0})
+
+        # Scenario is gone.
+        self.assertEqual(
+            bench.compare_reports(base, self.make_report(100.0, 10.0), 0.1),
+            1)
+
+        # Scenario has failed.
+        cur = self.make_report(100.0, 10.0)
+        cur["failed"] = {"seek": "decoder crashed"}
+        self.assertEqual(bench.compare_reports(base, cur, 0.1), 1)
+
+        cur = self.make_report(100.0, 10.0)
+        cur["scenarios"].append(
+            {"name": "seek", "fps": 50.0, "latency_p50_ms": 20.0})
+        self.assertEqual(bench.compare_reports(base, cur, 0.1), 0)
+
+    def test_compare_cli(self):
+        """
+        This test checks exit code of compare command.
+        """
+        with tempfile.TemporaryDirectory() as tmp:
+            base = os.path.join(tmp, "base.json")
+            cur = os.path.join(tmp, "cur.json")
+            with open(base, "w") as f:
+                json.dump(self.make_report(100.0, 10.0), f)
+            with open(cur, "w") as f:
+                json.dump(self.make_report(50.0, 10.0), f)
+
+            self.assertEqual(bench.main(["compare", base, base]), 0)
+            self.assertEqual(bench.main(["compare", base, cur]), 1)
+
+    def test_run_scenario(self):
+        """
+        This test checks that scenario reports all metrics.
+        """
+        res = bench.run_scenario(
+            "decode_cpu_720p_x2", 2, self.cache.name, warmup=5)
+
+        self.assertEqual(res["name"], "decode_cpu_720p_x2")
+        num_frames = bench.CLIPS["720p"]["num_frames"]
+        self.assertEqual(res["frames"], 2 * (num_frames - 5))
+        self.assertGreater(res["fps"], 0.0)
+        self.assertGreater(res["cpu_time_s"], 0.0)
+        self.assertLessEqual(res["latency_p50_ms"], res["latency_p99_ms"])
+        if os.name != "nt":
+            self.assertGreater(res["peak_rss_mb"], 0.0)
+
+
+if __name__ == "__main__":
+    unittest.main()
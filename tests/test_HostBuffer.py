@@ -0,0 +1,227 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import numpy as np
+import unittest
+import test_common as tc
+
+
+class TestHostBuffer(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+
+    def test_shape(self):
+        """
+        This test checks exported tensor shape and dtype.
+        """
+        width, height = 64, 32
+        params = [
+            (vali.PixelFormat.Y, (height, width), np.uint8),
+            (vali.PixelFormat.RGB, (height, width, 3), np.uint8),
+            (vali.PixelFormat.RGB_PLANAR, (3, height, width), np.uint8),
+            (vali.PixelFormat.RGB_32F, (height, width, 3), np.float32),
+            (vali.PixelFormat.NV12, (height * 3 // 2, width), np.uint8),
+            (vali.PixelFormat.YUV420, (height * 3 // 2, width), np.uint8),
+            (vali.PixelFormat.P10, (height * 3 // 2, width), np.uint16),
+        ]
+
+        for format, shape, dtype in params:
+            with self.subTest(format=format):
+                buf = vali.HostBuffer(format, width, height)
+                self.assertEqual(tuple(buf.Shape), shape)
+
+                arr = np.asarray(buf)
+                self.assertEqual(arr.shape, shape)
+                self.assertEqual(arr.dtype, dtype)
+                self.assertEqual(arr.nbytes, buf.NumBytes)
+
+                arr = np.from_dlpack(buf)
+                self.assertEqual(arr.shape, shape)
+                self.assertEqual(arr.dtype, dtype)
+
+    def test_odd_size(self):
+        """
+        This test checks that frames with odd size are exported as flat arrays.
+        """
+        buf = vali.HostBuffer(vali.PixelFormat.NV12, 33, 17)
+        arr = np.asarray(buf)
+        self.assertEqual(arr.ndim, 1)
+        self.assertEqual(arr.nbytes, buf.NumBytes)
+
+    def test_unsupported_format(self):
+        """
+        This test checks that unsupported format raises exception.
+        """
+        with self.assertRaises(ValueError):
+            vali.HostBuffer(vali.PixelFormat.UNDEFINED, 64, 32)
+
+    def test_dlpack_device(self):
+        """
+        This test checks that buffer is reported as host memory.
+        """
+        buf = vali.HostBuffer(vali.PixelFormat.Y, 64, 32)
+        self.assertEqual(buf.__dlpack_device__(),
+                         (vali.DLDeviceType.kDLCPU, 0))
+
+    def test_zero_copy(self):
+        """
+        This test checks that exported arrays share memory with buffer.
+        """
+        buf = vali.HostBuffer(vali.PixelFormat.Y, 64, 32)
+        arr_ai = np.asarray(buf)
+        arr_dl = np.from_dlpack(buf)
+
+        arr_ai[:] = 42
+        self.assertTrue(np.all(arr_dl == 42))
+        self.assertTrue(np.shares_memory(arr_ai, arr_dl))
+
+    def test_lifetime(self):
+        """
+        This test checks that DLPack tensor keeps memory alive.
+        """
+        buf = vali.HostBuffer(vali.PixelFormat.Y, 64, 32)
+        np.asarray(buf)[:] = 7
+        arr = np.from_dlpack(buf)
+        del buf
+
+        self.assertTrue(np.all(arr == 7))
+
+    def test_reallocate(self):
+        """
+        This test checks that array interface export keeps memory alive
+        when buffer is reallocated to fit another frame.
+        """
+        gt_info = tc.gt_by_name("basic")
+        py_dec = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+
+        buf = vali.HostBuffer(vali.PixelFormat.Y, 64, 32)
+        arr = np.asarray(buf)
+        arr[:] = 7
+
+        # Decoder reallocates buffer, old memory must not go back to pool.
+        success, info = py_dec.DecodeSingleFrame(buf)
+        self.assertTrue(success, info)
+        self.assertNotEqual(buf.Width, 64)
+
+        for _ in range(4):
+            other = vali.HostBuffer(vali.PixelFormat.Y, 64, 32)
+            np.asarray(other)[:] = 0
+        self.assertTrue(np.all(arr == 7))
+
+        del buf
+        self.assertTrue(np.all(arr == 7))
+
+    def test_numa_node(self):
+        """
+        This test checks that buffer remembers NUMA node and rejects
+        invalid ones.
+        """
+        buf = vali.HostBuffer(vali.PixelFormat.Y, 64, 32)
+        self.assertEqual(buf.NumaNode, -1)
+
+        buf = vali.HostBuffer(vali.PixelFormat.Y, 64, 32, numa_node=0)
+        self.assertEqual(buf.NumaNode, 0)
+        np.asarray(buf)[:] = 7
+        self.assertTrue(np.all(np.from_dlpack(buf) == 7))
+
+        with self.assertRaises(ValueError):
+            vali.HostBuffer(vali.PixelFormat.Y, 64, 32,
+                            numa_node=vali.GetNumNumaNodes())
+
+    def test_decode(self):
+        """
+        This test checks that frames decoded into buffer match frames
+        decoded into numpy array.
+        """
+        gt_info = tc.gt_by_name("basic")
+        dec_arr = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+        dec_buf = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        for _ in range(10):
+            buf = vali.HostBuffer(vali.PixelFormat.Y, 2, 2)
+            success, info = dec_buf.DecodeSingleFrame(buf)
+            self.assertTrue(success, info)
+            self.assertEqual(buf.Format, dec_buf.Format)
+            self.assertEqual(buf.Width, dec_buf.Width)
+            self.assertEqual(buf.Height, dec_buf.Height)
+
+            success, info = dec_arr.DecodeSingleFrame(frame)
+            self.assertTrue(success, info)
+
+            self.assertTrue(np.array_equal(
+                np.asarray(buf).ravel(), frame.view(np.uint8)))
+
+    def test_convert(self):
+        """
+        This test checks that PyFrameConverter accepts host buffers.
+        """
+        gt_info = tc.gt_by_name("basic")
+        py_dec = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+
+        yuv = vali.HostBuffer(py_dec.Format, py_dec.Width, py_dec.Height)
+        success, info = py_dec.DecodeSingleFrame(yuv)
+        self.assertTrue(success, info)
+
+        cvt = vali.PyFrameConverter(
+            py_dec.Width, py_dec.Height, py_dec.Format, vali.PixelFormat.RGB)
+        cc_ctx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709, vali.ColorRange.MPEG)
+
+        rgb = vali.HostBuffer(vali.PixelFormat.Y, 2, 2)
+        success, info = cvt.Run(yuv, rgb, cc_ctx)
+        self.assertTrue(success, info)
+        self.assertEqual(rgb.Format, vali.PixelFormat.RGB)
+
+        rgb_ref = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = cvt.Run(np.asarray(yuv).ravel(), rgb_ref, cc_ctx)
+        self.assertTrue(success, info)
+
+        rgb_arr = np.asarray(rgb)
+        self.assertEqual(rgb_arr.shape, (py_dec.Height, py_dec.Width, 3))
+        self.assertTrue(np.array_equal(rgb_arr.ravel(), rgb_ref))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,186 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+
+import python_vali as vali
+import numpy as np
+import unittest
+import test_common as tc
+
+default_high_water_mark = 1024 * 1024 * 1024
+
+
+def size_class(size: int) -> int:
+    """
+    Reference size class: four classes between neighbour powers of 2.
+    """
+    if size <= 64:
+        return 64
+
+    pow2 = 64
+    while pow2 * 2 < size:
+        pow2 *= 2
+
+    step = max(64, pow2 // 4)
+    return (size + step - 1) // step * step
+
+
+class TestHostMemPool(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+
+    def tearDown(self):
+        vali.SetHostMemPoolHighWaterMark(default_high_water_mark)
+        vali.SetHostMemPoolHugePageThreshold(0)
+
+    @staticmethod
+    def decode(num_frames: int) -> None:
+        gt = tc.gt_by_name("basic")
+        py_dec = vali.PyDecoder(input=gt.uri, opts={}, gpu_id=-1)
+
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        for _ in range(num_frames):
+            success, _ = py_dec.DecodeSingleFrame(frame)
+            if not success:
+                break
+
+    def test_reuse(self):
+        """
+        This test checks that decoded frames memory is reused.
+        """
+        stats_before = vali.GetHostMemPoolStats()
+        self.decode(num_frames=30)
+        stats_after = vali.GetHostMemPoolStats()
+
+        self.assertGreater(stats_after.hits, stats_before.hits)
+        self.assertGreater(stats_after.hit_rate, 0.0)
+        self.assertLessEqual(stats_after.hit_rate, 1.0)
+
+    def test_trim(self):
+        """
+        This test checks that trimmed pool doesn't keep any memory.
+        """
+        self.decode(num_frames=10)
+        vali.TrimHostMemPool()
+
+        stats = vali.GetHostMemPoolStats()
+        self.assertEqual(stats.bytes_cached, 0)
+
+    def test_size_classes(self):
+        """
+        This test checks that sizes just above power of 2 aren't rounded up
+        twice, so buffer capacity and pool size class agree.
+        """
+        for k in range(6, 21):
+            size = 2 ** k + 1
+            pool_before = vali.GetHostMemPoolStats().bytes_in_use
+            buf_before = vali.GetMemoryStats()["buffers"]["live_bytes"]
+
+            buf = vali.HostBuffer(vali.PixelFormat.Y, size, 1)
+            self.assertEqual(buf.NumBytes, size)
+
+            pool_delta = vali.GetHostMemPoolStats().bytes_in_use - pool_before
+            buf_delta = (vali.GetMemoryStats()["buffers"]["live_bytes"] -
+                         buf_before)
+            self.assertEqual(pool_delta, size_class(size), size)
+            self.assertEqual(buf_delta, pool_delta, size)
+            del buf
+
+    @unittest.skipUnless(hasattr(os, "sysconf"), "Page size is unknown")
+    def test_numa_blocks(self):
+        """
+        This test checks that blocks placed on NUMA node take whole pages,
+        so their placement isn't shared with other blocks.
+        """
+        page_size = os.sysconf("SC_PAGE_SIZE")
+        pool_before = vali.GetHostMemPoolStats().bytes_in_use
+        buf_before = vali.GetMemoryStats()["buffers"]["live_bytes"]
+
+        buf = vali.HostBuffer(vali.PixelFormat.Y, 100, 1, numa_node=0)
+        self.assertEqual(buf.NumBytes, 100)
+
+        pool_delta = vali.GetHostMemPoolStats().bytes_in_use - pool_before
+        buf_delta = (vali.GetMemoryStats()["buffers"]["live_bytes"] -
+                     buf_before)
+        self.assertEqual(pool_delta, page_size)
+        self.assertEqual(buf_delta, pool_delta)
+
+        del buf
+        self.assertEqual(vali.GetHostMemPoolStats().bytes_in_use, pool_before)
+
+    def test_huge_pages(self):
+        """
+        This test checks that decoding works with huge pages opted in and
+        that memory is still returned to pool.
+        """
+        vali.SetHostMemPoolHugePageThreshold(2 * 1024 * 1024)
+        stats_before = vali.GetHostMemPoolStats()
+        self.decode(num_frames=10)
+        stats_after = vali.GetHostMemPoolStats()
+        self.assertEqual(stats_after.bytes_in_use, stats_before.bytes_in_use)
+
+    def test_high_water_mark(self):
+        """
+        This test checks that pool doesn't cache more than allowed.
+        """
+        high_water_mark = 1024 * 1024
+        vali.SetHostMemPoolHighWaterMark(high_water_mark)
+        self.decode(num_frames=10)
+
+        stats = vali.GetHostMemPoolStats()
+        self.assertEqual(stats.high_water_mark, high_water_mark)
+        self.assertLessEqual(stats.bytes_cached, high_water_mark)
+
+    def test_no_leaks(self):
+        """
+        This test checks that decoder returns all memory to pool.
+        """
+        stats_before = vali.GetHostMemPoolStats()
+        self.decode(num_frames=30)
+        stats_after = vali.GetHostMemPoolStats()
+
+        self.assertEqual(stats_after.bytes_in_use, stats_before.bytes_in_use)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,201 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import numpy as np
+import unittest
+import tempfile
+from parameterized import parameterized
+
+
+class TestMediaGenerator(unittest.TestCase):
+    def setUp(self):
+        self.cache = tempfile.TemporaryDirectory()
+
+    def tearDown(self):
+        self.cache.cleanup()
+
+    @staticmethod
+    def make_params(**kwargs) -> vali.MediaParams:
+        params = vali.MediaParams()
+        params.width = 320
+        params.height = 240
+        params.num_frames = 30
+        for key, value in kwargs.items():
+            setattr(params, key, value)
+        return params
+
+    def decode_all(self, path: str) -> list:
+        """
+        Decodes clip on CPU, returns list of (info, pts, width, height)
+        """
+        py_dec = vali.PyDecoder(path, {}, gpu_id=-1)
+        frames = []
+        while True:
+            frame = np.ndarray(shape=(0), dtype=np.uint8)
+            pkt_data = vali.PacketData()
+            success, info = py_dec.DecodeSingleFrame(frame, pkt_data)
+            if not success:
+                break
+            frames.append((info, pkt_data.pts, py_dec.Width, py_dec.Height))
+        return frames
+
+    @parameterized.expand([
+        ["mpeg4", "mpeg4", 0, 8],
+        ["mpeg4_bframes", "mpeg4", 2, 8],
+        ["mjpeg", "mjpeg", 0, 8],
+        ["ffv1_10bit", "ffv1", 0, 10],
+    ])
+    def test_decode(self, case_name: str, codec: str, b_frames: int,
+                    bit_depth: int):
+        """
+        This test checks that every generated frame is decoded with right
+        size and in presentation order.
+        """
+        params = self.make_params(
+            codec=codec, b_frames=b_frames, bit_depth=bit_depth)
+        path = vali.GetSyntheticMedia(params, self.cache.name)
+
+        frames = self.decode_all(path)
+        self.assertEqual(len(frames), params.num_frames)
+        for info, pts, width, height in frames:
+            self.assertEqual(width, params.width)
+            self.assertEqual(height, params.height)
+
+        all_pts = [pts for _, pts, _, _ in frames]
+        self.assertEqual(all_pts, sorted(all_pts))
+
+        if bit_depth > 8:
+            py_dec = vali.PyDecoder(path, {}, gpu_id=-1)
+            self.assertEqual(py_dec.Format, vali.PixelFormat.YUV420_10bit)
+
+    def test_vfr(self):
+        """
+        This test checks that frame durations follow VFR pattern.
+        """
+        params = self.make_params(vfr_pattern=[1, 2, 3])
+        path = vali.GetSyntheticMedia(params, self.cache.name)
+
+        py_dec = vali.PyDecoder(path, {}, gpu_id=-1)
+        frames = self.decode_all(path)
+        self.assertEqual(len(frames), params.num_frames)
+
+        for i in range(1, len(frames)):
+            duration = (frames[i][1] - frames[i - 1][1]) * py_dec.Timebase
+            expected = params.vfr_pattern[(i - 1) % 3] / params.fps
+            self.assertAlmostEqual(duration, expected, delta=0.002)
+
+    def test_resolution_switch(self):
+        """
+        This test checks that decoder reports resolution change at switch.
+        """
+        params = self.make_params(
+            res_switches=[vali.ResolutionSwitch(15, 640, 480)])
+        path = vali.GetSyntheticMedia(params, self.cache.name)
+
+        width, height = params.width, params.height
+        num_res_changes = 0
+        for info, _, dec_width, dec_height in self.decode_all(path):
+            if info == vali.TaskExecInfo.RES_CHANGE:
+                num_res_changes += 1
+                width, height = 640, 480
+            self.assertEqual(dec_width, width)
+            self.assertEqual(dec_height, height)
+
+        self.assertEqual(num_res_changes, 1)
+
+    @parameterized.expand([
+        ["audio", "mkv", 2, 0],
+        ["data", "ts", 0, 1],
+        ["audio_data", "ts", 1, 2],
+    ])
+    def test_tracks(self, case_name: str, container: str, num_audio: int,
+                    num_data: int):
+        """
+        This test checks that extra tracks are muxed and don't break video.
+        """
+        params = self.make_params(
+            container=container,
+            num_audio_tracks=num_audio,
+            num_data_tracks=num_data)
+        path = vali.GetSyntheticMedia(params, self.cache.name)
+
+        py_dec = vali.PyDecoder(path, {}, gpu_id=-1)
+        self.assertEqual(py_dec.NumStreams, 1 + num_audio + num_data)
+        self.assertEqual(len(self.decode_all(path)), params.num_frames)
+
+    def test_invalid_params(self):
+        """
+        This test checks that unsupported combinations raise ValueError.
+        """
+        cases = [
+            self.make_params(width=321),
+            self.make_params(codec="mjpeg", b_frames=2),
+            self.make_params(codec="mpeg4", bit_depth=10),
+            self.make_params(num_data_tracks=1),
+            self.make_params(
+                res_switches=[vali.ResolutionSwitch(100, 640, 480)]),
+        ]
+
+        for params in cases:
+            with self.assertRaises(ValueError):
+                vali.GetSyntheticMedia(params, self.cache.name)
+
+    def test_cache(self):
+        """
+        This test checks that clip is generated once per parameters set.
+        """
+        params = self.make_params()
+        path = vali.GetSyntheticMedia(params, self.cache.name)
+        mtime = os.path.getmtime(path)
+
+        self.assertEqual(vali.GetSyntheticMedia(params, self.cache.name), path)
+        self.assertEqual(os.path.getmtime(path), mtime)
+
+        params.gop_size = 10
+        self.assertNotEqual(
+            vali.GetSyntheticMedia(params, self.cache.name), path)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,128 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+
+import python_vali as vali
+import numpy as np
+import unittest
+import test_common as tc
+
+
+class TestMemStats(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+
+    @staticmethod
+    def decode(num_frames: int) -> None:
+        gt = tc.gt_by_name("basic")
+        py_dec = vali.PyDecoder(input=gt.uri, opts={}, gpu_id=-1)
+
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        for _ in range(num_frames):
+            success, _ = py_dec.DecodeSingleFrame(frame)
+            if not success:
+                break
+
+    def test_components(self):
+        """
+        This test checks that all components are reported.
+        """
+        stats = vali.GetMemoryStats()
+        for name in ["packet_queue", "decoder_frames", "buffers",
+                     "side_data", "encoder_output", "swscale",
+                     "host_frames"]:
+            self.assertIn(name, stats)
+            for key in ["live_bytes", "live_allocs", "peak_bytes",
+                        "total_allocs"]:
+                self.assertIn(key, stats[name])
+
+    def test_decode(self):
+        """
+        This test checks that decoder packets and frames are accounted.
+        """
+        stats_before = vali.GetMemoryStats()
+        self.decode(num_frames=30)
+        stats_after = vali.GetMemoryStats()
+
+        for name in ["packet_queue", "decoder_frames"]:
+            self.assertGreater(stats_after[name]["total_allocs"],
+                               stats_before[name]["total_allocs"])
+            self.assertGreater(stats_after[name]["peak_bytes"], 0)
+
+    def test_no_leaks(self):
+        """
+        This test checks that decoder memory is released when decoder is
+        gone.
+        """
+        stats_before = vali.GetMemoryStats()
+        self.decode(num_frames=30)
+        stats_after = vali.GetMemoryStats()
+
+        for name in ["packet_queue", "decoder_frames", "buffers",
+                     "side_data"]:
+            self.assertEqual(stats_after[name]["live_bytes"],
+                             stats_before[name]["live_bytes"])
+            self.assertEqual(stats_after[name]["live_allocs"],
+                             stats_before[name]["live_allocs"])
+
+    def test_reset_peaks(self):
+        """
+        This test checks that peaks are set to live values after reset.
+        """
+        self.decode(num_frames=30)
+        vali.ResetMemoryStatsPeaks()
+
+        for name, stats in vali.GetMemoryStats().items():
+            self.assertEqual(stats["peak_bytes"], stats["live_bytes"], name)
+
+    def test_log_interval(self):
+        """
+        This test checks that logging can be started and stopped.
+        """
+        vali.SetMemoryStatsLogInterval(0.05)
+        self.decode(num_frames=10)
+        vali.SetMemoryStatsLogInterval(0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -46,6 +46,7 @@ if os.name == "nt":
 import python_vali as vali
 import numpy as np
 import unittest
+import asyncio
 import json
 import test_common as tc
 import logging
@@ -837,6 +838,189 @@ class TestDecoder(unittest.TestCase):
         self.assertNotEqual(first_mv.source, 0)
         self.assertNotEqual(first_mv.motion_scale, 0)
 
+    def test_get_motion_vectors_array_cpu(self):
+        """
+        This test checks that motion vectors exported as structured array
+        match ones exported as list of objects.
+        """
+        py_dec = vali.PyDecoder(
+            self.gt_info.uri, {"flags2": "+export_mvs"}, gpu_id=-1)
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+
+        success, _ = py_dec.DecodeSingleFrame(frame)
+        self.assertTrue(success)
+        self.assertEqual(py_dec.MotionVectorsArray.size, 0)
+
+        success, _ = py_dec.DecodeSingleFrame(frame)
+        self.assertTrue(success)
+
+        mv_list = py_dec.MotionVectors
+        mv_arr = py_dec.MotionVectorsArray
+        self.assertEqual(mv_arr.dtype, vali.MotionVectorDtype)
+        self.assertEqual(mv_arr.size, len(mv_list))
+        self.assertFalse(mv_arr.flags.writeable)
+
+        for mv, ref in zip(mv_arr, mv_list):
+            for field in ["source", "w", "h", "src_x", "src_y", "dst_x",
+                          "dst_y", "motion_x", "motion_y", "motion_scale"]:
+                self.assertEqual(mv[field], getattr(ref, field))
+
+        # Array shall stay valid after next frame is decoded.
+        mv_copy = mv_arr.copy()
+        success, _ = py_dec.DecodeSingleFrame(frame)
+        self.assertTrue(success)
+        self.assertTrue(np.array_equal(mv_arr, mv_copy))
+
+    def test_decode_motion_vectors_cpu(self):
+        """
+        This test checks that batch motion vectors export matches
+        frame by frame export.
+        """
+        opts = {"flags2": "+export_mvs"}
+        num_frames = 8
+
+        ref_dec = vali.PyDecoder(self.gt_info.uri, opts, gpu_id=-1)
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        ref_mvs = []
+        for _ in range(num_frames):
+            success, _ = ref_dec.DecodeSingleFrame(frame)
+            self.assertTrue(success)
+            ref_mvs.append(ref_dec.MotionVectorsArray)
+
+        py_dec = vali.PyDecoder(self.gt_info.uri, opts, gpu_id=-1)
+        total = sum(mv.size for mv in ref_mvs)
+        mvs = np.zeros(total, dtype=vali.MotionVectorDtype)
+        counts = np.zeros(num_frames, dtype=np.int32)
+
+        res, info = py_dec.DecodeMotionVectors(mvs, counts)
+        self.assertEqual(res, num_frames, info)
+        self.assertEqual(info, vali.TaskExecInfo.SUCCESS)
+        self.assertEqual(counts.tolist(), [mv.size for mv in ref_mvs])
+        self.assertTrue(np.array_equal(mvs, np.concatenate(ref_mvs)))
+
+        # Too small output array shall be reported.
+        mvs = np.zeros(1, dtype=vali.MotionVectorDtype)
+        res, info = py_dec.DecodeMotionVectors(mvs, counts)
+        self.assertEqual(info, vali.TaskExecInfo.SRC_DST_SIZE_MISMATCH)
+
+        # Wrong dtype shall be rejected.
+        with self.assertRaises(TypeError):
+            py_dec.DecodeMotionVectors(np.zeros(16, np.int32), counts)
+
+    def test_side_data_only_cpu(self):
+        """
+        This test checks that side data only mode keeps motion vectors
+        and doesn't touch output frame.
+        """
+        opts = {"flags2": "+export_mvs"}
+        ref_dec = vali.PyDecoder(self.gt_info.uri, opts, gpu_id=-1)
+        py_dec = vali.PyDecoder(self.gt_info.uri, opts, gpu_id=-1)
+        py_dec.SetMode(vali.DecodeMode.SIDE_DATA_ONLY)
+        self.assertEqual(py_dec.Mode, vali.DecodeMode.SIDE_DATA_ONLY)
+
+        ref_frame = np.ndarray(shape=(0), dtype=np.uint8)
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        for _ in range(10):
+            success, info = ref_dec.DecodeSingleFrame(ref_frame)
+            self.assertTrue(success, info)
+
+            success, info = py_dec.DecodeSingleFrame(frame)
+            self.assertTrue(success, info)
+            self.assertEqual(frame.size, 0)
+
+            self.assertTrue(np.array_equal(py_dec.MotionVectorsArray,
+                                           ref_dec.MotionVectorsArray))
+
+        # Reference frames are intact, so pixels are exact after switch.
+        py_dec.SetMode(vali.DecodeMode.ALL_FRAMES)
+        for _ in range(5):
+            success, info = ref_dec.DecodeSingleFrame(ref_frame)
+            self.assertTrue(success, info)
+
+            success, info = py_dec.DecodeSingleFrame(frame)
+            self.assertTrue(success, info)
+            self.assertTrue(np.array_equal(frame, ref_frame))
+
+    def test_motion_summary_cpu(self):
+        """
+        This test checks motion statistics against ones computed in numpy.
+        """
+        py_dec = vali.PyDecoder(
+            self.gt_info.uri, {"flags2": "+export_mvs"}, gpu_id=-1)
+        py_dec.SetMode(vali.DecodeMode.SIDE_DATA_ONLY)
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+
+        success, _ = py_dec.DecodeSingleFrame(frame)
+        self.assertTrue(success)
+        summary = py_dec.GetMotionSummary(num_bins=4)
+        self.assertEqual(summary.num_vectors, 0)
+        self.assertEqual(summary.histogram, [0, 0, 0, 0])
+
+        success, _ = py_dec.DecodeSingleFrame(frame)
+        self.assertTrue(success)
+        summary = py_dec.GetMotionSummary(num_bins=8, bin_width=0.5)
+
+        mvs = py_dec.MotionVectorsArray
+        scale = np.maximum(mvs["motion_scale"], 1).astype(np.float32)
+        mag = np.hypot(mvs["motion_x"], mvs["motion_y"]) / scale
+        hist = np.minimum((mag / 0.5).astype(np.int64), 7)
+
+        self.assertEqual(summary.num_vectors, mvs.size)
+        self.assertAlmostEqual(summary.mean_magnitude, mag.mean(), places=3)
+        self.assertAlmostEqual(summary.max_magnitude, mag.max(), places=3)
+        self.assertEqual(summary.histogram,
+                         np.bincount(hist, minlength=8).tolist())
+
+        with self.assertRaises(ValueError):
+            py_dec.GetMotionSummary(num_bins=0)
+
+    def test_side_data_cpu(self):
+        """
+        This test checks that only selected side data types are saved and
+        that side data history is kept.
+        """
+        history = 4
+        py_dec = vali.PyDecoder(
+            self.gt_info.uri, {"flags2": "+export_mvs"}, gpu_id=-1)
+        py_dec.SetSideDataTypes([vali.SideDataType.MOTION_VECTORS], history)
+
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        ref_mvs = []
+        pkt_data = vali.PacketData()
+        for _ in range(history + 1):
+            success, info = py_dec.DecodeSingleFrame(frame, pkt_data)
+            self.assertTrue(success, info)
+            ref_mvs.append((pkt_data.pts, py_dec.MotionVectorsArray))
+
+        for frames_back in range(history):
+            pts, mvs = ref_mvs[-1 - frames_back]
+            side_data = py_dec.GetSideData(frames_back)
+            if not mvs.size:
+                self.assertEqual(len(side_data), 0)
+                continue
+
+            self.assertEqual(len(side_data), 1)
+            sd = side_data[0]
+            self.assertEqual(sd.Type, vali.SideDataType.MOTION_VECTORS)
+            self.assertEqual(sd.Pts, pts)
+            self.assertEqual(len(sd), mvs.nbytes)
+            self.assertEqual(bytes(sd), mvs.tobytes())
+
+            arr = np.asarray(sd)
+            self.assertEqual(arr.dtype, np.uint8)
+            self.assertFalse(arr.flags.writeable)
+
+        with self.assertRaises(IndexError):
+            py_dec.GetSideData(history)
+
+        # Motion vectors aren't saved if not selected.
+        py_dec.SetSideDataTypes([vali.SideDataType.SEI_UNREGISTERED])
+        success, info = py_dec.DecodeSingleFrame(frame)
+        self.assertTrue(success, info)
+        self.assertEqual(py_dec.MotionVectorsArray.size, 0)
+        for sd in py_dec.GetSideData():
+            self.assertEqual(sd.Type, vali.SideDataType.SEI_UNREGISTERED)
+
     def test_resolution_change_gpu(self):
         with open("gt_files.json") as f:
             gt_info = tc.GroundTruth(**json.load(f)["res_change"])
@@ -904,6 +1088,48 @@ class TestDecoder(unittest.TestCase):
 
         self.assertEqual(dec_frame, gt_info.num_frames)
 
+    def test_numa_placement_cpu(self):
+        """
+        This test checks that NUMA placement options don't change decoded
+        frames and aren't passed to libavcodec.
+        """
+        num_nodes = vali.GetNumNumaNodes()
+        self.assertGreaterEqual(num_nodes, 1)
+
+        ref_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        self.assertEqual(ref_dec.NumaNode, -1)
+
+        has_affinity = hasattr(os, "sched_getaffinity")
+        affinity = os.sched_getaffinity(0) if has_affinity else None
+
+        opts = {"numa_node": "auto", "cpu_set": "0"}
+        py_dec = vali.PyDecoder(self.gt_info.uri, opts, gpu_id=-1)
+        self.assertTrue(0 <= py_dec.NumaNode < num_nodes)
+
+        for _ in range(10):
+            ref = np.ndarray(shape=(0), dtype=np.uint8)
+            success, info = ref_dec.DecodeSingleFrame(ref)
+            self.assertTrue(success, info)
+
+            frame = np.ndarray(shape=(0), dtype=np.uint8)
+            success, info = py_dec.DecodeSingleFrame(frame)
+            self.assertTrue(success, info)
+            self.assertTrue(np.array_equal(ref, frame))
+
+        # Only libavcodec worker threads are pinned, caller is left alone.
+        if has_affinity:
+            self.assertEqual(os.sched_getaffinity(0), affinity)
+
+        with self.assertRaises(ValueError):
+            vali.PyDecoder(self.gt_info.uri, {"numa_node": str(num_nodes)},
+                           gpu_id=-1)
+
+        # Malformed values are reported along with option name.
+        for key, value in [("numa_node", "first"), ("numa_node", "0x"),
+                           ("cpu_set", "0-a")]:
+            with self.assertRaisesRegex(ValueError, key):
+                vali.PyDecoder(self.gt_info.uri, {key: value}, gpu_id=-1)
+
     @parameterized.expand(tc.get_devices())
     def test_invalid_url(self, device_name: str, device_id: int):
         """
@@ -1053,6 +1279,134 @@ class TestDecoder(unittest.TestCase):
         py_dec.SetMode(vali.DecodeMode.ALL_FRAMES)
         self.assertEqual(py_dec.Mode, vali.DecodeMode.ALL_FRAMES)
 
+    def test_stats_cpu(self):
+        """
+        This test checks decoder counters after continuous decode and seek.
+        """
+        gt_info = tc.gt_by_name("basic")
+        py_dec = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1,
+                                pkt_queue_size=8)
+        frame = vali.HostBuffer(py_dec.Format, py_dec.Width, py_dec.Height)
+
+        stats = py_dec.Stats()
+        self.assertEqual(stats.num_frm_recv, 0)
+        self.assertEqual(stats.queue_capacity, 8)
+
+        num_frames = 10
+        for i in range(0, num_frames):
+            success, info = py_dec.DecodeSingleFrame(frame)
+            self.assertTrue(success, info)
+
+        stats = py_dec.Stats()
+        self.assertEqual(stats.num_frm_recv, num_frames)
+        self.assertGreaterEqual(stats.num_pkt_sent, num_frames)
+        self.assertGreaterEqual(stats.num_pkt_read, stats.num_pkt_sent)
+        self.assertGreater(stats.num_bytes_read, 0)
+        self.assertGreater(stats.read_ns, 0)
+        self.assertGreater(stats.decode_ns, 0)
+        self.assertGreater(stats.copy_ns, 0)
+        self.assertLessEqual(stats.queue_size, stats.max_queue_size)
+        self.assertLessEqual(stats.max_queue_size, stats.queue_capacity)
+        self.assertEqual(stats.num_seeks, 0)
+        self.assertEqual(stats.num_frm_seek_discarded, 0)
+
+        # Seek goes back to key frame and decodes frames up to target.
+        seek_frame = gt_info.num_frames // 2
+        success, info = py_dec.DecodeSingleFrame(
+            frame, seek_ctx=vali.SeekContext(seek_frame=seek_frame))
+        self.assertTrue(success, info)
+
+        stats = py_dec.Stats()
+        self.assertEqual(stats.num_seeks, 1)
+        self.assertEqual(
+            stats.num_frm_recv,
+            num_frames + stats.num_frm_seek_discarded + 1)
+
+    def test_decode_async_cpu(self):
+        """
+        This test decodes same file with several decoders driven from one
+        event loop and compares frames to ones decoded synchronously.
+        """
+        gt_info = tc.gt_by_name("basic")
+        num_decoders = 4
+
+        py_dec = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+        gt_frames = []
+        while True:
+            frame = np.ndarray(dtype=np.uint8, shape=())
+            success, _ = py_dec.DecodeSingleFrame(frame)
+            if not success:
+                break
+            gt_frames.append(frame)
+
+        async def decode_all():
+            py_dec = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+            frames = []
+            while True:
+                frame = np.ndarray(dtype=np.uint8, shape=())
+                pkt_data = vali.PacketData()
+                success, info = await py_dec.DecodeSingleFrameAsync(
+                    frame, pkt_data)
+                if not success:
+                    self.assertEqual(info, vali.TaskExecInfo.END_OF_STREAM)
+                    break
+                self.assertNotEqual(pkt_data.pts, vali.NO_PTS)
+                frames.append(frame)
+            return frames
+
+        async def main():
+            return await asyncio.gather(
+                *[decode_all() for i in range(0, num_decoders)])
+
+        for frames in asyncio.run(main()):
+            self.assertEqual(len(frames), gt_info.num_frames)
+            for frame, gt_frame in zip(frames, gt_frames):
+                self.assertTrue(np.array_equal(frame, gt_frame))
+
+    def test_decode_async_cancel_cpu(self):
+        """
+        This test checks that cancelled calls don't break decoder.
+        """
+        gt_info = tc.gt_by_name("basic")
+        py_dec = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+        frame = vali.HostBuffer(py_dec.Format, py_dec.Width, py_dec.Height)
+
+        async def main():
+            # Calls of one decoder are queued, so most of them are skipped.
+            futures = [py_dec.DecodeSingleFrameAsync(frame)
+                       for i in range(0, 8)]
+            for future in futures:
+                future.cancel()
+            await asyncio.gather(*futures, return_exceptions=True)
+            self.assertTrue(all([future.cancelled() for future in futures]))
+
+            # Decoder works after cancel.
+            success, info = await py_dec.DecodeSingleFrameAsync(frame)
+            self.assertTrue(success, info)
+
+            # Running call is stopped.
+            seek_ctx = vali.SeekContext(seek_frame=gt_info.num_frames - 1)
+            with self.assertRaises(asyncio.TimeoutError):
+                await asyncio.wait_for(
+                    py_dec.DecodeSingleFrameAsync(frame, seek_ctx=seek_ctx),
+                    timeout=0)
+
+            success, info = await py_dec.DecodeSingleFrameAsync(frame)
+            self.assertTrue(success or
+                            info == vali.TaskExecInfo.END_OF_STREAM, info)
+
+        asyncio.run(main())
+
+    def test_decode_async_no_loop(self):
+        """
+        This test checks that async decode needs running event loop.
+        """
+        gt_info = tc.gt_by_name("basic")
+        py_dec = vali.PyDecoder(gt_info.uri, {}, gpu_id=-1)
+        frame = np.ndarray(dtype=np.uint8, shape=())
+        with self.assertRaises(RuntimeError):
+            py_dec.DecodeSingleFrameAsync(frame)
+
     def test_cuda_stream(self):
         """Test CUDA stream handling.
         
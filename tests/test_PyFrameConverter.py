@@ -101,6 +101,84 @@ class TestFrameConverter(unittest.TestCase):
                     self.fail(
                         "PSNR score is below threshold: " + str(score))
 
+    def test_run_batch(self):
+        with open("gt_files.json") as f:
+            gt_values = json.load(f)
+            yuvInfo = tc.GroundTruth(**gt_values["basic"])
+            rgbInfo = tc.GroundTruth(**gt_values["basic_rgb"])
+
+        pyDec = vali.PyDecoder(
+            input=yuvInfo.uri,
+            opts={},
+            gpu_id=-1)
+
+        ffCvt = vali.PyFrameConverter(
+            pyDec.Width,
+            pyDec.Height,
+            pyDec.Format,
+            vali.PixelFormat.RGB)
+
+        ccCtx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709,
+            vali.ColorRange.MPEG)
+
+        yuv_frames = []
+        for i in range(0, rgbInfo.num_frames):
+            yuv_frame = np.ndarray(shape=(), dtype=np.uint8)
+            success, _ = pyDec.DecodeSingleFrame(yuv_frame)
+            if not success:
+                self.fail("Fail to decode frame: " + str(_))
+            yuv_frames.append(yuv_frame)
+
+        # List of frames
+        rgb_frames = [np.ndarray(shape=(), dtype=np.uint8)
+                      for _ in yuv_frames]
+        success, infos = ffCvt.RunBatch(yuv_frames, rgb_frames, ccCtx)
+        self.assertTrue(success)
+        self.assertEqual(len(infos), len(yuv_frames))
+
+        # Single (N, ...) tensor
+        rgb_tensor = np.ndarray(shape=(), dtype=np.uint8)
+        success, infos = ffCvt.RunBatch(
+            np.stack(yuv_frames), rgb_tensor, ccCtx)
+        self.assertTrue(success)
+        self.assertEqual(len(infos), len(yuv_frames))
+
+        frame_size = rgbInfo.width * rgbInfo.height * 3
+        rgb_tensor = rgb_tensor.reshape((len(yuv_frames), frame_size))
+        with open(rgbInfo.uri, "rb") as f_in:
+            for i in range(0, rgbInfo.num_frames):
+                rgb_ethalon = np.fromfile(f_in, np.uint8, frame_size)
+                for rgb_frame in [rgb_frames[i], rgb_tensor[i]]:
+                    score = tc.measure_psnr(rgb_ethalon, rgb_frame)
+                    if score < psnr_threshold:
+                        self.fail(
+                            "PSNR score is below threshold: " + str(score))
+
+    def test_run_batch_bad_frame(self):
+        with open("gt_files.json") as f:
+            gt_values = json.load(f)
+            yuvInfo = tc.GroundTruth(**gt_values["basic"])
+
+        ffCvt = vali.PyFrameConverter(
+            yuvInfo.width,
+            yuvInfo.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        ccCtx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709,
+            vali.ColorRange.MPEG)
+
+        frame_size = yuvInfo.width * yuvInfo.height * 3 // 2
+        srcs = [np.zeros(frame_size, np.uint8), np.zeros(10, np.uint8)]
+        dsts = [np.ndarray(shape=(), dtype=np.uint8) for _ in srcs]
+
+        success, infos = ffCvt.RunBatch(srcs, dsts, ccCtx)
+        self.assertFalse(success)
+        self.assertEqual(infos[0], vali.TaskExecInfo.SUCCESS)
+        self.assertEqual(infos[1], vali.TaskExecInfo.INVALID_INPUT)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,182 @@
+#
+# Copyright 2024 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import numpy as np
+import unittest
+import json
+import test_common as tc
+
+# We use 44 (dB) as the measure of similarity.
+# If two images have PSNR higher than 44 (dB) we consider them the same.
+psnr_threshold = 44.0
+
+
+class TestFrameCropper(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+
+        with open("gt_files.json") as f:
+            gt_values = json.load(f)
+            self.yuvInfo = tc.GroundTruth(**gt_values["basic"])
+
+        self.ccCtx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709,
+            vali.ColorRange.MPEG)
+
+        self.rects = [
+            vali.CropRect(0, 0, 64, 32),
+            vali.CropRect(100, 50, 128, 96),
+            vali.CropRect(self.yuvInfo.width - 32,
+                          self.yuvInfo.height - 32, 32, 32),
+        ]
+
+    def decode_frame(self) -> np.ndarray:
+        pyDec = vali.PyDecoder(input=self.yuvInfo.uri, opts={}, gpu_id=-1)
+        yuv_frame = np.ndarray(shape=(), dtype=np.uint8)
+        success, info = pyDec.DecodeSingleFrame(yuv_frame)
+        if not success:
+            self.fail("Fail to decode frame: " + str(info))
+        return yuv_frame
+
+    def convert_full(self, yuv_frame: np.ndarray) -> np.ndarray:
+        ffCvt = vali.PyFrameConverter(
+            self.yuvInfo.width,
+            self.yuvInfo.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        rgb_frame = np.ndarray(shape=(), dtype=np.uint8)
+        success, info = ffCvt.Run(yuv_frame, rgb_frame, self.ccCtx)
+        if not success:
+            self.fail("Fail to convert frame: " + str(info))
+        return rgb_frame.reshape((self.yuvInfo.height, self.yuvInfo.width, 3))
+
+    def test_crops_match_full_frame(self):
+        yuv_frame = self.decode_frame()
+        rgb_frame = self.convert_full(yuv_frame)
+
+        cropper = vali.PyFrameCropper(
+            self.yuvInfo.width,
+            self.yuvInfo.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        crops = [np.ndarray(shape=(), dtype=np.uint8) for _ in self.rects]
+        success, info = cropper.Run(
+            yuv_frame, self.rects, crops, cc_ctx=self.ccCtx)
+        if not success:
+            self.fail("Fail to crop frame: " + str(info))
+
+        for rect, crop in zip(self.rects, crops):
+            self.assertEqual(crop.size, rect.width * rect.height * 3)
+            gt = rgb_frame[rect.y:rect.y + rect.height,
+                           rect.x:rect.x + rect.width]
+            score = tc.measure_psnr(gt.flatten(), crop)
+            self.assertGreaterEqual(score, psnr_threshold)
+
+    def test_odd_origin(self):
+        yuv_frame = self.decode_frame()
+
+        cropper = vali.PyFrameCropper(
+            self.yuvInfo.width,
+            self.yuvInfo.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        # Origin is snapped to even coordinates, crop grows accordingly.
+        crop = np.ndarray(shape=(), dtype=np.uint8)
+        success, info = cropper.Run(
+            yuv_frame, [vali.CropRect(11, 7, 20, 20)], [crop])
+        if not success:
+            self.fail("Fail to crop frame: " + str(info))
+        self.assertEqual(crop.size, 21 * 21 * 3)
+
+    def test_out_of_bounds(self):
+        yuv_frame = self.decode_frame()
+
+        cropper = vali.PyFrameCropper(
+            self.yuvInfo.width,
+            self.yuvInfo.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        crop = np.ndarray(shape=(), dtype=np.uint8)
+        success, info = cropper.Run(
+            yuv_frame,
+            [vali.CropRect(self.yuvInfo.width - 16, 0, 32, 32)],
+            [crop])
+        self.assertFalse(success)
+        self.assertEqual(info, vali.TaskExecInfo.INVALID_INPUT)
+
+    def test_batch(self):
+        yuv_frame = self.decode_frame()
+        dst_w, dst_h = 64, 48
+
+        cropper = vali.PyFrameCropper(
+            self.yuvInfo.width,
+            self.yuvInfo.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        batch = np.ndarray(shape=(), dtype=np.uint8)
+        success, info = cropper.RunBatch(
+            yuv_frame, self.rects, batch, dst_w, dst_h, self.ccCtx)
+        if not success:
+            self.fail("Fail to crop frame: " + str(info))
+
+        self.assertEqual(batch.size, len(self.rects) * dst_w * dst_h * 3)
+        batch = batch.reshape((len(self.rects), dst_h, dst_w, 3))
+
+        crops = [np.ndarray(shape=(), dtype=np.uint8) for _ in self.rects]
+        success, info = cropper.Run(
+            yuv_frame, self.rects, crops, dst_w, dst_h, self.ccCtx)
+        if not success:
+            self.fail("Fail to crop frame: " + str(info))
+
+        for i in range(0, len(self.rects)):
+            self.assertTrue(np.array_equal(batch[i].flatten(), crops[i]))
+
+
+if __name__ == "__main__":
+    unittest.main()
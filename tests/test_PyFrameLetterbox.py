@@ -0,0 +1,189 @@
+#
+# Copyright 2024 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import numpy as np
+import unittest
+import json
+import test_common as tc
+
+# We use 44 (dB) as the measure of similarity.
+# If two images have PSNR higher than 44 (dB) we consider them the same.
+psnr_threshold = 44.0
+
+
+class TestFrameLetterbox(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+
+        self.target_w = 640
+        self.target_h = 640
+
+        with open("gt_files.json") as f:
+            gt_values = json.load(f)
+            self.yuvInfo = tc.GroundTruth(**gt_values["basic"])
+            self.rgbInfo = tc.GroundTruth(**gt_values["basic_rgb"])
+
+    def decode_frame(self) -> tuple[vali.PyDecoder, np.ndarray]:
+        pyDec = vali.PyDecoder(input=self.yuvInfo.uri, opts={}, gpu_id=-1)
+        yuv_frame = np.ndarray(shape=(), dtype=np.uint8)
+        success, info = pyDec.DecodeSingleFrame(yuv_frame)
+        if not success:
+            self.fail("Fail to decode frame: " + str(info))
+        return pyDec, yuv_frame
+
+    def test_params(self):
+        pyDec, _ = self.decode_frame()
+        lbox = vali.PyFrameLetterbox(
+            pyDec.Width, pyDec.Height, pyDec.Format,
+            self.target_w, self.target_h, vali.PixelFormat.RGB)
+
+        params = lbox.Params
+        scale = min(self.target_w / pyDec.Width,
+                    self.target_h / pyDec.Height)
+        self.assertAlmostEqual(params.scale, scale, places=5)
+        self.assertEqual(params.width, round(pyDec.Width * scale))
+        self.assertEqual(params.height, round(pyDec.Height * scale))
+        self.assertEqual(params.offset_x,
+                         (self.target_w - params.width) // 2)
+        self.assertEqual(params.offset_y,
+                         (self.target_h - params.height) // 2)
+
+    def test_padding(self):
+        pyDec, yuv_frame = self.decode_frame()
+        lbox = vali.PyFrameLetterbox(
+            pyDec.Width, pyDec.Height, pyDec.Format,
+            self.target_w, self.target_h, vali.PixelFormat.RGB)
+
+        opts = vali.LetterboxOptions()
+        opts.pad_color = [1, 2, 3]
+
+        rgb_frame = np.ndarray(shape=(), dtype=np.uint8)
+        success, info, params = lbox.Run(yuv_frame, rgb_frame, opts)
+        if not success:
+            self.fail("Fail to letterbox frame: " + str(info))
+
+        self.assertEqual(rgb_frame.size, self.target_w * self.target_h * 3)
+        rgb_frame = rgb_frame.reshape((self.target_h, self.target_w, 3))
+
+        top = rgb_frame[:params.offset_y]
+        bottom = rgb_frame[params.offset_y + params.height:]
+        for pad in [top, bottom]:
+            self.assertTrue(np.all(pad == np.array([1, 2, 3], np.uint8)))
+
+    def test_same_size(self):
+        """
+        Without scaling letterbox output shall match plain color conversion.
+        """
+        pyDec, yuv_frame = self.decode_frame()
+        lbox = vali.PyFrameLetterbox(
+            pyDec.Width, pyDec.Height, pyDec.Format,
+            pyDec.Width, pyDec.Height, vali.PixelFormat.RGB)
+
+        ccCtx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709,
+            vali.ColorRange.MPEG)
+
+        rgb_frame = np.ndarray(shape=(), dtype=np.uint8)
+        success, info, params = lbox.Run(
+            yuv_frame, rgb_frame, cc_ctx=ccCtx)
+        if not success:
+            self.fail("Fail to letterbox frame: " + str(info))
+
+        self.assertEqual(params.offset_x, 0)
+        self.assertEqual(params.offset_y, 0)
+
+        frame_size = self.rgbInfo.width * self.rgbInfo.height * 3
+        with open(self.rgbInfo.uri, "rb") as f_in:
+            rgb_ethalon = np.fromfile(f_in, np.uint8, frame_size)
+            score = tc.measure_psnr(rgb_ethalon, rgb_frame)
+            self.assertGreaterEqual(score, psnr_threshold)
+
+    def test_normalize(self):
+        pyDec, yuv_frame = self.decode_frame()
+        lbox = vali.PyFrameLetterbox(
+            pyDec.Width, pyDec.Height, pyDec.Format,
+            self.target_w, self.target_h, vali.PixelFormat.RGB_32F_PLANAR)
+
+        opts = vali.LetterboxOptions()
+        opts.pad_color = [0, 128, 255]
+        opts.normalize = True
+        opts.mean = [0.485, 0.456, 0.406]
+        opts.std = [0.229, 0.224, 0.225]
+
+        tensor = np.ndarray(shape=(), dtype=np.float32)
+        success, info, params = lbox.Run(yuv_frame, tensor, opts)
+        if not success:
+            self.fail("Fail to letterbox frame: " + str(info))
+
+        self.assertEqual(tensor.dtype, np.float32)
+        self.assertEqual(tensor.size, self.target_w * self.target_h * 3)
+        tensor = tensor.reshape((3, self.target_h, self.target_w))
+
+        for c in range(0, 3):
+            expected = (opts.pad_color[c] / 255.0 - opts.mean[c]) / opts.std[c]
+            self.assertAlmostEqual(float(tensor[c, 0, 0]), expected, places=4)
+
+            picture = tensor[c, params.offset_y:params.offset_y + params.height]
+            lo = (0.0 - opts.mean[c]) / opts.std[c]
+            hi = (1.0 - opts.mean[c]) / opts.std[c]
+            self.assertGreaterEqual(picture.min(), lo - 1e-4)
+            self.assertLessEqual(picture.max(), hi + 1e-4)
+
+    def test_normalize_8bit_output(self):
+        pyDec, yuv_frame = self.decode_frame()
+        lbox = vali.PyFrameLetterbox(
+            pyDec.Width, pyDec.Height, pyDec.Format,
+            self.target_w, self.target_h, vali.PixelFormat.RGB)
+
+        opts = vali.LetterboxOptions()
+        opts.normalize = True
+
+        rgb_frame = np.ndarray(shape=(), dtype=np.uint8)
+        success, info, _ = lbox.Run(yuv_frame, rgb_frame, opts)
+        self.assertFalse(success)
+        self.assertEqual(info, vali.TaskExecInfo.UNSUPPORTED_FMT_CONV_PARAMS)
+
+
+if __name__ == "__main__":
+    unittest.main()
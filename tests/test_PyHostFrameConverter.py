@@ -0,0 +1,241 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import numpy as np
+import unittest
+import test_common as tc
+
+# We use 42 (dB) as the measure of similarity.
+# If two images have PSNR higher than 42 (dB) we consider them the same.
+psnr_threshold = 42.0
+
+
+class TestHostFrameConverter(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+        self.gpu_id = 0
+
+    def test_conversions(self):
+        """
+        This test checks that CPU and GPU converters support same conversions.
+        """
+        self.assertEqual(
+            vali.PyHostFrameConverter.Conversions(),
+            vali.PySurfaceConverter.Conversions())
+
+    def test_unsupported_conversion(self):
+        with self.assertRaises(ValueError):
+            vali.PyHostFrameConverter(
+                64, 64, vali.PixelFormat.Y, vali.PixelFormat.RGB)
+
+    def test_unsupported_params(self):
+        """
+        This test checks that color conversion with unsupported params will
+        return same error as on GPU.
+        """
+        src_info = tc.gt_by_name("basic_nv12")
+        py_cvt = vali.PyHostFrameConverter(
+            src_info.width,
+            src_info.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        # NV12 > RGB NPP conversion doesn't support BT601 + MPEG params.
+        cc_ctx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_601,
+            vali.ColorRange.MPEG)
+
+        frame_src = np.zeros(
+            src_info.width * src_info.height * 3 // 2, dtype=np.uint8)
+        frame_dst = np.ndarray(shape=(0), dtype=np.uint8)
+        success, details = py_cvt.Run(frame_src, frame_dst, cc_ctx)
+        self.assertFalse(success)
+        self.assertEqual(
+            details, vali.TaskExecInfo.UNSUPPORTED_FMT_CONV_PARAMS)
+
+        # Undefined color range is rejected the same way.
+        py_cvt = vali.PyHostFrameConverter(
+            src_info.width,
+            src_info.height,
+            vali.PixelFormat.YUV444,
+            vali.PixelFormat.BGR)
+        cc_ctx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_601,
+            vali.ColorRange.UDEF)
+
+        frame_src = np.zeros(
+            src_info.width * src_info.height * 3, dtype=np.uint8)
+        success, details = py_cvt.Run(frame_src, frame_dst, cc_ctx)
+        self.assertFalse(success)
+        self.assertEqual(
+            details, vali.TaskExecInfo.UNSUPPORTED_FMT_CONV_PARAMS)
+
+    def test_invalid_src(self):
+        py_cvt = vali.PyHostFrameConverter(
+            64, 64, vali.PixelFormat.NV12, vali.PixelFormat.RGB)
+
+        frame_src = np.zeros(10, dtype=np.uint8)
+        frame_dst = np.ndarray(shape=(0), dtype=np.uint8)
+        success, details = py_cvt.Run(frame_src, frame_dst)
+        self.assertFalse(success)
+        self.assertEqual(details, vali.TaskExecInfo.INVALID_INPUT)
+
+    def test_nv12_rgb(self):
+        """
+        This test checks NV12 -> RGB conversion against ground truth.
+        """
+        src_info = tc.gt_by_name("basic_nv12")
+        dst_info = tc.gt_by_name("basic_rgb")
+
+        py_cvt = vali.PyHostFrameConverter(
+            src_info.width,
+            src_info.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        # Use color space and range of original file.
+        cc_ctx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709,
+            vali.ColorRange.MPEG)
+
+        src_size = src_info.width * src_info.height * 3 // 2
+        dst_size = dst_info.width * dst_info.height * 3
+
+        with open(src_info.uri, "rb") as src_fin, \
+                open(dst_info.uri, "rb") as dst_fin:
+            for i in range(0, src_info.num_frames):
+                frame_src = np.fromfile(src_fin, np.uint8, src_size)
+                frame_dst = np.ndarray(shape=(0), dtype=np.uint8)
+
+                success, details = py_cvt.Run(frame_src, frame_dst, cc_ctx)
+                if not success:
+                    self.fail("Fail to convert frame " +
+                              str(i) + ": " + str(details))
+                self.assertEqual(frame_dst.size, dst_size)
+
+                gt_frame = np.fromfile(dst_fin, np.uint8, dst_size)
+                score = tc.measure_psnr(gt_frame, frame_dst)
+                if score < psnr_threshold:
+                    tc.dump_to_disk(frame_dst, "cc", dst_info.width,
+                                    dst_info.height, "rgb_dist")
+                    self.fail(
+                        "PSNR score is below threshold: " + str(score))
+
+    def test_rgb_deinterleave(self):
+        """
+        This test checks RGB -> RGB_PLANAR conversion which must be lossless.
+        """
+        src_info = tc.gt_by_name("basic_rgb")
+        dst_info = tc.gt_by_name("basic_rgb_planar")
+
+        py_cvt = vali.PyHostFrameConverter(
+            src_info.width,
+            src_info.height,
+            vali.PixelFormat.RGB,
+            vali.PixelFormat.RGB_PLANAR)
+
+        frame_size = src_info.width * src_info.height * 3
+        with open(src_info.uri, "rb") as src_fin, \
+                open(dst_info.uri, "rb") as dst_fin:
+            for i in range(0, src_info.num_frames):
+                frame_src = np.fromfile(src_fin, np.uint8, frame_size)
+                frame_dst = np.ndarray(shape=(0), dtype=np.uint8)
+
+                success, details = py_cvt.Run(frame_src, frame_dst)
+                if not success:
+                    self.fail("Fail to convert frame: " + str(details))
+
+                gt_frame = np.fromfile(dst_fin, np.uint8, frame_size)
+                self.assertTrue(np.array_equal(gt_frame, frame_dst))
+
+    def test_match_gpu(self):
+        """
+        This test checks that CPU and GPU converters give same result with
+        default color conversion parameters.
+        """
+        src_info = tc.gt_by_name("basic_nv12")
+
+        py_upl = vali.PyFrameUploader(gpu_id=self.gpu_id)
+        py_dwn = vali.PySurfaceDownloader(gpu_id=self.gpu_id)
+        gpu_cvt = vali.PySurfaceConverter(gpu_id=self.gpu_id)
+        cpu_cvt = vali.PyHostFrameConverter(
+            src_info.width,
+            src_info.height,
+            vali.PixelFormat.NV12,
+            vali.PixelFormat.RGB)
+
+        with open(src_info.uri, "rb") as src_fin:
+            frame_src = np.fromfile(
+                src_fin, np.uint8, src_info.width * src_info.height * 3 // 2)
+
+        surf_src = vali.Surface.Make(
+            vali.PixelFormat.NV12,
+            src_info.width,
+            src_info.height,
+            gpu_id=self.gpu_id)
+        surf_dst = vali.Surface.Make(
+            vali.PixelFormat.RGB,
+            src_info.width,
+            src_info.height,
+            gpu_id=self.gpu_id)
+
+        self.assertTrue(py_upl.Run(frame_src, surf_src))
+        success, _ = gpu_cvt.Run(surf_src, surf_dst)
+        self.assertTrue(success)
+
+        gpu_frame = np.ndarray(shape=(surf_dst.HostSize), dtype=np.uint8)
+        self.assertTrue(py_dwn.Run(surf_dst, gpu_frame))
+
+        cpu_frame = np.ndarray(shape=(0), dtype=np.uint8)
+        success, _ = cpu_cvt.Run(frame_src, cpu_frame)
+        self.assertTrue(success)
+
+        # Same formulas as NPP, only rounding may differ.
+        self.assertEqual(gpu_frame.size, cpu_frame.size)
+        diff = np.abs(gpu_frame.astype(int) - cpu_frame.astype(int))
+        self.assertLessEqual(np.max(diff), 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
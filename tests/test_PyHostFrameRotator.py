@@ -0,0 +1,164 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+
+import python_vali as vali
+import numpy as np
+import unittest
+import test_common as tc
+from parameterized import parameterized
+from PIL import Image
+
+# We use 42 (dB) as the measure of similarity.
+# If two images have PSNR higher than 42 (dB) we consider them the same.
+psnr_threshold = 42.0
+
+
+class TestHostFrameRotator(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+
+    def test_supported_formats(self):
+        formats = vali.PyHostFrameRotator.SupportedFormats()
+        self.assertIn(vali.PixelFormat.NV12, formats)
+        self.assertIn(vali.PixelFormat.RGB, formats)
+
+    def test_unsupported_format(self):
+        with self.assertRaises(ValueError):
+            vali.PyHostFrameRotator(64, 64, vali.PixelFormat.P12)
+
+    def test_invalid_src(self):
+        py_rot = vali.PyHostFrameRotator(64, 64, vali.PixelFormat.NV12)
+
+        frame_src = np.zeros(10, dtype=np.uint8)
+        frame_dst = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = py_rot.Run(frame_src, frame_dst, 90.0)
+        self.assertFalse(success)
+        self.assertEqual(info, vali.TaskExecInfo.INVALID_INPUT)
+
+    @parameterized.expand([
+        [90.0],
+        [180.0],
+        [270.0]
+    ])
+    def test_rotate(self, angle: float):
+        """
+        This test checks rotation against etalon and numpy.rot90.
+        """
+        frame_src = np.asarray(Image.open("data/frame_0.jpg"))
+        height, width, _ = frame_src.shape
+
+        py_rot = vali.PyHostFrameRotator(width, height, vali.PixelFormat.RGB)
+        dst_width, dst_height = py_rot.DstSize(angle)
+
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = py_rot.Run(frame_src, frame, angle)
+        self.assertTrue(success)
+        self.assertEqual(info, vali.TaskExecInfo.SUCCESS)
+
+        frame = frame.reshape((dst_height, dst_width, 3))
+        self.assertTrue(np.array_equal(
+            frame, np.rot90(frame_src, k=int(angle) // 90)))
+
+        fname = "data/frame_0_" + str(int(angle)) + "_deg.jpg"
+        psnr_score = tc.measure_psnr(np.asarray(Image.open(fname)), frame)
+        self.assertGreaterEqual(psnr_score, psnr_threshold)
+
+    def test_display_rotation(self):
+        """
+        This test checks NV12 frame auto-rotation according to display matrix.
+        Chroma plane has to be rotated as a whole pairs of U and V values.
+        """
+        gt = tc.gt_by_name("rotation_90_deg")
+        py_dec = vali.PyDecoder(input=gt.uri, opts={}, gpu_id=-1)
+        self.assertEqual(py_dec.Format, vali.PixelFormat.NV12)
+
+        frame_src = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = py_dec.DecodeSingleFrame(frame_src)
+        self.assertTrue(success)
+
+        angle = py_dec.DisplayRotation
+        py_rot = vali.PyHostFrameRotator(
+            py_dec.Width, py_dec.Height, vali.PixelFormat.NV12)
+
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = py_rot.Run(frame_src, frame, angle)
+        self.assertTrue(success)
+
+        k = int(angle) // 90
+        luma_size = py_dec.Width * py_dec.Height
+        src_y = frame_src[:luma_size].reshape((py_dec.Height, py_dec.Width))
+        src_uv = frame_src[luma_size:].reshape(
+            (py_dec.Height // 2, py_dec.Width // 2, 2))
+
+        dst_y = frame[:luma_size].reshape((py_dec.Width, py_dec.Height))
+        dst_uv = frame[luma_size:].reshape(
+            (py_dec.Width // 2, py_dec.Height // 2, 2))
+
+        self.assertTrue(np.array_equal(dst_y, np.rot90(src_y, k=k)))
+        self.assertTrue(np.array_equal(dst_uv, np.rot90(src_uv, k=k)))
+
+    def test_explicit_shift(self):
+        """
+        This test checks that interpolated rotation by 180 degrees with
+        explicit shift gives same result as fast path.
+        """
+        frame_src = np.asarray(Image.open("data/frame_0.jpg"))
+        height, width, _ = frame_src.shape
+
+        py_rot = vali.PyHostFrameRotator(width, height, vali.PixelFormat.RGB)
+
+        frame_fast = np.ndarray(shape=(0), dtype=np.uint8)
+        success, _ = py_rot.Run(frame_src, frame_fast, 180.0)
+        self.assertTrue(success)
+
+        frame_interp = np.ndarray(shape=(0), dtype=np.uint8)
+        success, _ = py_rot.Run(
+            frame_src, frame_interp, 180.0, width - 1, height - 1)
+        self.assertTrue(success)
+
+        self.assertTrue(np.array_equal(frame_fast, frame_interp))
+
+
+if __name__ == "__main__":
+    unittest.main()
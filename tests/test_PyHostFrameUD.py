@@ -0,0 +1,153 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import numpy as np
+import unittest
+import test_common as tc
+from parameterized import parameterized
+
+psnr_threshold = 42.0
+
+
+class TestHostFrameUD(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+
+        self.target_w = 640
+        self.target_h = 360
+
+    @staticmethod
+    def get_gt_name(fmt: vali.PixelFormat) -> str:
+        if fmt == vali.PixelFormat.NV12 or fmt == vali.PixelFormat.YUV420:
+            return 'basic'
+        elif fmt == vali.PixelFormat.P10 or fmt == vali.PixelFormat.YUV420_10bit:
+            return 'hevc10'
+
+    @staticmethod
+    def get_dtype(fmt: vali.PixelFormat) -> np.dtype:
+        if fmt in [vali.PixelFormat.RGB_32F, vali.PixelFormat.RGB_32F_PLANAR]:
+            return np.float32
+        elif fmt in [vali.PixelFormat.P10, vali.PixelFormat.YUV420_10bit,
+                     vali.PixelFormat.YUV444_10bit]:
+            return np.uint16
+        return np.uint8
+
+    def decode_frame(self, fmt: vali.PixelFormat) -> np.ndarray:
+        """
+        Decodes first frame on CPU and converts it to given pixel format.
+        """
+        gt = tc.gt_by_name(self.get_gt_name(fmt))
+        py_dec = vali.PyDecoder(input=gt.uri, opts={}, gpu_id=-1)
+
+        # Decoder and converter operate on byte arrays.
+        frame = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = py_dec.DecodeSingleFrame(frame)
+        if not success:
+            self.fail(info)
+
+        if py_dec.Format == fmt:
+            return frame.view(self.get_dtype(fmt))
+
+        py_cvt = vali.PyFrameConverter(
+            py_dec.Width, py_dec.Height, py_dec.Format, fmt)
+        frame_cvt = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = py_cvt.Run(frame, frame_cvt, None)
+        if not success:
+            self.fail(info)
+
+        return frame_cvt.view(self.get_dtype(fmt))
+
+    def test_supported_formats(self):
+        self.assertEqual(
+            vali.PyHostFrameUD.SupportedFormats(),
+            vali.PySurfaceUD.SupportedFormats())
+
+    def test_invalid_src(self):
+        py_ud = vali.PyHostFrameUD(
+            64, 64, vali.PixelFormat.NV12,
+            32, 32, vali.PixelFormat.YUV444)
+
+        frame_src = np.zeros(10, dtype=np.uint8)
+        frame_dst = np.ndarray(shape=(0), dtype=np.uint8)
+        success, info = py_ud.Run(frame_src, frame_dst)
+        self.assertFalse(success)
+        self.assertEqual(info, vali.TaskExecInfo.INVALID_INPUT)
+
+    @parameterized.expand(vali.PyHostFrameUD.SupportedFormats())
+    def test_match_gpu(self, src_fmt, dst_fmt):
+        """
+        This test checks UD transform against output of GPU implementation.
+        """
+        gt = tc.gt_by_name(self.get_gt_name(src_fmt))
+        frame_src = self.decode_frame(src_fmt)
+
+        py_ud = vali.PyHostFrameUD(
+            gt.width, gt.height, src_fmt,
+            self.target_w, self.target_h, dst_fmt)
+
+        frame = np.ndarray(shape=(0), dtype=self.get_dtype(dst_fmt))
+        success, info = py_ud.Run(frame_src, frame)
+        if not success:
+            self.fail(info)
+
+        fname = str(self.target_w) + 'x' + str(self.target_h) + \
+            '_' + str(src_fmt) + '_' + str(dst_fmt) + '.raw'
+        fname = 'data/' + fname
+
+        gt_frame = np.fromfile(fname, dtype=frame.dtype)
+        self.assertEqual(gt_frame.size, frame.size)
+        self.assertGreaterEqual(
+            tc.measure_psnr(gt_frame, frame), psnr_threshold)
+
+        # Semi-planar inputs replicate GPU sampling, so integer outputs
+        # differ by rounding only.
+        is_semi_planar = src_fmt in [vali.PixelFormat.NV12,
+                                     vali.PixelFormat.P10]
+        if is_semi_planar and frame.dtype != np.float32:
+            diff = np.abs(gt_frame.astype(int) - frame.astype(int))
+            self.assertLessEqual(np.max(diff), 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,225 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import numpy as np
+import unittest
+import test_common as tc
+
+
+class TestPyPipeline(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+        self.gt_info = tc.gt_by_name("basic")
+        self.cc_ctx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709, vali.ColorRange.MPEG)
+
+    def test_decode_convert(self):
+        """
+        This test checks that pipeline output matches frames decoded and
+        converted one by one.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        py_cvt = vali.PyFrameConverter(
+            py_dec.Width, py_dec.Height, py_dec.Format, vali.PixelFormat.RGB)
+
+        pipeline = vali.PyPipeline()
+        dec = pipeline.AddDecoder(py_dec, pool_size=3)
+        cvt = pipeline.AddConverter(dec, py_cvt, self.cc_ctx, pool_size=2)
+        pipeline.Start()
+
+        ref_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        ref_cvt = vali.PyFrameConverter(
+            ref_dec.Width, ref_dec.Height, ref_dec.Format,
+            vali.PixelFormat.RGB)
+        yuv = vali.HostBuffer(ref_dec.Format, ref_dec.Width, ref_dec.Height)
+        rgb = vali.HostBuffer(vali.PixelFormat.RGB, ref_dec.Width,
+                              ref_dec.Height)
+        ref_pkt = vali.PacketData()
+
+        num_frames = 0
+        while True:
+            frames, info = pipeline.Pull(cvt)
+            if info == vali.TaskExecInfo.END_OF_STREAM:
+                break
+            self.assertEqual(info, vali.TaskExecInfo.SUCCESS)
+            self.assertEqual(len(frames), 1)
+
+            success, info = ref_dec.DecodeSingleFrame(yuv, ref_pkt)
+            self.assertTrue(success, info)
+            success, info = ref_cvt.Run(yuv, rgb, self.cc_ctx)
+            self.assertTrue(success, info)
+
+            frame, pkt_data = frames[0]
+            self.assertEqual(frame.Format, vali.PixelFormat.RGB)
+            self.assertEqual(pkt_data.pts, ref_pkt.pts)
+            self.assertTrue(np.array_equal(
+                np.asarray(frame), np.asarray(rgb)))
+            num_frames += 1
+
+        self.assertEqual(num_frames, self.gt_info.num_frames)
+
+    def test_batch(self):
+        """
+        This test checks that batches cover all frames in order.
+        """
+        batch_size = 10
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        pipeline = vali.PyPipeline()
+
+        # Previous batch is alive while next one is taken.
+        dec = pipeline.AddDecoder(py_dec, pool_size=2 * batch_size)
+        pipeline.Start()
+
+        with self.assertRaises(ValueError):
+            pipeline.Pull(dec, 2 * batch_size + 1)
+
+        pts = []
+        while True:
+            frames, info = pipeline.Pull(dec, batch_size)
+            for frame, pkt_data in frames:
+                pts.append(pkt_data.pts)
+            if info != vali.TaskExecInfo.SUCCESS:
+                self.assertEqual(info, vali.TaskExecInfo.END_OF_STREAM)
+                self.assertLess(len(frames), batch_size)
+                break
+            self.assertEqual(len(frames), batch_size)
+
+        self.assertEqual(len(pts), self.gt_info.num_frames)
+        self.assertEqual(pts, sorted(pts))
+
+    def test_timeout(self):
+        """
+        This test checks that held frames stall the pipeline.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        pipeline = vali.PyPipeline()
+        dec = pipeline.AddDecoder(py_dec, pool_size=2)
+        pipeline.Start()
+
+        frames, info = pipeline.Pull(dec, 2, timeout_ms=5000)
+        self.assertEqual(info, vali.TaskExecInfo.SUCCESS)
+
+        held, info = pipeline.Pull(dec, 1, timeout_ms=100)
+        self.assertEqual(len(held), 0)
+        self.assertEqual(info, vali.TaskExecInfo.MORE_DATA_NEEDED)
+
+        arr = np.asarray(frames[0][0])
+        del frames
+        held, info = pipeline.Pull(dec, 1, timeout_ms=5000)
+        self.assertEqual(len(held), 1)
+
+        pipeline.Stop()
+        frames, info = pipeline.Pull(dec)
+        self.assertEqual(info, vali.TaskExecInfo.END_OF_STREAM)
+
+        # Taken frames are valid after pipeline is gone.
+        del pipeline
+        self.assertEqual(np.asarray(held[0][0]).shape, arr.shape)
+
+    def test_resize(self):
+        """
+        This test checks resizer stage.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        dst_fmts = [dst for src, dst in vali.PyHostFrameUD.SupportedFormats()
+                    if src == py_dec.Format]
+        if not dst_fmts:
+            self.skipTest("No resizer for " + str(py_dec.Format))
+
+        args = (py_dec.Width, py_dec.Height, py_dec.Format,
+                py_dec.Width // 2, py_dec.Height // 2, dst_fmts[0])
+        py_ud = vali.PyHostFrameUD(*args)
+        ref_ud = vali.PyHostFrameUD(*args)
+
+        pipeline = vali.PyPipeline()
+        dec = pipeline.AddDecoder(py_dec)
+        ud = pipeline.AddResizer(dec, py_ud)
+        pipeline.Start()
+
+        ref_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        src = vali.HostBuffer(ref_dec.Format, ref_dec.Width, ref_dec.Height)
+        dst = vali.HostBuffer(dst_fmts[0], 2, 2)
+        for _ in range(10):
+            frames, info = pipeline.Pull(ud)
+            self.assertEqual(info, vali.TaskExecInfo.SUCCESS)
+
+            success, info = ref_dec.DecodeSingleFrame(src)
+            self.assertTrue(success, info)
+            success, info = ref_ud.Run(src, dst)
+            self.assertTrue(success, info)
+
+            frame = frames[0][0]
+            self.assertEqual(frame.Width, py_dec.Width // 2)
+            self.assertTrue(np.array_equal(
+                np.asarray(frame), np.asarray(dst)))
+
+    def test_invalid_graph(self):
+        """
+        This test checks graph validation.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        py_cvt = vali.PyFrameConverter(
+            py_dec.Width + 2, py_dec.Height, py_dec.Format,
+            vali.PixelFormat.RGB)
+
+        pipeline = vali.PyPipeline()
+        with self.assertRaises(RuntimeError):
+            pipeline.Start()
+
+        dec = pipeline.AddDecoder(py_dec)
+        with self.assertRaises(ValueError):
+            pipeline.AddConverter(dec, py_cvt)
+        with self.assertRaises(ValueError):
+            pipeline.AddConverter(dec + 1, py_cvt)
+
+        with self.assertRaises(RuntimeError):
+            pipeline.Pull(dec)
+
+        pipeline.Start()
+        with self.assertRaises(RuntimeError):
+            pipeline.Start()
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,219 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+
+import python_vali as vali
+import numpy as np
+import unittest
+import multiprocessing as mp
+import threading
+import test_common as tc
+
+
+def consume(name: str, num_frames: int, queue) -> None:
+    ring = vali.ShmFrameRing.Attach(name)
+    sums = []
+    for _ in range(num_frames):
+        res = ring.Acquire(timeout_ms=5000)
+        if res is None:
+            break
+        frame, pkt_data = res
+        sums.append((pkt_data.pts, int(np.asarray(frame).sum())))
+        del frame
+    queue.put(sums)
+
+
+@unittest.skipIf(os.name == "nt", "POSIX shared memory only")
+class TestShmFrameRing(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+        self.gt_info = tc.gt_by_name("basic")
+        self.name = "vali_test_ring_" + str(os.getpid())
+
+    def test_create_attach(self):
+        """
+        This test checks ring properties and name handling.
+        """
+        ring = vali.ShmFrameRing.Create(self.name, 3, 1000)
+        self.assertEqual(ring.NumSlots, 3)
+        self.assertEqual(ring.SlotSize, 1000)
+
+        with self.assertRaises(RuntimeError):
+            vali.ShmFrameRing.Create(self.name, 3, 1000)
+
+        other = vali.ShmFrameRing.Attach(self.name)
+        self.assertEqual(other.NumSlots, 3)
+        self.assertIsNone(other.Acquire(timeout_ms=10))
+
+        # Shared memory is removed along with creator's ring.
+        del ring
+        with self.assertRaises(RuntimeError):
+            vali.ShmFrameRing.Attach(self.name)
+
+    def test_decode(self):
+        """
+        This test checks that frames decoded into ring match frames
+        decoded into numpy array and that slots are reused.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        ref_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        ring = vali.ShmFrameRing.Create(self.name, 2, py_dec.HostFrameSize)
+        consumer = vali.ShmFrameRing.Attach(self.name)
+
+        ref = np.ndarray(shape=(0), dtype=np.uint8)
+        ref_pkt = vali.PacketData()
+        for _ in range(8):
+            success, info = py_dec.DecodeSingleFrame(ring, timeout_ms=1000)
+            self.assertTrue(success, info)
+
+            success, info = ref_dec.DecodeSingleFrame(ref, ref_pkt)
+            self.assertTrue(success, info)
+
+            frame, pkt_data = consumer.Acquire(timeout_ms=1000)
+            self.assertEqual(frame.Format, py_dec.Format)
+            self.assertEqual(frame.Width, py_dec.Width)
+            self.assertEqual(frame.Height, py_dec.Height)
+            self.assertEqual(pkt_data.pts, ref_pkt.pts)
+            self.assertTrue(np.array_equal(np.asarray(frame).ravel(), ref))
+
+        # Slot isn't given back while exported array is alive.
+        arr = np.asarray(frame)
+        del frame
+        success, _ = py_dec.DecodeSingleFrame(ring, timeout_ms=100)
+        self.assertTrue(success)
+        success, _ = py_dec.DecodeSingleFrame(ring, timeout_ms=100)
+        self.assertFalse(success)
+
+        del arr
+        success, info = py_dec.DecodeSingleFrame(ring, timeout_ms=100)
+        self.assertTrue(success, info)
+
+    def test_many_producers(self):
+        """
+        This test checks that producers don't take the same slot when
+        they write into single slot ring concurrently.
+        """
+        num_producers, num_frames = 3, 10
+        ref_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        ring = vali.ShmFrameRing.Create(self.name, 1, ref_dec.HostFrameSize)
+
+        ref = np.ndarray(shape=(0), dtype=np.uint8)
+        ref_pkt = vali.PacketData()
+        ref_sums = {}
+        for _ in range(num_frames):
+            success, info = ref_dec.DecodeSingleFrame(ref, ref_pkt)
+            self.assertTrue(success, info)
+            ref_sums[ref_pkt.pts] = int(ref.sum())
+
+        # Assertions don't work in other threads, failures are collected.
+        failures = []
+
+        def produce():
+            py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+            for _ in range(num_frames):
+                success, info = py_dec.DecodeSingleFrame(
+                    ring, timeout_ms=5000)
+                if not success:
+                    failures.append(info)
+
+        producers = [threading.Thread(target=produce)
+                     for _ in range(num_producers)]
+        for producer in producers:
+            producer.start()
+
+        counts = {}
+        for _ in range(num_producers * num_frames):
+            res = ring.Acquire(timeout_ms=5000)
+            self.assertIsNotNone(res)
+            frame, pkt_data = res
+            self.assertEqual(int(np.asarray(frame).sum()),
+                             ref_sums[pkt_data.pts])
+            counts[pkt_data.pts] = counts.get(pkt_data.pts, 0) + 1
+            del frame
+
+        for producer in producers:
+            producer.join()
+        self.assertEqual(failures, [])
+        self.assertEqual(counts, {pts: num_producers for pts in ref_sums})
+
+    def test_small_slot(self):
+        """
+        This test checks that frame which doesn't fit into slot is rejected.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        ring = vali.ShmFrameRing.Create(self.name, 2, 16)
+        success, info = py_dec.DecodeSingleFrame(ring)
+        self.assertFalse(success)
+        self.assertEqual(info, vali.TaskExecInfo.SRC_DST_SIZE_MISMATCH)
+
+    def test_other_process(self):
+        """
+        This test checks frames handoff to consumer process.
+        """
+        num_frames = 16
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        ring = vali.ShmFrameRing.Create(self.name, 4, py_dec.HostFrameSize)
+
+        queue = mp.Queue()
+        proc = mp.Process(target=consume, args=(self.name, num_frames, queue))
+        proc.start()
+
+        ref_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        ref = np.ndarray(shape=(0), dtype=np.uint8)
+        ref_pkt = vali.PacketData()
+        ref_sums = []
+        for _ in range(num_frames):
+            success, info = py_dec.DecodeSingleFrame(ring, timeout_ms=5000)
+            self.assertTrue(success, info)
+
+            success, info = ref_dec.DecodeSingleFrame(ref, ref_pkt)
+            self.assertTrue(success, info)
+            ref_sums.append((ref_pkt.pts, int(ref.sum())))
+
+        sums = queue.get(timeout=30)
+        proc.join()
+        self.assertEqual(sums, ref_sums)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,129 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import unittest
+import test_common as tc
+
+
+class TestTaskStats(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+        self.gt_info = tc.gt_by_name("basic")
+
+    def test_decode_convert(self):
+        """
+        This test checks that decoder and converter calls are counted.
+        """
+        num_frames = 10
+        vali.ResetTaskStats()
+
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        py_cvt = vali.PyFrameConverter(
+            py_dec.Width, py_dec.Height, py_dec.Format, vali.PixelFormat.RGB)
+        cc_ctx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709, vali.ColorRange.MPEG)
+
+        yuv = vali.HostBuffer(py_dec.Format, py_dec.Width, py_dec.Height)
+        rgb = vali.HostBuffer(vali.PixelFormat.RGB, py_dec.Width,
+                              py_dec.Height)
+        for i in range(0, num_frames):
+            success, info = py_dec.DecodeSingleFrame(yuv)
+            self.assertTrue(success, info)
+            success, info = py_cvt.Run(yuv, rgb, cc_ctx)
+            self.assertTrue(success, info)
+
+        stats = vali.GetTaskStats()
+        self.assertIn("DecodeFrame", stats)
+        self.assertIn("FfmpegConvertFrame", stats)
+
+        dec_stats = stats["DecodeFrame"]
+        self.assertEqual(dec_stats["calls"], num_frames)
+        self.assertEqual(dec_stats["failures"], 0)
+        self.assertEqual(sum(dec_stats["infos"].values()), num_frames)
+        self.assertEqual(
+            sum(count for _, count in dec_stats["histogram"]), num_frames)
+
+        for stat in stats.values():
+            self.assertGreater(stat["total_ms"], 0.0)
+            self.assertLessEqual(stat["p50_us"], stat["p99_us"])
+            self.assertLessEqual(stat["p99_us"], stat["max_us"])
+
+    def test_reset(self):
+        """
+        This test checks that reset brings counters to zero.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        yuv = vali.HostBuffer(py_dec.Format, py_dec.Width, py_dec.Height)
+        success, info = py_dec.DecodeSingleFrame(yuv)
+        self.assertTrue(success, info)
+        self.assertIn("DecodeFrame", vali.GetTaskStats())
+
+        vali.ResetTaskStats()
+        self.assertEqual(vali.GetTaskStats(), {})
+
+        success, info = py_dec.DecodeSingleFrame(yuv)
+        self.assertTrue(success, info)
+        dec_stats = vali.GetTaskStats()["DecodeFrame"]
+        self.assertEqual(dec_stats["calls"], 1)
+        self.assertAlmostEqual(dec_stats["max_us"], dec_stats["mean_us"])
+
+    def test_decode_end_of_stream(self):
+        """
+        This test checks that end of stream is counted by returned info.
+        """
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        yuv = vali.HostBuffer(py_dec.Format, py_dec.Width, py_dec.Height)
+
+        vali.ResetTaskStats()
+        while True:
+            success, info = py_dec.DecodeSingleFrame(yuv)
+            if not success:
+                break
+
+        infos = vali.GetTaskStats()["DecodeFrame"]["infos"]
+        self.assertEqual(infos[vali.TaskExecInfo.END_OF_STREAM], 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
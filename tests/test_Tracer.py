@@ -0,0 +1,142 @@
+#
+# Copyright 2025 Vision Labs LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Starting from Python 3.8 DLL search policy has changed.
+# We need to add path to CUDA DLLs explicitly.
+import sys
+import os
+from os.path import join, dirname
+
+if os.name == "nt":
+    # Add CUDA_PATH env variable
+    cuda_path = os.environ["CUDA_PATH"]
+    if cuda_path:
+        os.add_dll_directory(os.path.join(cuda_path, "bin"))
+    else:
+        print("CUDA_PATH environment variable is not set.", file=sys.stderr)
+        print("Can't set CUDA DLLs search path.", file=sys.stderr)
+        exit(1)
+
+    # Add PATH as well for minor CUDA releases
+    sys_path = os.environ["PATH"]
+    if sys_path:
+        paths = sys_path.split(";")
+        for path in paths:
+            if os.path.isdir(path):
+                os.add_dll_directory(path)
+    else:
+        print("PATH environment variable is not set.", file=sys.stderr)
+        exit(1)
+
+import python_vali as vali
+import json
+import os
+import tempfile
+import unittest
+import test_common as tc
+
+
+class TestTracer(unittest.TestCase):
+    def __init__(self, methodName):
+        super().__init__(methodName=methodName)
+        self.gt_info = tc.gt_by_name("basic")
+
+    def tearDown(self):
+        vali.SetTraceTag("")
+        vali.SetTraceBackend(vali.TraceBackend.NVTX)
+
+    def dump_trace(self):
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            path = os.path.join(tmp_dir, "trace.json")
+            num_ranges = vali.DumpTrace(path)
+            with open(path) as f:
+                events = json.load(f)["traceEvents"]
+
+        self.assertEqual(len(events), num_ranges)
+        return events
+
+    def decode(self, num_frames):
+        py_dec = vali.PyDecoder(self.gt_info.uri, {}, gpu_id=-1)
+        py_cvt = vali.PyFrameConverter(
+            py_dec.Width, py_dec.Height, py_dec.Format, vali.PixelFormat.RGB)
+        cc_ctx = vali.ColorspaceConversionContext(
+            vali.ColorSpace.BT_709, vali.ColorRange.MPEG)
+
+        yuv = vali.HostBuffer(py_dec.Format, py_dec.Width, py_dec.Height)
+        rgb = vali.HostBuffer(vali.PixelFormat.RGB, py_dec.Width,
+                              py_dec.Height)
+        for i in range(0, num_frames):
+            success, info = py_dec.DecodeSingleFrame(yuv)
+            self.assertTrue(success, info)
+            success, info = py_cvt.Run(yuv, rgb, cc_ctx)
+            self.assertTrue(success, info)
+
+    def test_chrome_trace(self):
+        """
+        This test checks that decoder and converter ranges are captured.
+        """
+        vali.SetTraceBackend(vali.TraceBackend.CHROME)
+        self.assertEqual(vali.GetTraceBackend(), vali.TraceBackend.CHROME)
+        vali.SetTraceTag("basic")
+        self.decode(10)
+
+        events = self.dump_trace()
+        names = set(event["name"] for event in events)
+        for name in ["ReadPacket", "DecodePacket", "ReceiveFrame",
+                     "GetLastFrame", "FfmpegConvertFrame"]:
+            self.assertIn(name, names)
+
+        for event in events:
+            self.assertEqual(event["ph"], "X")
+            self.assertGreaterEqual(event["dur"], 0.0)
+            self.assertEqual(event["args"]["tag"], "basic")
+
+        frames = [e for e in events if e["name"] == "FfmpegConvertFrame"]
+        self.assertEqual(len(frames), 10)
+        timestamps = [event["ts"] for event in events]
+        self.assertEqual(timestamps, sorted(timestamps))
+
+    def test_ring_capacity(self):
+        """
+        This test checks that capture keeps last ranges only.
+        """
+        capacity = 16
+        vali.SetTraceBackend(vali.TraceBackend.CHROME, capacity)
+        self.decode(10)
+        self.assertEqual(len(self.dump_trace()), capacity)
+
+        with self.assertRaises(ValueError):
+            vali.SetTraceBackend(vali.TraceBackend.CHROME, 0)
+
+    def test_off(self):
+        """
+        This test checks that new capture starts empty and nothing is
+        captured when tracing is off.
+        """
+        vali.SetTraceBackend(vali.TraceBackend.CHROME)
+        self.decode(1)
+        self.assertGreater(len(self.dump_trace()), 0)
+
+        vali.SetTraceBackend(vali.TraceBackend.CHROME)
+        self.assertEqual(len(self.dump_trace()), 0)
+
+        vali.SetTraceBackend(vali.TraceBackend.OFF)
+        self.decode(1)
+        self.assertEqual(len(self.dump_trace()), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()